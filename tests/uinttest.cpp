@@ -80,6 +80,47 @@ return true;
 }
 
 
+template<uuint type_size>
+bool UIntTest::read_int(Int<type_size> & result)
+{
+	if( result.FromString(pline, 10, &pline) )
+	{
+		std::cerr << " carry from Int<>::FromString()" << std::endl;
+		return false;
+	}
+
+return true;
+}
+
+
+bool UIntTest::read_dynint(DynInt & result)
+{
+bool value_read;
+
+	int c = result.FromString(pline, 10, &pline, &value_read);
+
+	if( c || !value_read )
+	{
+		std::cerr << " incorrect value for DynInt::FromString()" << std::endl;
+		return false;
+	}
+
+return true;
+}
+
+
+bool UIntTest::check_dynint(const DynInt & result, const DynInt & new_result, const char * what)
+{
+	if( new_result != result )
+	{
+		std::cerr << "Incorrect " << what << ": " << new_result << " (expected: " << result << ")" << std::endl;
+		return false;
+	}
+
+return true;
+}
+
+
 bool UIntTest::check_minmax_bits(int type_size)
 {
 	uuint min_bits;
@@ -174,6 +215,38 @@ return true;
 }
 
 
+/*
+	the vector methods return a whole word (e.g. the highest word of the product)
+	so the carry is compared as uuint, 'variant' is printed if something is wrong
+*/
+template<uuint type_size>
+bool UIntTest::check_vector(const ttmath::UInt<type_size> & result, const ttmath::UInt<type_size> & new_result,
+						uuint carry, uuint new_carry, const char * variant)
+{
+bool ok = true;
+
+	if( new_carry != carry )
+	{
+		std::cerr << "Incorrect carry: " << new_carry << " (expected: " << carry << ")";
+		ok = false;
+	}
+
+	if( new_result != result )
+	{
+		if( !ok )
+			std::cerr << ", ";
+
+		std::cerr << "Incorrect result: " << new_result << " (expected: " << result << ")";
+		ok = false;
+	}
+
+	if( !ok )
+		std::cerr << " (" << variant << ")" << std::endl;
+
+return ok;
+}
+
+
 
 template<uuint type_size>
 void UIntTest::test_add()
@@ -271,107 +344,2870 @@ void UIntTest::test_addtwoints()
 }
 
 
-int UIntTest::upper_char(int c)
+/*
+	on x86_64 the multiplication by a word (MulVector(), MulAddVector() and MulSubVector())
+	has two variants: with the mulx/adx instructions (if the processor has them) and
+	the generic one, both are tested (use_mulx_adx is 0 and 1)
+*/
+uuint mulx_adx_variants()
 {
-	if( c>='a' && c<='z' )
-		return c - 'a' + 'A';
-
-return c;
+	#if defined(TTMATH_PLATFORM64) && !defined(TTMATH_NOASM)
+		return CpuHasMulxAdx_Check() ? 2 : 1;
+	#else
+		return 1;
+	#endif
 }
 
 
-bool UIntTest::is_white(int c)
+void use_mulx_adx(bool use)
 {
-	if( c==' ' || c=='\t' || c==13 )
-		return true;
-
-return false;
+	#if defined(TTMATH_PLATFORM64) && !defined(TTMATH_NOASM)
+		CpuUseMulxAdx(use);
+	#else
+		(void)use;
+	#endif
 }
 
 
-void UIntTest::skip_white_characters()
+
+/*
+	the methods working on the lowest 'size' words (Add_Partial() and others)
+
+	size is the bigger UsedSize() of a and b (zero if both are zero, type_size if
+	the highest word is used), the results are compared with the methods working
+	on all words, UsedSize() is compared with the index of the highest set bit
+*/
+template<uuint type_size>
+void UIntTest::test_partial()
 {
-	while( is_white(*pline) )
-		++pline;
-}
+	UInt<type_size> a, b, result, new_result;
+	uuint bits, table_id, index;
+	int carry, new_carry;
 
+	if( !check_minmax_bits(type_size) )
+		return;
 
+	read_uint(a);
+	read_uint(b);
+	read_uint(bits);
 
-bool UIntTest::read_method()
-{
-	skip_white_characters();
-	
-	if( *pline == '#' )
-		return false;
-	
-	method.clear();
+	std::cerr << '[' << row << "] Partial<" << type_size << ">: ";
 
-	for(int c = upper_char(*pline) ; c>='A'&& c<='Z' ; c = upper_char(*pline) )
+	if( !check_end() )
+		return;
+
+	uuint used = a.FindLeadingBit(table_id, index) ? table_id + 1 : 0;
+
+	if( a.UsedSize() != used )
 	{
-		method += c;
-		++pline;
+		std::cerr << "Incorrect UsedSize: " << a.UsedSize() << " (expected: " << used << ")" << std::endl;
+		return;
 	}
 
-	if( method.empty() )
+	uuint size = (a.UsedSize() > b.UsedSize()) ? a.UsedSize() : b.UsedSize();
+
+	for(uuint c=0 ; c<2 ; ++c)
 	{
-		skip_white_characters();
-		if( *pline == 0 )
-			return false;
-		else
-		{	
-			std::cerr << '[' << row << "] ";
-			std::cerr << "syntax error" << std::endl;
-			return false;
+		result     = a;
+		carry      = result.Add(b, c);
+		new_result = a;
+		new_carry  = new_result.Add_Partial(b, size, c);
+
+		if( !check_result_carry(result, new_result, carry, new_carry) )
+		{
+			std::cerr << " (Add_Partial, c: " << c << ")" << std::endl;
+			return;
+		}
+
+		result     = a;
+		carry      = result.Sub(b, c);
+		new_result = a;
+		new_carry  = new_result.Sub_Partial(b, size, c);
+
+		if( !check_result_carry(result, new_result, carry, new_carry) )
+		{
+			std::cerr << " (Sub_Partial, c: " << c << ")" << std::endl;
+			return;
 		}
 	}
 
+	result     = a;
+	carry      = result.Rcl(bits);
+	new_result = a;
+	new_carry  = new_result.Rcl_Partial(bits, a.UsedSize());
 
-return true;
+	if( !check_result_carry(result, new_result, carry, new_carry) )
+	{
+		std::cerr << " (Rcl_Partial)" << std::endl;
+		return;
+	}
+
+	result     = a;
+	carry      = result.Rcr(bits);
+	new_result = a;
+	new_carry  = new_result.Rcr_Partial(bits, a.UsedSize());
+
+	if( !check_result_carry(result, new_result, carry, new_carry) )
+	{
+		std::cerr << " (Rcr_Partial)" << std::endl;
+		return;
+	}
+
+	result     = a;
+	result.BitAnd(b);
+	new_result = a;
+	new_result.BitAnd_Partial(b, size);
+
+	if( !check_result_carry(result, new_result, 0, 0) )
+	{
+		std::cerr << " (BitAnd_Partial)" << std::endl;
+		return;
+	}
+
+	result     = a;
+	result.BitOr(b);
+	new_result = a;
+	new_result.BitOr_Partial(b, size);
+
+	if( !check_result_carry(result, new_result, 0, 0) )
+	{
+		std::cerr << " (BitOr_Partial)" << std::endl;
+		return;
+	}
+
+	result     = a;
+	result.BitXor(b);
+	new_result = a;
+	new_result.BitXor_Partial(b, size);
+
+	if( !check_result_carry(result, new_result, 0, 0) )
+	{
+		std::cerr << " (BitXor_Partial)" << std::endl;
+		return;
+	}
+
+	sint cmp = (a < b) ? -1 : (a > b) ? 1 : 0;
+
+	if( a.Cmp_Partial(b, size) != cmp )
+	{
+		std::cerr << "Incorrect result of Cmp_Partial: " << a.Cmp_Partial(b, size) << " (expected: " << cmp << ")" << std::endl;
+		return;
+	}
+
+	std::cerr << "ok" << std::endl;
 }
 
 
 
-void UIntTest::test_method()
+/*
+	the static methods working on vectors of words (UInt<type_size>::AddVector() and others)
+
+	the vectors have type_size words (only the lowest b_words words of b are added or subtracted),
+	the result is calculated into another vector and into the same vector as an argument
+	(the first one, and the second one for AddVector() and SubVector()),
+	MulVector(), MulAddVector() and MulSubVector() are checked with and without mulx/adx
+*/
+template<uuint type_size>
+void UIntTest::test_vector()
 {
-const char * p = pline;
+	UInt<type_size> a, b, r, result, new_result;
+	uuint b_words = 0, word = 0, carry = 0, new_carry = 0;
+	std::string operation, cmp;
 
-	if( method == "ADD" )
+	if( !check_minmax_bits_bitperint(type_size) )
+		return;
+
+	read_word(operation);
+	read_uint(a);
+
+	if( operation == "add" || operation == "sub" )
 	{
-		pline = p; test_add<1>();
-		pline = p; test_add<2>();
-		pline = p; test_add<3>();
-		pline = p; test_add<4>();
-		pline = p; test_add<5>();
-		pline = p; test_add<6>();
-		pline = p; test_add<7>();
-		pline = p; test_add<8>();
-		pline = p; test_add<9>();
+		read_uint(b);
+		read_uint(b_words);
 	}
 	else
-	if( method == "ADDINT" )
+	if( operation == "cmp" )
 	{
-		pline = p; test_addint<1>();
-		pline = p; test_addint<2>();
-		pline = p; test_addint<3>();
-		pline = p; test_addint<4>();
-		pline = p; test_addint<5>();
-		pline = p; test_addint<6>();
-		pline = p; test_addint<7>();
-		pline = p; test_addint<8>();
-		pline = p; test_addint<9>();
+		read_uint(b);
+		read_word(cmp);
 	}
 	else
-	if( method == "ADDTWOINTS" )
 	{
-		pline = p; test_addtwoints<1>();
-		pline = p; test_addtwoints<2>();
-		pline = p; test_addtwoints<3>();
-		pline = p; test_addtwoints<4>();
-		pline = p; test_addtwoints<5>();
-		pline = p; test_addtwoints<6>();
-		pline = p; test_addtwoints<7>();
-		pline = p; test_addtwoints<8>();
-		pline = p; test_addtwoints<9>();
+		read_uint(word);
+
+		if( operation == "muladd" || operation == "mulsub" )
+			read_uint(r);
+	}
+
+	if( operation != "cmp" )
+	{
+		read_uint(result);
+		read_uint(carry);
+	}
+
+	std::cerr << '[' << row << "] Vector<" << type_size << ">: ";
+
+	if( !check_end() )
+		return;
+
+	if( operation == "add" || operation == "sub" )
+	{
+		bool add = (operation == "add");
+
+		new_carry = add ? UInt<type_size>::AddVector(a.table, b.table, type_size, b_words, new_result.table)
+		                : UInt<type_size>::SubVector(a.table, b.table, type_size, b_words, new_result.table);
+
+		if( !check_vector(result, new_result, carry, new_carry, "result") )
+			return;
+
+		new_result = a;
+		new_carry = add ? UInt<type_size>::AddVector(new_result.table, b.table, type_size, b_words, new_result.table)
+		                : UInt<type_size>::SubVector(new_result.table, b.table, type_size, b_words, new_result.table);
+
+		if( !check_vector(result, new_result, carry, new_carry, "result is ss1") )
+			return;
+
+		// the second vector has type_size words here (the result is longer than b_words)
+		new_result = b;
+		new_carry = add ? UInt<type_size>::AddVector(a.table, new_result.table, type_size, b_words, new_result.table)
+		                : UInt<type_size>::SubVector(a.table, new_result.table, type_size, b_words, new_result.table);
+
+		if( !check_vector(result, new_result, carry, new_carry, "result is ss2") )
+			return;
+	}
+	else
+	if( operation == "mul" || operation == "muladd" || operation == "mulsub" )
+	{
+		bool ok = true;
+
+		for(uuint v=0 ; v<mulx_adx_variants() && ok ; ++v)
+		{
+			use_mulx_adx(v == 0);
+			const char * variant = (v == 0) ? "mulx/adx: 1" : "mulx/adx: 0";
+
+			if( operation == "mul" )
+			{
+				new_carry = UInt<type_size>::MulVector(a.table, word, type_size, new_result.table);
+				ok = check_vector(result, new_result, carry, new_carry, variant);
+
+				// the result is the same vector as ss1
+				new_result = a;
+				new_carry  = UInt<type_size>::MulVector(new_result.table, word, type_size, new_result.table);
+			}
+			else
+			{
+				new_result = r;
+
+				if( operation == "muladd" )
+					new_carry = UInt<type_size>::MulAddVector(a.table, word, type_size, new_result.table);
+				else
+					new_carry = UInt<type_size>::MulSubVector(a.table, word, type_size, new_result.table);
+			}
+
+			ok = ok && check_vector(result, new_result, carry, new_carry, variant);
+		}
+
+		use_mulx_adx(true);
+
+		if( !ok )
+			return;
+	}
+	else
+	if( operation == "shl" || operation == "shr" || operation == "divint" )
+	{
+		if( operation == "shl" )
+			new_carry = UInt<type_size>::ShiftLeftVector(a.table, type_size, word, new_result.table);
+		else
+		if( operation == "shr" )
+			new_carry = UInt<type_size>::ShiftRightVector(a.table, type_size, word, new_result.table);
+		else
+			new_carry = UInt<type_size>::DivIntVector(a.table, type_size, word, new_result.table);
+
+		if( !check_vector(result, new_result, carry, new_carry, "result") )
+			return;
+
+		new_result = a;
+
+		if( operation == "shl" )
+			new_carry = UInt<type_size>::ShiftLeftVector(new_result.table, type_size, word, new_result.table);
+		else
+		if( operation == "shr" )
+			new_carry = UInt<type_size>::ShiftRightVector(new_result.table, type_size, word, new_result.table);
+		else
+			new_carry = UInt<type_size>::DivIntVector(new_result.table, type_size, word, new_result.table);
+
+		if( !check_vector(result, new_result, carry, new_carry, "result is ss1") )
+			return;
+	}
+	else
+	if( operation == "cmp" )
+	{
+		sint c = UInt<type_size>::CmpVector(a.table, b.table, type_size);
+		const char * new_cmp = (c < 0) ? "smaller" : (c > 0) ? "bigger" : "equal";
+
+		if( cmp != new_cmp )
+		{
+			std::cerr << "Incorrect result: " << new_cmp << " (expected: " << cmp << ")" << std::endl;
+			return;
+		}
+	}
+	else
+	{
+		std::cerr << "incorrect operation: " << operation << std::endl;
+		return;
+	}
+
+	std::cerr << "ok" << std::endl;
+}
+
+
+
+template<uuint type_size>
+void UIntTest::test_mul()
+{
+	UInt<type_size> a, b, result, new_result, r;
+
+	if( !check_minmax_bits(type_size) )
+		return;
+
+	read_uint(a);
+	read_uint(b);
+	read_uint(result);
+
+	uuint carry;
+	read_uint(carry);
+
+	std::cerr << '[' << row << "] Mul<" << type_size << ">: ";
+
+	if( !check_end() )
+		return;
+
+	// algorithms: 1 - 6 and 100 (the fastest one)
+	const uuint algorithm[] = { 1, 2, 3, 4, 5, 6, 100 };
+	bool ok = true;
+
+	for(uuint v=0 ; v<mulx_adx_variants() && ok ; ++v)
+	{
+		use_mulx_adx(v == 0);
+
+		for(size_t i=0 ; i<sizeof(algorithm)/sizeof(uuint) && ok ; ++i)
+		{
+			new_result = a;
+			int new_carry = new_result.Mul(b, algorithm[i]);
+
+			if( !check_result_or_carry(result, new_result, carry, new_carry) )
+			{
+				std::cerr << " (algorithm: " << algorithm[i] << ", mulx/adx: " << (v == 0) << ")" << std::endl;
+				ok = false;
+			}
+		}
+
+		// Div3() subtracts the products by MulSubVector()
+		if( ok && carry == 0 && !b.IsZero() )
+		{
+			new_result = result;
+
+			if( new_result.Div(b, r, 3) != 0 || new_result != a || !r.IsZero() )
+			{
+				std::cerr << "Incorrect result of Div3: " << new_result << " (expected: " << a << ", mulx/adx: " << (v == 0) << ")" << std::endl;
+				ok = false;
+			}
+		}
+	}
+
+	use_mulx_adx(true);
+
+	if( ok )
+		std::cerr << "ok" << std::endl;
+}
+
+
+template<uuint type_size>
+void UIntTest::test_sqr()
+{
+	UInt<type_size> a, result, new_result;
+	UInt<type_size*2> big_result, new_big_result;
+
+	if( !check_minmax_bits(type_size) )
+		return;
+
+	read_uint(a);
+	read_uint(result);
+
+	uuint carry;
+	read_uint(carry);
+
+	std::cerr << '[' << row << "] Sqr<" << type_size << ">: ";
+
+	if( !check_end() )
+		return;
+
+	// algorithms: 1 - 6 and 100 (the fastest one)
+	const uuint algorithm[] = { 1, 2, 3, 4, 5, 6, 100 };
+	UInt<type_size> b(a);
+
+	// the product of two different objects is the reference for SqrBig()
+	a.MulBig(b, big_result, 2);
+
+	for(size_t i=0 ; i<sizeof(algorithm)/sizeof(uuint) ; ++i)
+	{
+		new_result = a;
+		int new_carry = new_result.Sqr(algorithm[i]);
+
+		if( !check_result_or_carry(result, new_result, carry, new_carry) )
+		{
+			std::cerr << " (Sqr, algorithm: " << algorithm[i] << ")" << std::endl;
+			return;
+		}
+
+		a.SqrBig(new_big_result, algorithm[i]);
+
+		if( !check_result_carry(big_result, new_big_result, 0, 0) )
+		{
+			std::cerr << " (SqrBig, algorithm: " << algorithm[i] << ")" << std::endl;
+			return;
+		}
+	}
+
+	std::cerr << "ok" << std::endl;
+}
+
+/*
+	UInt<type_size>::MulAdd() and MulSub() with the algorithms 1 - 6 and 100 (the fastest one),
+	the result is r + a*b or r - a*b (only the lowest type_size words if there is a carry),
+	if a and b are equal the same object is passed as both arguments too (SqrBig() is used)
+*/
+template<uuint type_size>
+void UIntTest::test_muladd()
+{
+	UInt<type_size> r, a, b, result, new_result;
+	std::string operation;
+
+	if( !check_minmax_bits(type_size) )
+		return;
+
+	read_word(operation);
+	read_uint(r);
+	read_uint(a);
+	read_uint(b);
+	read_uint(result);
+
+	uuint carry;
+	read_uint(carry);
+
+	std::cerr << '[' << row << "] MulAdd<" << type_size << ">: ";
+
+	if( !check_end() )
+		return;
+
+	if( operation != "add" && operation != "sub" )
+	{
+		std::cerr << "incorrect operation: " << operation << std::endl;
+		return;
+	}
+
+	// algorithms: 1 - 6 and 100 (the fastest one)
+	const uuint algorithm[] = { 1, 2, 3, 4, 5, 6, 100 };
+
+	for(size_t i=0 ; i<sizeof(algorithm)/sizeof(uuint) ; ++i)
+	{
+		new_result = r;
+		int new_carry = (operation == "add") ? new_result.MulAdd(a, b, algorithm[i]) : new_result.MulSub(a, b, algorithm[i]);
+
+		if( !check_result_carry(result, new_result, int(carry), new_carry) )
+		{
+			std::cerr << " (algorithm: " << algorithm[i] << ")" << std::endl;
+			return;
+		}
+
+		if( a == b )
+		{
+			new_result = r;
+			new_carry  = (operation == "add") ? new_result.MulAdd(a, a, algorithm[i]) : new_result.MulSub(a, a, algorithm[i]);
+
+			if( !check_result_carry(result, new_result, int(carry), new_carry) )
+			{
+				std::cerr << " (the same argument, algorithm: " << algorithm[i] << ")" << std::endl;
+				return;
+			}
+		}
+	}
+
+	std::cerr << "ok" << std::endl;
+}
+
+
+/*
+	Int<type_size>::MulAdd() and MulSub(), the result is r + a*b or r - a*b,
+	the product can be too big for Int<type_size> when the result is not,
+	if there is a carry the result is skipped
+*/
+template<uuint type_size>
+void UIntTest::test_intmuladd()
+{
+	Int<type_size> r, a, b, result, new_result;
+	std::string operation;
+
+	if( !check_minmax_bits(type_size) )
+		return;
+
+	read_word(operation);
+
+	if( !read_int(r) || !read_int(a) || !read_int(b) || !read_int(result) )
+		return;
+
+	uuint carry;
+	read_uint(carry);
+
+	std::cerr << '[' << row << "] IntMulAdd<" << type_size << ">: ";
+
+	if( !check_end() )
+		return;
+
+	if( operation != "add" && operation != "sub" )
+	{
+		std::cerr << "incorrect operation: " << operation << std::endl;
+		return;
+	}
+
+	new_result = r;
+	int new_carry = (operation == "add") ? new_result.MulAdd(a, b) : new_result.MulSub(a, b);
+
+	if( !check_result_or_carry(result, new_result, int(carry), new_carry) )
+		return;
+
+	if( a == b )
+	{
+		new_result = r;
+		new_carry  = (operation == "add") ? new_result.MulAdd(a, a) : new_result.MulSub(a, a);
+
+		if( !check_result_or_carry(result, new_result, int(carry), new_carry) )
+		{
+			std::cerr << " (the same argument)" << std::endl;
+			return;
+		}
+	}
+
+	std::cerr << "ok" << std::endl;
+}
+
+
+/*
+	the integer square root: UInt<type_size>::Sqrt() and Int<type_size>::Sqrt()
+
+	result = floor(sqrt(a)), it's checked that result^2 <= a < (result+1)^2,
+	if the highest bit of a is not set the same value is checked with Int<type_size>
+	and then -a too (Int::Sqrt() returns 1 and the value is not changed)
+*/
+template<uuint type_size>
+void UIntTest::test_sqrt()
+{
+	UInt<type_size> a, result, new_result;
+	UInt<type_size*2> square, next_square, big_root, big_a;
+	Int<type_size> int_a, int_result;
+
+	if( !check_minmax_bits(type_size) )
+		return;
+
+	read_uint(a);
+	read_uint(result);
+
+	std::cerr << '[' << row << "] Sqrt<" << type_size << ">: ";
+
+	if( !check_end() )
+		return;
+
+	new_result = a;
+	new_result.Sqrt();
+
+	if( !check_result_carry(result, new_result, 0, 0) )
+		return;
+
+	// result^2 <= a < (result+1)^2
+	new_result.SqrBig(square);
+	big_root    = new_result;
+	big_root.AddOne();
+	next_square = big_root;
+	next_square.Mul(big_root);
+	big_a       = a;
+
+	if( square > big_a || next_square <= big_a )
+	{
+		std::cerr << "Incorrect result: " << new_result << " (the square is not the nearest one)" << std::endl;
+		return;
+	}
+
+	if( !a.IsTheHighestBitSet() )
+	{
+		int_a      = a;
+		int_result = int_a;
+		int c      = int(int_result.Sqrt());
+
+		if( !check_result_carry(result, int_result, 0, c) )
+		{
+			std::cerr << " (Int::Sqrt)" << std::endl;
+			return;
+		}
+
+		if( !int_a.IsZero() )
+		{
+			int_a.ChangeSign();
+			int_result = int_a;
+			c          = int(int_result.Sqrt());
+
+			if( !check_result_carry(int_a, int_result, 1, c) )
+			{
+				std::cerr << " (Int::Sqrt of a negative value)" << std::endl;
+				return;
+			}
+		}
+	}
+
+	std::cerr << "ok" << std::endl;
+}
+
+
+/*
+	the multiplication of big values (UInt<type_size>)
+
+	a and b are pseudorandom numbers with words_a and words_b words (seed 0 means all bits set),
+	the products from MulBig() with the algorithms 1, 3 - 6 and 100 (the fastest one)
+	and the squares from SqrBig() are compared with the schoolbook multiplication (Mul2Big),
+	the algorithm 1 (bit by bit) is skipped for the NTT sizes (it's too slow)
+*/
+template<uuint type_size>
+void UIntTest::test_mulbig()
+{
+	UInt<type_size> a, b;
+	UInt<type_size*2> result, new_result;
+	uuint words_a, words_b, seed;
+
+	read_uint(words_a);
+	read_uint(words_b);
+	read_uint(seed);
+
+	std::cerr << '[' << row << "] MulBig<" << type_size << ">: ";
+
+	if( !check_end() )
+		return;
+
+	fill_uint(a, words_a, seed);
+	fill_uint(b, words_b, seed);
+
+	// algorithms: 1, 3 - 6 and 100 (the fastest one)
+	const uuint algorithm[] = { 1, 3, 4, 5, 6, 100 };
+	const size_t first = (type_size < TTMATH_USE_NTT_MULTIPLICATION_FROM_SIZE) ? 0 : 1;
+
+	a.MulBig(b, result, 2);
+
+	for(size_t i=first ; i<sizeof(algorithm)/sizeof(uuint) ; ++i)
+	{
+		a.MulBig(b, new_result, algorithm[i]);
+
+		if( new_result != result )
+		{
+			std::cerr << "Incorrect result of MulBig (algorithm: " << algorithm[i] << ")" << std::endl;
+			return;
+		}
+	}
+
+	a.SqrBig(result, 2);
+
+	for(size_t i=first ; i<sizeof(algorithm)/sizeof(uuint) ; ++i)
+	{
+		a.SqrBig(new_result, algorithm[i]);
+
+		if( new_result != result )
+		{
+			std::cerr << "Incorrect result of SqrBig (algorithm: " << algorithm[i] << ")" << std::endl;
+			return;
+		}
+	}
+
+	std::cerr << "ok" << std::endl;
+}
+
+
+
+template<uuint type_size>
+void UIntTest::test_div()
+{
+	UInt<type_size> a, b, q, r, new_q, new_r;
+	UIntDivisor<type_size> divisor;
+
+	if( !check_minmax_bits(type_size) )
+		return;
+
+	read_uint(a);
+	read_uint(b);
+	read_uint(q);
+	read_uint(r);
+
+	uuint carry;
+	read_uint(carry);
+
+	std::cerr << '[' << row << "] Div<" << type_size << ">: ";
+
+	if( !check_end() )
+		return;
+
+	// algorithms: 1, 2, 3, 4 and 100 (the fastest one), 0 means UIntDivisor
+	const uuint algorithm[] = { 1, 2, 3, 4, 100, 0 };
+	divisor.Set(b);
+
+	for(size_t i=0 ; i<sizeof(algorithm)/sizeof(uuint) ; ++i)
+	{
+		new_q = a;
+		int new_carry;
+
+		if( algorithm[i] == 0 )
+			new_carry = new_q.Div(divisor, new_r);
+		else
+			new_carry = new_q.Div(b, new_r, algorithm[i]);
+
+		if( !check_result_or_carry(q, new_q, carry, new_carry) ||
+			!check_result_or_carry(r, new_r, carry, new_carry) )
+		{
+			std::cerr << " (algorithm: " << algorithm[i] << ")" << std::endl;
+			return;
+		}
+	}
+
+	std::cerr << "ok" << std::endl;
+}
+
+
+/*
+	it sets 'words' lower words of 'result' to pseudorandom values
+	(the rest is zero), if seed is zero all bits of these words are set
+*/
+template<uuint type_size>
+void UIntTest::fill_uint(UInt<type_size> & result, uuint words, uuint & seed)
+{
+	result.SetZero();
+
+	for(uuint i=0 ; i<words && i<type_size ; ++i)
+	{
+		if( seed == 0 )
+		{
+			result.table[i] = TTMATH_UINT_MAX_VALUE;
+			continue;
+		}
+
+		for(size_t b=0 ; b<sizeof(uuint) ; ++b)
+		{
+			seed = (seed * 1103515245 + 12345) & 0xffffffff;
+			result.table[i] = (result.table[i] << 8) | ((seed >> 16) & 0xff);
+		}
+	}
+}
+
+
+/*
+	the division of big values (UInt<newton_division_size>)
+
+	the quotient and the remainder from Div() (it selects Div4 for such sizes),
+	Div4(), Div3() and the division by UIntDivisor should be the same
+	and a = q*b + r where r < b
+*/
+void UIntTest::test_divnewton()
+{
+	UInt<newton_division_size> a, b, q, r, q3, r3, temp;
+	UIntDivisor<newton_division_size> divisor;
+	uuint words_a, words_b, seed;
+
+	read_uint(words_a);
+	read_uint(words_b);
+	read_uint(seed);
+
+	std::cerr << '[' << row << "] DivNewton<" << newton_division_size << ">: ";
+
+	if( !check_end() )
+		return;
+
+	fill_uint(a, words_a, seed);
+	fill_uint(b, words_b, seed);
+
+	q3 = a;
+	q3.Div(b, r3, 3);
+
+	q = a;
+	q.Div(b, r);
+
+	if( !check_result_carry(q3, q, 0, 0) || !check_result_carry(r3, r, 0, 0) )
+		return;
+
+	q = a;
+	q.Div(b, r, 4);
+
+	if( !check_result_carry(q3, q, 0, 0) || !check_result_carry(r3, r, 0, 0) )
+		return;
+
+	divisor.Set(b);
+	q = a;
+	q.Div(divisor, r);
+
+	if( !check_result_carry(q3, q, 0, 0) || !check_result_carry(r3, r, 0, 0) )
+		return;
+
+	temp = q;
+	int c = temp.Mul(b);
+	c += temp.Add(r);
+
+	if( !check_result_carry(a, temp, 0, c) )
+		return;
+
+	if( r >= b )
+	{
+		std::cerr << "the remainder is not smaller than the divisor" << std::endl;
+		return;
+	}
+
+	std::cerr << "ok" << std::endl;
+}
+
+
+/*
+	the division and the remainder of Big<1, newton_division_size/2>
+
+	the mantissas are divided as UInt<newton_division_size> (the Newton's division
+	is used), the results with BigDivisor should be the same as with Big
+*/
+void UIntTest::test_bigdivnewton()
+{
+	Big<1, newton_division_size/2> a, b, q, q2, r, r2;
+	uuint seed;
+
+	read_uint(seed);
+
+	std::cerr << '[' << row << "] BigDivNewton<1, " << newton_division_size/2 << ">: ";
+
+	if( !check_end() )
+		return;
+
+	a.SetOne();
+	b.SetOne();
+	fill_uint(a.mantissa, newton_division_size/2, seed);
+	fill_uint(b.mantissa, newton_division_size/2, seed);
+	a.mantissa.table[newton_division_size/2 - 1] |= TTMATH_UINT_HIGHEST_BIT;
+	b.mantissa.table[newton_division_size/2 - 1] |= TTMATH_UINT_HIGHEST_BIT;
+	b.exponent = -sint((newton_division_size/2) * TTMATH_BITS_PER_UINT) - 5;
+
+	BigDivisor<1, newton_division_size/2> divisor(b);
+	const RoundingMode mode[] = { round_truncate, round_nearest_even, round_up, round_down };
+
+	for(size_t i=0 ; i<sizeof(mode)/sizeof(RoundingMode) ; ++i)
+	{
+		q = a;
+		q2 = a;
+
+		if( q.Div(b, mode[i]) != 0 || q2.Div(divisor, mode[i]) != 0 || q != q2 )
+		{
+			std::cerr << "Incorrect quotient (rounding mode: " << int(mode[i]) << ")" << std::endl;
+			return;
+		}
+	}
+
+	r = a;
+	r2 = a;
+
+	if( r.Mod(b) != 0 || r2.Mod(divisor) != 0 || r != r2 )
+	{
+		std::cerr << "Incorrect remainder" << std::endl;
+		return;
+	}
+
+	std::cerr << "ok" << std::endl;
+}
+
+
+template<uuint type_size>
+void UIntTest::test_powmod()
+{
+	UInt<type_size> x, pow, modulus, result, new_result;
+	UIntMontgomery<type_size> mont;
+
+	if( !check_minmax_bits(type_size) )
+		return;
+
+	read_uint(x);
+	read_uint(pow);
+	read_uint(modulus);
+	read_uint(result);
+
+	uuint carry;
+	read_uint(carry);
+
+	std::cerr << '[' << row << "] PowMod<" << type_size << ">: ";
+
+	if( !check_end() )
+		return;
+
+	int new_carry = mont.Set(modulus);
+
+	if( new_carry == 0 )
+		new_carry = mont.PowMod(x, pow, new_result);
+
+	if( check_result_or_carry(result, new_result, carry, new_carry) )
+		std::cerr << "ok" << std::endl;
+}
+
+
+template<uuint type_size>
+void UIntTest::test_mulmod()
+{
+	UInt<type_size> a, b, modulus, mul, add, sqr, a2, b2, new_result;
+	UIntMontgomery<type_size> mont;
+
+	if( !check_minmax_bits(type_size) )
+		return;
+
+	read_uint(a);
+	read_uint(b);
+	read_uint(modulus);
+	read_uint(mul);
+	read_uint(add);
+	read_uint(sqr);
+
+	uuint carry;
+	read_uint(carry);
+
+	std::cerr << '[' << row << "] MulMod<" << type_size << ">: ";
+
+	if( !check_end() )
+		return;
+
+	a2.SetZero();
+	b2.SetZero();
+	new_result.SetZero();
+	int new_carry = mont.Set(modulus);
+
+	if( new_carry )
+	{
+		if( check_result_or_carry(mul, new_result, carry, new_carry) )
+			std::cerr << "ok" << std::endl;
+
+		return;
+	}
+
+	mont.ToMontgomery(a, a2);
+	mont.ToMontgomery(b, b2);
+
+	mont.MulMod(a2, b2, new_result);
+	mont.FromMontgomery(new_result, new_result);
+
+	if( !check_result_carry(mul, new_result, carry, new_carry) )
+		return;
+
+	mont.SqrMod(a2, new_result);
+	mont.FromMontgomery(new_result, new_result);
+
+	if( !check_result_carry(sqr, new_result, carry, new_carry) )
+		return;
+
+	// a*a by MulMod() (the same object is passed twice)
+	mont.MulMod(a2, a2, new_result);
+	mont.FromMontgomery(new_result, new_result);
+
+	if( !check_result_carry(sqr, new_result, carry, new_carry) )
+		return;
+
+	mont.AddMod(a, b, new_result);
+
+	if( check_result_carry(add, new_result, carry, new_carry) )
+		std::cerr << "ok" << std::endl;
+}
+
+
+/*
+	PowMod() with UInt<montgomery_big_size> (the multiplication is made by MulBig())
+
+	the result is compared with the binary exponentiation where each product
+	is calculated by MulBig() and reduced by Div()
+*/
+void UIntTest::test_powmodbig()
+{
+	UInt<montgomery_big_size> x, x_mod, modulus, result, new_result;
+	UInt<montgomery_big_size*2> product, remainder, modulus2;
+	UInt<2> pow;
+	UIntMontgomery<montgomery_big_size> mont;
+	uuint words, seed;
+
+	read_uint(words);
+	read_uint(seed);
+
+	std::cerr << '[' << row << "] PowModBig<" << montgomery_big_size << ">: ";
+
+	if( !check_end() )
+		return;
+
+	fill_uint(modulus, words, seed);
+	fill_uint(x, montgomery_big_size, seed);
+	fill_uint(pow, 2, seed);
+	modulus.table[0] |= 1;
+
+	if( mont.Set(modulus) != 0 || mont.PowMod(x, pow, new_result) != 0 )
+	{
+		std::cerr << "the context is not prepared" << std::endl;
+		return;
+	}
+
+	modulus2 = modulus;
+	product  = x;
+	product.Div(modulus2, remainder);
+	x_mod    = remainder;
+	result   = 1;
+
+	for(uuint i=2*TTMATH_BITS_PER_UINT ; i-- > 0 ; )
+	{
+		result.MulBig(result, product);
+		product.Div(modulus2, remainder);
+		result = remainder;
+
+		if( pow.GetBit(i) )
+		{
+			result.MulBig(x_mod, product);
+			product.Div(modulus2, remainder);
+			result = remainder;
+		}
+	}
+
+	if( check_result_carry(result, new_result, 0, 0) )
+		std::cerr << "ok" << std::endl;
+}
+
+
+void UIntTest::test_dynadd()
+{
+	DynInt a, b, sum, difference, result;
+
+	read_dynint(a);
+	read_dynint(b);
+	read_dynint(sum);
+	read_dynint(difference);
+
+	std::cerr << '[' << row << "] DynInt::Add: ";
+
+	if( !check_end() )
+		return;
+
+	result = a;
+	result.Add(b);
+
+	if( !check_dynint(sum, result, "sum") || !check_dynint(sum, b + a, "sum") )
+		return;
+
+	result = a;
+	result.Sub(b);
+
+	if( !check_dynint(difference, result, "difference") || !check_dynint(-difference, b - a, "difference") )
+		return;
+
+	std::cerr << "ok" << std::endl;
+}
+
+
+void UIntTest::test_dynmul()
+{
+	DynInt a, b, product, result;
+
+	read_dynint(a);
+	read_dynint(b);
+	read_dynint(product);
+
+	std::cerr << '[' << row << "] DynInt::Mul: ";
+
+	if( !check_end() )
+		return;
+
+	result = a;
+	result.Mul(b);
+
+	if( check_dynint(product, result, "product") && check_dynint(product, b * a, "product") )
+		std::cerr << "ok" << std::endl;
+}
+
+
+void UIntTest::test_dyndiv()
+{
+	DynInt a, b, quotient, remainder, result, rest;
+	uuint carry;
+
+	read_dynint(a);
+	read_dynint(b);
+	read_dynint(quotient);
+	read_dynint(remainder);
+	read_uint(carry);
+
+	std::cerr << '[' << row << "] DynInt::Div: ";
+
+	if( !check_end() )
+		return;
+
+	result = a;
+	uuint new_carry = result.Div(b, rest);
+
+	if( new_carry != carry )
+	{
+		std::cerr << "Incorrect carry: " << new_carry << " (expected: " << carry << ")" << std::endl;
+		return;
+	}
+
+	if( carry == 0 )
+	{
+		if( !check_dynint(quotient, result, "quotient") || !check_dynint(remainder, rest, "remainder") ||
+			!check_dynint(quotient, a / b, "quotient") || !check_dynint(remainder, a % b, "remainder") )
+			return;
+	}
+
+	std::cerr << "ok" << std::endl;
+}
+
+
+void UIntTest::test_dynshift()
+{
+	DynInt a, left, right, result;
+	uuint bits;
+
+	read_dynint(a);
+	read_uint(bits);
+	read_dynint(left);
+	read_dynint(right);
+
+	std::cerr << '[' << row << "] DynInt::Shift: ";
+
+	if( !check_end() )
+		return;
+
+	result = a;
+	result.ShiftLeft(bits);
+
+	if( !check_dynint(left, result, "ShiftLeft") )
+		return;
+
+	result = a;
+	result.ShiftRight(bits);
+
+	if( check_dynint(right, result, "ShiftRight") )
+		std::cerr << "ok" << std::endl;
+}
+
+
+void UIntTest::test_dynstring()
+{
+	DynInt a, result;
+	uuint base;
+	std::string str, new_str;
+
+	read_uint(base);
+	read_dynint(a);
+	skip_white_characters();
+
+	while( *pline && !is_white(*pline) && *pline != '#' )
+		str += *pline++;
+
+	std::cerr << '[' << row << "] DynInt::ToString: ";
+
+	if( !check_end() )
+		return;
+
+	a.ToString(new_str, base);
+
+	if( new_str != str )
+	{
+		std::cerr << "Incorrect string: " << new_str << " (expected: " << str << ")" << std::endl;
+		return;
+	}
+
+	result.FromString(str, base);
+
+	if( check_dynint(a, result, "FromString") )
+		std::cerr << "ok" << std::endl;
+}
+
+
+template<uuint type_size>
+void UIntTest::test_dynconv()
+{
+	DynInt a, result;
+	UInt<type_size> u;
+	Int<type_size> i;
+	uuint uint_carry, int_carry, new_carry;
+
+	if( !check_minmax_bits(type_size) )
+		return;
+
+	read_dynint(a);
+	read_uint(uint_carry);
+	read_uint(int_carry);
+
+	std::cerr << '[' << row << "] DynInt::ToUInt<" << type_size << ">: ";
+
+	if( !check_end() )
+		return;
+
+	new_carry = a.ToUInt(u);
+
+	if( new_carry != uint_carry )
+	{
+		std::cerr << "Incorrect carry from ToUInt(): " << new_carry << " (expected: " << uint_carry << ")" << std::endl;
+		return;
+	}
+
+	if( new_carry == 0 && !check_dynint(a, DynInt(u), "FromUInt") )
+		return;
+
+	new_carry = a.ToInt(i);
+
+	if( new_carry != int_carry )
+	{
+		std::cerr << "Incorrect carry from ToInt(): " << new_carry << " (expected: " << int_carry << ")" << std::endl;
+		return;
+	}
+
+	if( new_carry == 0 && !check_dynint(a, DynInt(i), "FromInt") )
+		return;
+
+	if( type_size == 1 )
+	{
+		// the same with uint and sint
+		uuint ui;
+		sint si;
+
+		if( a.ToUInt(ui) != uint_carry || (uint_carry == 0 && !check_dynint(a, DynInt(ui), "FromUInt(uint)")) )
+		{
+			std::cerr << " (uint)" << std::endl;
+			return;
+		}
+
+		if( a.ToInt(si) != int_carry || (int_carry == 0 && !check_dynint(a, DynInt(si), "FromInt(sint)")) )
+		{
+			std::cerr << " (sint)" << std::endl;
+			return;
+		}
+	}
+
+	std::cerr << "ok" << std::endl;
+}
+
+
+/*
+	the arguments of Add(), Sub(), Mul() and Div() are the same objects
+	as 'this' (or the remainder is the divisor)
+*/
+void UIntTest::test_dynalias()
+{
+	DynInt a, b, x, y, expected, expected_rest;
+
+	read_dynint(a);
+	read_dynint(b);
+
+	std::cerr << '[' << row << "] DynInt aliasing: ";
+
+	if( !check_end() )
+		return;
+
+	x = a;
+	x.Add(x);
+	expected = a;
+	expected.MulInt(2);
+
+	if( !check_dynint(expected, x, "x.Add(x)") )
+		return;
+
+	x = a;
+	x.Sub(x);
+
+	if( !check_dynint(DynInt(0), x, "x.Sub(x)") )
+		return;
+
+	x = a;
+	x.Mul(x);
+	expected = a;
+	expected.Mul(DynInt(a));
+
+	if( !check_dynint(expected, x, "x.Mul(x)") )
+		return;
+
+	if( !a.IsZero() )
+	{
+		x = a;
+		x.Div(x);
+
+		if( !check_dynint(DynInt(1), x, "x.Div(x)") )
+			return;
+	}
+
+	if( !b.IsZero() )
+	{
+		// the remainder is put into the divisor
+		x = a;
+		y = b;
+		x.Div(y, y);
+
+		expected = a;
+		expected.Div(DynInt(b), expected_rest);
+
+		if( !check_dynint(expected, x, "x.Div(y, y) quotient") || !check_dynint(expected_rest, y, "x.Div(y, y) remainder") )
+			return;
+	}
+
+	std::cerr << "ok" << std::endl;
+}
+
+
+/*
+	DynInt compared with UInt<dynint_random_size>
+
+	a and b are pseudorandom values with words_a and words_b words
+	(the Karatsuba multiplication and the division of long values are used)
+*/
+void UIntTest::test_dynrandom()
+{
+	UInt<dynint_random_size> a, b, q, r;
+	UInt<dynint_random_size*2> product, shifted;
+	DynInt x, y, result, rest;
+	uuint words_a, words_b, seed, bits;
+	std::string str;
+
+	read_uint(words_a);
+	read_uint(words_b);
+	read_uint(seed);
+
+	std::cerr << '[' << row << "] DynInt random<" << dynint_random_size << ">: ";
+
+	if( !check_end() )
+		return;
+
+	fill_uint(a, words_a, seed);
+	fill_uint(b, words_b, seed);
+
+	if( b.IsZero() )
+		b = 1;
+
+	x = a;
+	y = b;
+
+	a.MulBig(b, product);
+	result = x;
+	result.Mul(y);
+
+	if( !check_dynint(DynInt(product), result, "product") )
+		return;
+
+	result = -x;
+	result.Mul(y);
+
+	if( !check_dynint(-DynInt(product), result, "product") )
+		return;
+
+	b.SqrBig(product);
+	result = y;
+	result.Mul(result);
+
+	if( !check_dynint(DynInt(product), result, "square") )
+		return;
+
+	q = a;
+	q.Div(b, r);
+	result = x;
+	result.Div(y, rest);
+
+	if( !check_dynint(DynInt(q), result, "quotient") || !check_dynint(DynInt(r), rest, "remainder") )
+		return;
+
+	result = -x;
+	result.Div(y, rest);
+
+	if( !check_dynint(-DynInt(q), result, "quotient") || !check_dynint(-DynInt(r), rest, "remainder") )
+		return;
+
+	bits    = words_a * 7 + words_b;
+	shifted = a;
+	shifted.Rcl(bits);
+	result  = x;
+	result.ShiftLeft(bits);
+
+	if( !check_dynint(DynInt(shifted), result, "ShiftLeft") )
+		return;
+
+	result.ShiftRight(bits);
+
+	if( !check_dynint(x, result, "ShiftRight") )
+		return;
+
+	a.ToString(str, 16);
+
+	if( x.ToString(16) != str )
+	{
+		std::cerr << "Incorrect string: " << x.ToString(16) << " (expected: " << str << ")" << std::endl;
+		return;
+	}
+
+	result.FromString(str, 16);
+
+	if( !check_dynint(x, result, "FromString") )
+		return;
+
+	if( x.ToUInt(q) != 0 || q != a )
+	{
+		std::cerr << "Incorrect ToUInt()" << std::endl;
+		return;
+	}
+
+	std::cerr << "ok" << std::endl;
+}
+
+
+void UIntTest::read_word(std::string & result)
+{
+	result.clear();
+	skip_white_characters();
+
+	while( *pline && !is_white(*pline) && *pline != '#' )
+		result += *pline++;
+}
+
+
+bool UIntTest::read_rounding(RoundingMode & result)
+{
+std::string mode;
+
+	read_word(mode);
+
+	if( mode == "truncate" )
+		result = round_truncate;
+	else
+	if( mode == "zero" )
+		result = round_toward_zero;
+	else
+	if( mode == "nearest" )
+		result = round_nearest_even;
+	else
+	if( mode == "up" )
+		result = round_up;
+	else
+	if( mode == "down" )
+		result = round_down;
+	else
+	{
+		std::cerr << " incorrect rounding mode: " << mode << std::endl;
+		return false;
+	}
+
+return true;
+}
+
+
+/*
+	it reads a Big value given as two integers: mantissa exponent (value = mantissa * 2^exponent),
+	the mantissa can have a sign and doesn't have to be standardized
+*/
+template<uuint type_size>
+bool UIntTest::read_big(Big<1, type_size> & result)
+{
+UInt<type_size> mantissa;
+Int<1> exponent;
+bool is_sign = false;
+
+	skip_white_characters();
+
+	if( *pline == '-' )
+	{
+		is_sign = true;
+		++pline;
+	}
+
+	if( !read_uint(mantissa) || exponent.FromString(pline, 10, &pline) )
+		return false;
+
+	result.mantissa = mantissa;
+	result.exponent = exponent;
+	result.info     = 0;
+	result.Standardizing();
+
+	if( is_sign )
+		result.SetSign();
+
+return true;
+}
+
+
+/*
+	it reads a Big value (as read_big()) or the word 'nan'
+*/
+template<uuint type_size>
+bool UIntTest::read_big_or_nan(Big<1, type_size> & result, bool & nan)
+{
+	skip_white_characters();
+	nan = (pline[0] == 'n' && pline[1] == 'a' && pline[2] == 'n');
+
+	if( nan )
+	{
+		pline += 3;
+		result.SetNan();
+
+	return true;
+	}
+
+return read_big(result);
+}
+
+
+template<uuint type_size>
+bool UIntTest::check_big(const Big<1, type_size> & result, const Big<1, type_size> & new_result, int new_carry)
+{
+	if( new_carry != 0 )
+	{
+		std::cerr << "Incorrect carry: " << new_carry << " (expected: 0)" << std::endl;
+		return false;
+	}
+
+	if( new_result != result || new_result.IsSign() != result.IsSign() )
+	{
+		std::cerr << "Incorrect result: " << (new_result.IsSign() ? "-" : "") << new_result.mantissa << " " << new_result.exponent
+		          << " (expected: " << (result.IsSign() ? "-" : "") << result.mantissa << " " << result.exponent << ")" << std::endl;
+		return false;
+	}
+
+return true;
+}
+
+
+/*
+	it checks a result with a carry, if 'nan' is true a carry and NaN are expected
+*/
+template<uuint type_size>
+bool UIntTest::check_big_carry(const Big<1, type_size> & result, bool nan, const Big<1, type_size> & new_result, int new_carry)
+{
+	if( nan )
+	{
+		if( new_carry == 0 || !new_result.IsNan() )
+		{
+			std::cerr << "Expected a carry and NaN (carry: " << new_carry << ")" << std::endl;
+			return false;
+		}
+
+		return true;
+	}
+
+return check_big(result, new_result, new_carry);
+}
+
+
+/*
+	it checks a result of a function: |new_result - result| <= ulps * 2^(result.exponent)
+	(result is standardized so 2^exponent is the unit in the last place), if 'nan' is true
+	the function should return an error and new_result should be NaN
+*/
+template<uuint type_size>
+bool UIntTest::check_big_ulps(const Big<1, type_size> & result, bool nan, const Big<1, type_size> & new_result,
+							  ErrorCode err, uuint ulps)
+{
+	if( nan )
+	{
+		if( err == err_ok || !new_result.IsNan() )
+		{
+			std::cerr << "Expected an error and NaN (error code: " << int(err) << ")" << std::endl;
+			return false;
+		}
+
+		return true;
+	}
+
+	if( err != err_ok )
+	{
+		std::cerr << "Incorrect error code: " << int(err) << " (expected: 0)" << std::endl;
+		return false;
+	}
+
+	Big<1, type_size> diff(new_result), limit;
+
+	limit = ulps;
+	limit.exponent.Add(result.exponent);
+
+	diff.Sub(result);
+	diff.Abs();
+
+	if( (result.IsZero() && !new_result.IsZero()) || diff > limit || (ulps == 0 && new_result.IsSign() != result.IsSign()) )
+	{
+		std::cerr << "Incorrect result: " << (new_result.IsSign() ? "-" : "") << new_result.mantissa << " " << new_result.exponent
+		          << " (expected: " << (result.IsSign() ? "-" : "") << result.mantissa << " " << result.exponent
+		          << ", ulps: " << ulps << ")" << std::endl;
+		return false;
+	}
+
+return true;
+}
+
+
+/*
+	Big<1, type_size>::Add(), Sub(), Mul() and Div() with a rounding mode
+*/
+template<uuint type_size>
+void UIntTest::test_biground()
+{
+	Big<1, type_size> a, b, result, new_result;
+	RoundingMode round;
+	std::string operation;
+	int new_carry;
+
+	if( !check_minmax_bits(type_size) )
+		return;
+
+	read_word(operation);
+
+	if( !read_rounding(round) || !read_big(a) || !read_big(b) || !read_big(result) )
+		return;
+
+	std::cerr << '[' << row << "] BigRound<1, " << type_size << ">: ";
+
+	if( !check_end() )
+		return;
+
+	new_result = a;
+
+	if( operation == "add" )
+		new_carry = new_result.Add(b, round);
+	else
+	if( operation == "sub" )
+		new_carry = new_result.Sub(b, round);
+	else
+	if( operation == "mul" )
+		new_carry = new_result.Mul(b, round);
+	else
+	if( operation == "div" )
+		new_carry = new_result.Div(b, round);
+	else
+	{
+		std::cerr << "incorrect operation: " << operation << std::endl;
+		return;
+	}
+
+	if( !check_big(result, new_result, new_carry) )
+		return;
+
+	if( operation == "mul" && a == b )
+	{
+		// x.Mul(x) - the mantissa is squared by SqrBig()
+		new_result = a;
+		new_carry  = new_result.Mul(new_result, round);
+
+		if( !check_big(result, new_result, new_carry) )
+		{
+			std::cerr << " (x.Mul(x))" << std::endl;
+			return;
+		}
+	}
+
+	std::cerr << "ok" << std::endl;
+}
+
+
+/*
+	Big<1, type_size>::DivInt() and DivUInt() (a non-negative divisor) with the truncated
+	quotient, Div() with round_truncate should give the same result,
+	'nan' means that a carry and NaN are expected (division by zero)
+*/
+template<uuint type_size>
+void UIntTest::test_bigdivuint()
+{
+	Big<1, type_size> a, result, new_result, divisor;
+	Int<1> b;
+	bool nan;
+
+	if( !check_minmax_bits(type_size) )
+		return;
+
+	if( !read_big(a) || !read_int(b) || !read_big_or_nan(result, nan) )
+		return;
+
+	std::cerr << '[' << row << "] BigDivUInt<1, " << type_size << ">: ";
+
+	if( !check_end() )
+		return;
+
+	sint ss2 = b.ToInt();
+
+	new_result = a;
+	int new_carry = new_result.DivInt(ss2);
+
+	if( !check_big_carry(result, nan, new_result, new_carry) )
+	{
+		std::cerr << " (DivInt)" << std::endl;
+		return;
+	}
+
+	if( ss2 >= 0 )
+	{
+		new_result = a;
+		new_carry  = new_result.DivUInt(uuint(ss2));
+
+		if( !check_big_carry(result, nan, new_result, new_carry) )
+		{
+			std::cerr << " (DivUInt)" << std::endl;
+			return;
+		}
+	}
+
+	divisor    = ss2;
+	new_result = a;
+	new_carry  = new_result.Div(divisor, round_truncate);
+
+	if( !check_big_carry(result, nan, new_result, new_carry) )
+	{
+		std::cerr << " (Div)" << std::endl;
+		return;
+	}
+
+	std::cerr << "ok" << std::endl;
+}
+
+
+/*
+	Big<1, type_size>::MulAdd(), MulSub() and Dot() (the result is rounded only once)
+
+	muladd and mulsub: r a b result (r can be 'nan'), if a and b are equal
+	the same object is passed as both arguments too,
+	dot: a0 b0 a1 b1 result (the result is calculated into a0 as well),
+	'nan' means that a carry and NaN are expected
+*/
+template<uuint type_size>
+void UIntTest::test_bigmuladd()
+{
+	Big<1, type_size> r, a[2], b[2], result, new_result;
+	std::string operation;
+	bool r_nan = false, nan;
+	int new_carry;
+
+	if( !check_minmax_bits(type_size) )
+		return;
+
+	read_word(operation);
+
+	if( operation == "dot" )
+	{
+		if( !read_big(a[0]) || !read_big(b[0]) || !read_big(a[1]) || !read_big(b[1]) )
+			return;
+	}
+	else
+	{
+		if( !read_big_or_nan(r, r_nan) || !read_big(a[0]) || !read_big(b[0]) )
+			return;
+
+		if( r_nan )
+			r.SetNan();
+	}
+
+	if( !read_big_or_nan(result, nan) )
+		return;
+
+	std::cerr << '[' << row << "] BigMulAdd<1, " << type_size << ">: ";
+
+	if( !check_end() )
+		return;
+
+	if( operation == "muladd" || operation == "mulsub" )
+	{
+		new_result = r;
+		new_carry  = (operation == "muladd") ? new_result.MulAdd(a[0], b[0]) : new_result.MulSub(a[0], b[0]);
+
+		if( !check_big_carry(result, nan, new_result, new_carry) )
+			return;
+
+		if( a[0] == b[0] )
+		{
+			// the mantissa is squared by SqrBig()
+			new_result = r;
+			new_carry  = (operation == "muladd") ? new_result.MulAdd(a[0], a[0]) : new_result.MulSub(a[0], a[0]);
+
+			if( !check_big_carry(result, nan, new_result, new_carry) )
+			{
+				std::cerr << " (the same argument)" << std::endl;
+				return;
+			}
+		}
+	}
+	else
+	if( operation == "dot" )
+	{
+		new_carry = new_result.Dot(a, b, 2);
+
+		if( !check_big_carry(result, nan, new_result, new_carry) )
+			return;
+
+		// 'this' is the first element of a table
+		new_carry = a[0].Dot(a, b, 2);
+
+		if( !check_big_carry(result, nan, a[0], new_carry) )
+		{
+			std::cerr << " (the result is a[0])" << std::endl;
+			return;
+		}
+	}
+	else
+	{
+		std::cerr << "incorrect operation: " << operation << std::endl;
+		return;
+	}
+
+	std::cerr << "ok" << std::endl;
+}
+
+
+/*
+	Big<1, type_size>::Sqrt() with a rounding mode, the result is the exact root rounded
+	to the mantissa ('nan' means that a carry and NaN are expected), with 'nearest'
+	the function Sqrt() from ttmath.h is checked too (the root is correctly rounded)
+*/
+template<uuint type_size>
+void UIntTest::test_bigsqrt()
+{
+	Big<1, type_size> a, result, new_result;
+	RoundingMode round;
+	bool nan;
+
+	if( !check_minmax_bits(type_size) )
+		return;
+
+	if( !read_rounding(round) || !read_big(a) || !read_big_or_nan(result, nan) )
+		return;
+
+	std::cerr << '[' << row << "] BigSqrt<1, " << type_size << ">: ";
+
+	if( !check_end() )
+		return;
+
+	new_result = a;
+	int new_carry = new_result.Sqrt(round);
+
+	if( !check_big_carry(result, nan, new_result, new_carry) )
+		return;
+
+	if( round == round_nearest_even )
+	{
+		ErrorCode err = Sqrt(a, new_result);
+
+		if( !check_big_ulps(result, nan, new_result, err, 0) )
+		{
+			std::cerr << " (Sqrt() from ttmath.h)" << std::endl;
+			return;
+		}
+	}
+
+	std::cerr << "ok" << std::endl;
+}
+
+
+/*
+	Root() with an integer index and Big<1, type_size> (the Newton's method
+	up to TTMATH_ROOT_NEWTON_MAX_INDEX, Big::Sqrt() for the index 2),
+	the result can differ from the exact value rounded to nearest by 'ulps'
+	units in the last place, 'nan' means that an error and NaN are expected
+*/
+template<uuint type_size>
+void UIntTest::test_bigroot()
+{
+	Big<1, type_size> a, index, result, new_result;
+	bool nan;
+	uuint ulps, n;
+
+	if( !check_minmax_bits(type_size) )
+		return;
+
+	read_uint(n);
+	read_uint(ulps);
+
+	if( !read_big(a) || !read_big_or_nan(result, nan) )
+		return;
+
+	std::cerr << '[' << row << "] BigRoot<1, " << type_size << ">: ";
+
+	if( !check_end() )
+		return;
+
+	ErrorCode err = err_ok;
+	index         = n;
+	new_result    = Root(a, index, &err);
+
+	if( check_big_ulps(result, nan, new_result, err, ulps) )
+		std::cerr << "ok" << std::endl;
+}
+
+
+/*
+	Big<1, type_size>::FromString() with a rounding mode (decimal strings)
+*/
+template<uuint type_size>
+void UIntTest::test_bigfromstring()
+{
+	Big<1, type_size> result, new_result;
+	RoundingMode round;
+	std::string str;
+
+	if( !check_minmax_bits(type_size) )
+		return;
+
+	if( !read_rounding(round) )
+		return;
+
+	read_word(str);
+
+	if( !read_big(result) )
+		return;
+
+	std::cerr << '[' << row << "] BigFromString<1, " << type_size << ">: ";
+
+	if( !check_end() )
+		return;
+
+	int new_carry = new_result.FromString(str, round);
+
+	if( check_big(result, new_result, new_carry) )
+		std::cerr << "ok" << std::endl;
+}
+
+
+/*
+	Interval<1, type_size>::FromString(), the lower bound is the value of the string
+	rounded down and the upper bound is rounded up (the string is inside the interval)
+*/
+template<uuint type_size>
+void UIntTest::test_intervalfromstring()
+{
+	Interval<1, type_size> result;
+	Big<1, type_size> lower, upper;
+	std::string str;
+
+	if( !check_minmax_bits(type_size) )
+		return;
+
+	read_word(str);
+
+	if( !read_big(lower) || !read_big(upper) )
+		return;
+
+	std::cerr << '[' << row << "] IntervalFromString<1, " << type_size << ">: ";
+
+	if( !check_end() )
+		return;
+
+	int new_carry = result.FromString(str);
+
+	if( check_big(lower, result.lower, new_carry) && check_big(upper, result.upper, new_carry) )
+		std::cerr << "ok" << std::endl;
+}
+
+
+/*
+	it checks one bound of an interval: the bound cannot be inside the exact range
+	(lower <= result for the lower bound and upper >= result for the upper one,
+	'result' is the exact bound rounded outward) and it can be further than 'result'
+	by 'ulps' units in the last place
+*/
+template<uuint type_size>
+bool UIntTest::check_interval_bound(const Big<1, type_size> & result, const Big<1, type_size> & new_result,
+									bool upper, uuint ulps)
+{
+	Big<1, type_size> diff(new_result), limit;
+
+	limit = ulps;
+	limit.exponent.Add(result.exponent);
+
+	diff.Sub(result);
+
+	if( !upper )
+		diff.ChangeSign();
+
+	if( new_result.IsNan() || diff.IsSign() || (result.IsZero() && !new_result.IsZero()) || diff > limit )
+	{
+		std::cerr << "Incorrect " << (upper ? "upper" : "lower") << " bound: "
+		          << (new_result.IsSign() ? "-" : "") << new_result.mantissa << " " << new_result.exponent
+		          << " (expected: " << (result.IsSign() ? "-" : "") << result.mantissa << " " << result.exponent
+		          << ", ulps: " << ulps << ")" << std::endl;
+		return false;
+	}
+
+return true;
+}
+
+
+/*
+	the arithmetic and the mathematical functions with Interval<1, type_size>,
+	the exact range of the function on the interval (or intervals) has to be
+	inside the result and the result can be wider by 'ulps' units in the last place,
+	'nan' means that an error (or a carry) and NaN are expected
+*/
+template<uuint type_size>
+void UIntTest::test_interval()
+{
+	Interval<1, type_size> a, b, new_result;
+	Big<1, type_size> lower, upper;
+	std::string function;
+	bool nan, failed;
+	uuint ulps;
+
+	if( !check_minmax_bits(type_size) )
+		return;
+
+	read_word(function);
+	read_uint(ulps);
+
+	bool two_arguments = (function == "add" || function == "sub" || function == "mul" ||
+						  function == "div" || function == "pow");
+
+	if( !read_big(a.lower) || !read_big(a.upper) || (two_arguments && (!read_big(b.lower) || !read_big(b.upper))) )
+		return;
+
+	if( !read_big_or_nan(lower, nan) || (!nan && !read_big(upper)) )
+		return;
+
+	std::cerr << '[' << row << "] Interval<1, " << type_size << ">: ";
+
+	if( !check_end() )
+		return;
+
+	new_result = a;
+
+	if( function == "add" )
+		failed = new_result.Add(b) != 0;
+	else
+	if( function == "sub" )
+		failed = new_result.Sub(b) != 0;
+	else
+	if( function == "mul" )
+		failed = new_result.Mul(b) != 0;
+	else
+	if( function == "div" )
+		failed = new_result.Div(b) != 0;
+	else
+	if( function == "pow" )
+		failed = Pow(a, b, new_result) != err_ok;
+	else
+	if( function == "exp" )
+		failed = Exp(a, new_result) != err_ok;
+	else
+	if( function == "ln" )
+		failed = Ln(a, new_result) != err_ok;
+	else
+	if( function == "sqrt" )
+		failed = Sqrt(a, new_result) != err_ok;
+	else
+	if( function == "sin" )
+		failed = Sin(a, new_result) != err_ok;
+	else
+	if( function == "cos" )
+		failed = Cos(a, new_result) != err_ok;
+	else
+	{
+		std::cerr << "incorrect function: " << function << std::endl;
+		return;
+	}
+
+	if( nan )
+	{
+		if( !failed || !new_result.IsNan() )
+			std::cerr << "Expected an error and NaN" << std::endl;
+		else
+			std::cerr << "ok" << std::endl;
+
+		return;
+	}
+
+	if( failed )
+	{
+		std::cerr << "Unexpected error" << std::endl;
+		return;
+	}
+
+	if( check_interval_bound(lower, new_result.lower, false, ulps) &&
+		check_interval_bound(upper, new_result.upper, true, ulps) )
+		std::cerr << "ok" << std::endl;
+}
+
+
+/*
+	mathematical functions with Big<1, type_size> (the result can differ
+	from the exact value rounded to the mantissa by 'ulps' units in the last place),
+	the argument is the same object as the result, 'nan' means that an error is expected
+*/
+template<uuint type_size>
+void UIntTest::test_bigfunction()
+{
+	Big<1, type_size> a, result, result2, new_result, new_result2;
+	std::string function;
+	bool nan, nan2 = false;
+	ErrorCode err;
+	uuint ulps;
+
+	if( !check_minmax_bits(type_size) )
+		return;
+
+	read_word(function);
+	read_uint(ulps);
+
+	bool two_results = (function == "sincos" || function == "sinhcosh");
+
+	if( !read_big(a) || !read_big_or_nan(result, nan) || (two_results && !read_big_or_nan(result2, nan2)) )
+		return;
+
+	std::cerr << '[' << row << "] BigFunction<1, " << type_size << ">: ";
+
+	if( !check_end() )
+		return;
+
+	new_result = a;
+
+	if( function == "sin" )
+		err = Sin(new_result, new_result);
+	else
+	if( function == "cos" )
+		err = Cos(new_result, new_result);
+	else
+	if( function == "sincos" )
+		err = SinCos(new_result, new_result, new_result2);
+	else
+	if( function == "tan" )
+		err = Tan(new_result, new_result);
+	else
+	if( function == "cot" )
+		err = Cot(new_result, new_result);
+	else
+	if( function == "sinh" )
+		err = Sinh(new_result, new_result);
+	else
+	if( function == "cosh" )
+		err = Cosh(new_result, new_result);
+	else
+	if( function == "sinhcosh" )
+		err = SinhCosh(new_result, new_result, new_result2);
+	else
+	if( function == "tanh" )
+		err = Tanh(new_result, new_result);
+	else
+	if( function == "coth" )
+		err = Coth(new_result, new_result);
+	else
+	if( function == "asin" )
+		err = ASin(new_result, new_result);
+	else
+	if( function == "acos" )
+		err = ACos(new_result, new_result);
+	else
+	if( function == "atan" )
+		err = ATan(new_result, new_result);
+	else
+	if( function == "ln" )
+		err = Ln(new_result, new_result);
+	else
+	if( function == "exp" )
+		err = Exp(new_result, new_result);
+	else
+	{
+		std::cerr << "incorrect function: " << function << std::endl;
+		return;
+	}
+
+	if( check_big_ulps(result, nan, new_result, err, ulps) &&
+		(!two_results || check_big_ulps(result2, nan2, new_result2, err, ulps)) )
+		std::cerr << "ok" << std::endl;
+}
+
+
+/*
+	it sets 'result' to a constant given by its name
+	(pi, e, ln2, ln10, sqrt2, euler and catalan)
+*/
+template<uuint type_size>
+bool UIntTest::set_constant(const std::string & name, Big<1, type_size> & result)
+{
+	if( name == "pi" )
+		result.SetPi();
+	else
+	if( name == "e" )
+		result.SetE();
+	else
+	if( name == "ln2" )
+		result.SetLn2();
+	else
+	if( name == "ln10" )
+		result.SetLn10();
+	else
+	if( name == "sqrt2" )
+		result.SetSqrt2();
+	else
+	if( name == "euler" )
+		result.SetEulerGamma();
+	else
+	if( name == "catalan" )
+		result.SetCatalan();
+	else
+	{
+		std::cerr << "incorrect constant: " << name << std::endl;
+		return false;
+	}
+
+return true;
+}
+
+
+/*
+	the constants of Big<1, type_size> compared with the exact value rounded to nearest
+	(pi, e, ln(2) and ln(10) are taken from the tables, sqrt(2), the Euler's constant and
+	the Catalan's constant from ConstantsCache), the constant is set twice (the second
+	time it's taken from the cache if TTMATH_MULTITHREADS is defined)
+*/
+template<uuint type_size>
+void UIntTest::test_bigconstant()
+{
+	Big<1, type_size> result, new_result;
+	std::string name;
+	uuint ulps;
+
+	if( !check_minmax_bits(type_size) )
+		return;
+
+	read_word(name);
+	read_uint(ulps);
+
+	if( !read_big(result) )
+		return;
+
+	std::cerr << '[' << row << "] BigConstant<1, " << type_size << ">: ";
+
+	if( !check_end() )
+		return;
+
+	for(int i=0 ; i<2 ; ++i)
+	{
+		if( !set_constant(name, new_result) || !check_big_ulps(result, false, new_result, err_ok, ulps) )
+			return;
+	}
+
+	std::cerr << "ok" << std::endl;
+}
+
+
+/*
+	the constants of Big<1, constants_cache_size> calculated by BinarySplitting (the mantissa
+	is greater than TTMATH_BUILTIN_VARIABLES_SIZE) compared with Big<1, TTMATH_BUILTIN_VARIABLES_SIZE>
+	(the tables for pi, e, ln(2) and ln(10)) on their common words: the bigger value rounded
+	to TTMATH_BUILTIN_VARIABLES_SIZE words can differ by one unit in the last place
+	(the tables are truncated), the constant is set twice as in test_bigconstant()
+*/
+void UIntTest::test_bigconstantbig()
+{
+	Big<1, constants_cache_size> value;
+	Big<1, TTMATH_BUILTIN_VARIABLES_SIZE> table_value, new_result;
+	std::string name;
+
+	read_word(name);
+
+	std::cerr << '[' << row << "] BigConstantBig<1, " << constants_cache_size << ">: ";
+
+	if( !check_end() || !set_constant(name, table_value) )
+		return;
+
+	for(int i=0 ; i<2 ; ++i)
+	{
+		if( !set_constant(name, value) )
+			return;
+
+		if( new_result.FromBig(value, round_nearest_even) ||
+			!check_big_ulps(table_value, false, new_result, err_ok, 1) )
+			return;
+	}
+
+	std::cerr << "ok" << std::endl;
+}
+
+
+/*
+	the functions calculated by AdaptiveCalculate() in 'adaptive' tests
+	(operator() is instantiated for each mantissa):
+		sqrt   - sqrt(n)
+		ln     - ln(n)
+		cancel - (1 + 2^(-n)) - 1, the interval is too wide as long as
+		         1 + 2^(-n) doesn't fit into the mantissa, then it's exact
+*/
+struct AdaptiveFunction
+{
+	std::string name;
+	sint n;
+
+	template<uuint exp, uuint man>
+	ErrorCode operator()(Interval<exp, man> & result) const
+	{
+	Big<exp, man> value;
+
+		if( name == "cancel" )
+		{
+			Interval<exp, man> one;
+
+			value.SetOne();
+			one = value;
+			value.exponent.SubInt(uuint(n));
+			result = value;
+
+			if( result.Add(one) || result.Sub(one) )
+				return err_overflow;
+
+		return err_ok;
+		}
+
+		value = n;
+		Interval<exp, man> x(value);
+
+		if( name == "ln" )
+			return Ln(x, result);
+
+	return Sqrt(x, result);
+	}
+};
+
+
+/*
+	AdaptiveCalculate<1, 8>() with Big<1, type_size>, the error code and the mantissa
+	of the last calculation (used_man) are checked, the result is checked only for 'ok'
+	(it can differ from the exact value rounded to nearest by 'ulps' units in the last place),
+	with 'argument' the result should be NaN and with 'precision' it should be a value
+*/
+template<uuint type_size>
+void UIntTest::test_adaptive()
+{
+	Big<1, type_size> result, new_result;
+	AdaptiveFunction fun;
+	Int<1> n;
+	std::string error;
+	uuint bits, used_man, new_used_man = 0, ulps = 0;
+	ErrorCode err;
+
+	if( !check_minmax_bits(type_size) )
+		return;
+
+	read_word(fun.name);
+
+	if( !read_int(n) )
+		return;
+
+	read_uint(bits);
+	read_word(error);
+	read_uint(used_man);
+
+	if( error == "ok" )
+	{
+		err = err_ok;
+		read_uint(ulps);
+
+		if( !read_big(result) )
+			return;
+	}
+	else
+	if( error == "precision" )
+		err = err_precision_not_reached;
+	else
+	if( error == "argument" )
+		err = err_improper_argument;
+	else
+	{
+		std::cerr << " incorrect error code: " << error << std::endl;
+		return;
+	}
+
+	std::cerr << '[' << row << "] Adaptive<1, " << type_size << ">: ";
+
+	if( !check_end() )
+		return;
+
+	if( fun.name != "sqrt" && fun.name != "ln" && fun.name != "cancel" )
+	{
+		std::cerr << "incorrect function: " << fun.name << std::endl;
+		return;
+	}
+
+	fun.n = n.ToInt();
+	ErrorCode new_err = AdaptiveCalculate<1, 8>(fun, new_result, bits, &new_used_man);
+
+	if( new_err != err )
+	{
+		std::cerr << "Incorrect error code: " << int(new_err) << " (expected: " << int(err) << ")" << std::endl;
+		return;
+	}
+
+	if( new_used_man != used_man )
+	{
+		std::cerr << "Incorrect used_man: " << new_used_man << " (expected: " << used_man << ")" << std::endl;
+		return;
+	}
+
+	if( err == err_ok )
+	{
+		if( !check_big_ulps(result, false, new_result, err, ulps) )
+			return;
+	}
+	else
+	if( new_result.IsNan() != (err == err_improper_argument) )
+	{
+		std::cerr << "Incorrect result: " << (new_result.IsNan() ? "NaN" : "a value") << std::endl;
+		return;
+	}
+
+	std::cerr << "ok" << std::endl;
+}
+
+
+int UIntTest::upper_char(int c)
+{
+	if( c>='a' && c<='z' )
+		return c - 'a' + 'A';
+
+return c;
+}
+
+
+bool UIntTest::is_white(int c)
+{
+	if( c==' ' || c=='\t' || c==13 )
+		return true;
+
+return false;
+}
+
+
+void UIntTest::skip_white_characters()
+{
+	while( is_white(*pline) )
+		++pline;
+}
+
+
+
+bool UIntTest::read_method()
+{
+	skip_white_characters();
+	
+	if( *pline == '#' )
+		return false;
+	
+	method.clear();
+
+	for(int c = upper_char(*pline) ; c>='A'&& c<='Z' ; c = upper_char(*pline) )
+	{
+		method += c;
+		++pline;
+	}
+
+	if( method.empty() )
+	{
+		skip_white_characters();
+		if( *pline == 0 )
+			return false;
+		else
+		{	
+			std::cerr << '[' << row << "] ";
+			std::cerr << "syntax error" << std::endl;
+			return false;
+		}
+	}
+
+
+return true;
+}
+
+
+
+void UIntTest::test_method()
+{
+const char * p = pline;
+
+	if( method == "ADD" )
+	{
+		pline = p; test_add<1>();
+		pline = p; test_add<2>();
+		pline = p; test_add<3>();
+		pline = p; test_add<4>();
+		pline = p; test_add<5>();
+		pline = p; test_add<6>();
+		pline = p; test_add<7>();
+		pline = p; test_add<8>();
+		pline = p; test_add<9>();
+	}
+	else
+	if( method == "ADDINT" )
+	{
+		pline = p; test_addint<1>();
+		pline = p; test_addint<2>();
+		pline = p; test_addint<3>();
+		pline = p; test_addint<4>();
+		pline = p; test_addint<5>();
+		pline = p; test_addint<6>();
+		pline = p; test_addint<7>();
+		pline = p; test_addint<8>();
+		pline = p; test_addint<9>();
+	}
+	else
+	if( method == "ADDTWOINTS" )
+	{
+		pline = p; test_addtwoints<1>();
+		pline = p; test_addtwoints<2>();
+		pline = p; test_addtwoints<3>();
+		pline = p; test_addtwoints<4>();
+		pline = p; test_addtwoints<5>();
+		pline = p; test_addtwoints<6>();
+		pline = p; test_addtwoints<7>();
+		pline = p; test_addtwoints<8>();
+		pline = p; test_addtwoints<9>();
+	}
+	else
+	if( method == "PARTIAL" )
+	{
+		pline = p; test_partial<1>();
+		pline = p; test_partial<2>();
+		pline = p; test_partial<3>();
+		pline = p; test_partial<4>();
+		pline = p; test_partial<5>();
+		pline = p; test_partial<6>();
+		pline = p; test_partial<7>();
+		pline = p; test_partial<8>();
+		pline = p; test_partial<9>();
+	}
+	else
+	if( method == "VECTOR" )
+	{
+		pline = p; test_vector<1>();
+		pline = p; test_vector<2>();
+		pline = p; test_vector<3>();
+		pline = p; test_vector<4>();
+		pline = p; test_vector<5>();
+		pline = p; test_vector<6>();
+		pline = p; test_vector<7>();
+		pline = p; test_vector<8>();
+		pline = p; test_vector<9>();
+	}
+	else
+	if( method == "MUL" )
+	{
+		pline = p; test_mul<1>();
+		pline = p; test_mul<2>();
+		pline = p; test_mul<3>();
+		pline = p; test_mul<4>();
+		pline = p; test_mul<5>();
+		pline = p; test_mul<6>();
+		pline = p; test_mul<7>();
+		pline = p; test_mul<8>();
+		pline = p; test_mul<9>();
+	}
+	else
+	if( method == "SQR" )
+	{
+		pline = p; test_sqr<1>();
+		pline = p; test_sqr<2>();
+		pline = p; test_sqr<3>();
+		pline = p; test_sqr<4>();
+		pline = p; test_sqr<5>();
+		pline = p; test_sqr<6>();
+		pline = p; test_sqr<7>();
+		pline = p; test_sqr<8>();
+		pline = p; test_sqr<9>();
+	}
+	else
+	if( method == "MULADD" )
+	{
+		pline = p; test_muladd<1>();
+		pline = p; test_muladd<2>();
+		pline = p; test_muladd<3>();
+		pline = p; test_muladd<4>();
+		pline = p; test_muladd<5>();
+		pline = p; test_muladd<6>();
+		pline = p; test_muladd<7>();
+		pline = p; test_muladd<8>();
+		pline = p; test_muladd<9>();
+	}
+	else
+	if( method == "INTMULADD" )
+	{
+		pline = p; test_intmuladd<1>();
+		pline = p; test_intmuladd<2>();
+		pline = p; test_intmuladd<3>();
+		pline = p; test_intmuladd<4>();
+		pline = p; test_intmuladd<5>();
+		pline = p; test_intmuladd<6>();
+		pline = p; test_intmuladd<7>();
+		pline = p; test_intmuladd<8>();
+		pline = p; test_intmuladd<9>();
+	}
+	else
+	if( method == "SQRT" )
+	{
+		pline = p; test_sqrt<1>();
+		pline = p; test_sqrt<2>();
+		pline = p; test_sqrt<3>();
+		pline = p; test_sqrt<4>();
+		pline = p; test_sqrt<5>();
+		pline = p; test_sqrt<6>();
+		pline = p; test_sqrt<7>();
+		pline = p; test_sqrt<8>();
+		pline = p; test_sqrt<9>();
+	}
+	else
+	if( method == "DIV" )
+	{
+		pline = p; test_div<1>();
+		pline = p; test_div<2>();
+		pline = p; test_div<3>();
+		pline = p; test_div<4>();
+		pline = p; test_div<5>();
+		pline = p; test_div<6>();
+		pline = p; test_div<7>();
+		pline = p; test_div<8>();
+		pline = p; test_div<9>();
+	}
+	else
+	if( method == "MULBIG" )
+	{
+		test_mulbig<toom_multiplication_size>();
+	}
+	else
+	if( method == "MULNTT" )
+	{
+		test_mulbig<ntt_multiplication_size>();
+	}
+	else
+	if( method == "DIVNEWTON" )
+	{
+		test_divnewton();
+	}
+	else
+	if( method == "BIGDIVNEWTON" )
+	{
+		test_bigdivnewton();
+	}
+	else
+	if( method == "POWMOD" )
+	{
+		pline = p; test_powmod<1>();
+		pline = p; test_powmod<2>();
+		pline = p; test_powmod<3>();
+		pline = p; test_powmod<4>();
+		pline = p; test_powmod<5>();
+		pline = p; test_powmod<6>();
+		pline = p; test_powmod<7>();
+		pline = p; test_powmod<8>();
+		pline = p; test_powmod<9>();
+	}
+	else
+	if( method == "MULMOD" )
+	{
+		pline = p; test_mulmod<1>();
+		pline = p; test_mulmod<2>();
+		pline = p; test_mulmod<3>();
+		pline = p; test_mulmod<4>();
+		pline = p; test_mulmod<5>();
+		pline = p; test_mulmod<6>();
+		pline = p; test_mulmod<7>();
+		pline = p; test_mulmod<8>();
+		pline = p; test_mulmod<9>();
+	}
+	else
+	if( method == "POWMODBIG" )
+	{
+		test_powmodbig();
+	}
+	else
+	if( method == "DYNADD" )
+	{
+		test_dynadd();
+	}
+	else
+	if( method == "DYNMUL" )
+	{
+		test_dynmul();
+	}
+	else
+	if( method == "DYNDIV" )
+	{
+		test_dyndiv();
+	}
+	else
+	if( method == "DYNSHIFT" )
+	{
+		test_dynshift();
+	}
+	else
+	if( method == "DYNSTRING" )
+	{
+		test_dynstring();
+	}
+	else
+	if( method == "DYNCONV" )
+	{
+		pline = p; test_dynconv<1>();
+		pline = p; test_dynconv<2>();
+		pline = p; test_dynconv<3>();
+		pline = p; test_dynconv<4>();
+		pline = p; test_dynconv<5>();
+		pline = p; test_dynconv<6>();
+		pline = p; test_dynconv<7>();
+		pline = p; test_dynconv<8>();
+		pline = p; test_dynconv<9>();
+	}
+	else
+	if( method == "DYNALIAS" )
+	{
+		test_dynalias();
+	}
+	else
+	if( method == "DYNRANDOM" )
+	{
+		test_dynrandom();
+	}
+	else
+	if( method == "BIGROUND" )
+	{
+		pline = p; test_biground<1>();
+		pline = p; test_biground<2>();
+		pline = p; test_biground<3>();
+		pline = p; test_biground<4>();
+		pline = p; test_biground<5>();
+		pline = p; test_biground<6>();
+		pline = p; test_biground<7>();
+		pline = p; test_biground<8>();
+		pline = p; test_biground<9>();
+	}
+	else
+	if( method == "BIGDIVUINT" )
+	{
+		pline = p; test_bigdivuint<1>();
+		pline = p; test_bigdivuint<2>();
+		pline = p; test_bigdivuint<3>();
+		pline = p; test_bigdivuint<4>();
+		pline = p; test_bigdivuint<5>();
+		pline = p; test_bigdivuint<6>();
+		pline = p; test_bigdivuint<7>();
+		pline = p; test_bigdivuint<8>();
+		pline = p; test_bigdivuint<9>();
+	}
+	else
+	if( method == "BIGMULADD" )
+	{
+		pline = p; test_bigmuladd<1>();
+		pline = p; test_bigmuladd<2>();
+		pline = p; test_bigmuladd<3>();
+		pline = p; test_bigmuladd<4>();
+		pline = p; test_bigmuladd<5>();
+		pline = p; test_bigmuladd<6>();
+		pline = p; test_bigmuladd<7>();
+		pline = p; test_bigmuladd<8>();
+		pline = p; test_bigmuladd<9>();
+	}
+	else
+	if( method == "BIGSQRT" )
+	{
+		pline = p; test_bigsqrt<1>();
+		pline = p; test_bigsqrt<2>();
+		pline = p; test_bigsqrt<3>();
+		pline = p; test_bigsqrt<4>();
+		pline = p; test_bigsqrt<5>();
+		pline = p; test_bigsqrt<6>();
+		pline = p; test_bigsqrt<7>();
+		pline = p; test_bigsqrt<8>();
+		pline = p; test_bigsqrt<9>();
+	}
+	else
+	if( method == "BIGROOT" )
+	{
+		pline = p; test_bigroot<1>();
+		pline = p; test_bigroot<2>();
+		pline = p; test_bigroot<3>();
+		pline = p; test_bigroot<4>();
+		pline = p; test_bigroot<5>();
+		pline = p; test_bigroot<6>();
+		pline = p; test_bigroot<7>();
+		pline = p; test_bigroot<8>();
+		pline = p; test_bigroot<9>();
+	}
+	else
+	if( method == "BIGFROMSTRING" )
+	{
+		pline = p; test_bigfromstring<1>();
+		pline = p; test_bigfromstring<2>();
+		pline = p; test_bigfromstring<3>();
+		pline = p; test_bigfromstring<4>();
+		pline = p; test_bigfromstring<5>();
+		pline = p; test_bigfromstring<6>();
+		pline = p; test_bigfromstring<7>();
+		pline = p; test_bigfromstring<8>();
+		pline = p; test_bigfromstring<9>();
+	}
+	else
+	if( method == "BIGFUNCTION" )
+	{
+		pline = p; test_bigfunction<1>();
+		pline = p; test_bigfunction<2>();
+		pline = p; test_bigfunction<3>();
+		pline = p; test_bigfunction<4>();
+		pline = p; test_bigfunction<5>();
+		pline = p; test_bigfunction<6>();
+		pline = p; test_bigfunction<7>();
+		pline = p; test_bigfunction<8>();
+		pline = p; test_bigfunction<9>();
+
+		// Ln() uses AGM and Exp() uses the Newton's method for bigger mantissas
+		pline = p; test_bigfunction<TTMATH_USE_AGM_LOGARITHM_FROM_SIZE>();
+		pline = p; test_bigfunction<TTMATH_USE_NEWTON_EXP_FROM_SIZE-1>();
+		pline = p; test_bigfunction<TTMATH_USE_NEWTON_EXP_FROM_SIZE>();
+	}
+	else
+	if( method == "INTERVALFROMSTRING" )
+	{
+		pline = p; test_intervalfromstring<1>();
+		pline = p; test_intervalfromstring<2>();
+		pline = p; test_intervalfromstring<3>();
+		pline = p; test_intervalfromstring<4>();
+		pline = p; test_intervalfromstring<5>();
+		pline = p; test_intervalfromstring<6>();
+		pline = p; test_intervalfromstring<7>();
+		pline = p; test_intervalfromstring<8>();
+		pline = p; test_intervalfromstring<9>();
+	}
+	else
+	if( method == "INTERVAL" )
+	{
+		pline = p; test_interval<1>();
+		pline = p; test_interval<2>();
+		pline = p; test_interval<3>();
+		pline = p; test_interval<4>();
+		pline = p; test_interval<5>();
+		pline = p; test_interval<6>();
+		pline = p; test_interval<7>();
+		pline = p; test_interval<8>();
+		pline = p; test_interval<9>();
+	}
+	else
+	if( method == "BIGCONSTANT" )
+	{
+		pline = p; test_bigconstant<1>();
+		pline = p; test_bigconstant<2>();
+		pline = p; test_bigconstant<3>();
+		pline = p; test_bigconstant<4>();
+		pline = p; test_bigconstant<5>();
+		pline = p; test_bigconstant<6>();
+		pline = p; test_bigconstant<7>();
+		pline = p; test_bigconstant<8>();
+		pline = p; test_bigconstant<9>();
+	}
+	else
+	if( method == "BIGCONSTANTBIG" )
+	{
+		test_bigconstantbig();
+	}
+	else
+	if( method == "ADAPTIVE" )
+	{
+		pline = p; test_adaptive<1>();
+		pline = p; test_adaptive<2>();
+		pline = p; test_adaptive<3>();
+		pline = p; test_adaptive<4>();
 	}
 	else
 	{
@@ -49,6 +49,50 @@ using namespace ttmath;
 typedef ttmath::uint uuint;
 
 
+/*
+	the size of UInt<> used in 'divnewton' tests, UInt::Div() selects the Newton's
+	division (Div4) only if the size is at least TTMATH_USE_NEWTON_DIVISION_FROM_SIZE*2
+*/
+const uuint newton_division_size = TTMATH_USE_NEWTON_DIVISION_FROM_SIZE * 2 + 200;
+
+
+/*
+	the size of UInt<> used in 'powmodbig' tests, UIntMontgomery multiplies
+	by MulBig() and SqrBig() from TTMATH_MONTGOMERY_MULBIG_FROM_SIZE words
+*/
+const uuint montgomery_big_size = TTMATH_MONTGOMERY_MULBIG_FROM_SIZE + 8;
+
+
+/*
+	the size of the mantissa used in 'bigconstantbig' tests, Big takes pi, e, ln(2) and ln(10)
+	from ConstantsCache (BinarySplitting) if the mantissa is greater than TTMATH_BUILTIN_VARIABLES_SIZE
+*/
+const uuint constants_cache_size = TTMATH_BUILTIN_VARIABLES_SIZE + 8;
+
+
+/*
+	the size of UInt<> used in 'dynrandom' tests (the results from DynInt
+	are compared with UInt<>), DynInt multiplies by the Karatsuba algorithm
+	from TTMATH_USE_KARATSUBA_MULTIPLICATION_FROM_SIZE words
+*/
+const uuint dynint_random_size = TTMATH_USE_KARATSUBA_MULTIPLICATION_FROM_SIZE * 3;
+
+
+/*
+	the size of UInt<> used in 'mulbig' tests, UInt::MulFastestBig() and SqrFastestBig()
+	use the Toom-3 multiplication from TTMATH_USE_TOOM3_MULTIPLICATION_FROM_SIZE words
+	and the Toom-4 one from TTMATH_USE_TOOM4_MULTIPLICATION_FROM_SIZE words
+*/
+const uuint toom_multiplication_size = TTMATH_USE_TOOM4_MULTIPLICATION_FROM_SIZE + 20;
+
+
+/*
+	the size of UInt<> used in 'mulntt' tests, UInt::MulFastestBig() and SqrFastestBig()
+	use the number-theoretic transform from TTMATH_USE_NTT_MULTIPLICATION_FROM_SIZE words
+*/
+const uuint ntt_multiplication_size = TTMATH_USE_NTT_MULTIPLICATION_FROM_SIZE + 8;
+
+
 class UIntTest
 {
 
@@ -76,16 +120,86 @@ bool read_uint(uuint & result);
 template<uuint type_size>
 bool read_uint(UInt<type_size> & result);
 
+template<uuint type_size>
+bool read_int(Int<type_size> & result);
+
+bool read_dynint(DynInt & result);
+bool check_dynint(const DynInt & result, const DynInt & new_result, const char * what);
+
 
 	template<uuint type_size> void test_add();
 	template<uuint type_size> void test_addint();
 	template<uuint type_size> void test_addtwoints();
+	template<uuint type_size> void test_partial();
+	template<uuint type_size> void test_vector();
+	template<uuint type_size> void test_mul();
+	template<uuint type_size> void test_sqr();
+	template<uuint type_size> void test_muladd();
+	template<uuint type_size> void test_intmuladd();
+	template<uuint type_size> void test_sqrt();
+	template<uuint type_size> void test_mulbig();
+	template<uuint type_size> void test_div();
+	void test_divnewton();
+	void test_bigdivnewton();
+	template<uuint type_size> void test_powmod();
+	template<uuint type_size> void test_mulmod();
+	void test_powmodbig();
+	void test_dynadd();
+	void test_dynmul();
+	void test_dyndiv();
+	void test_dynshift();
+	void test_dynstring();
+	template<uuint type_size> void test_dynconv();
+	void test_dynalias();
+	void test_dynrandom();
+	template<uuint type_size> void test_biground();
+	template<uuint type_size> void test_bigdivuint();
+	template<uuint type_size> void test_bigmuladd();
+	template<uuint type_size> void test_bigsqrt();
+	template<uuint type_size> void test_bigroot();
+	template<uuint type_size> void test_bigfromstring();
+	template<uuint type_size> void test_intervalfromstring();
+	template<uuint type_size> void test_interval();
+	template<uuint type_size> void test_bigfunction();
+	template<uuint type_size> void test_bigconstant();
+	void test_bigconstantbig();
+	template<uuint type_size> void test_adaptive();
+
+	template<uuint type_size> void fill_uint(UInt<type_size> & result, uuint words, uuint & seed);
+
+void read_word(std::string & result);
+bool read_rounding(RoundingMode & result);
+
+template<uuint type_size>
+bool read_big(Big<1, type_size> & result);
+
+template<uuint type_size>
+bool set_constant(const std::string & name, Big<1, type_size> & result);
+
+template<uuint type_size>
+bool check_big(const Big<1, type_size> & result, const Big<1, type_size> & new_result, int new_carry);
+
+template<uuint type_size>
+bool check_big_carry(const Big<1, type_size> & result, bool nan, const Big<1, type_size> & new_result, int new_carry);
+
+template<uuint type_size>
+bool read_big_or_nan(Big<1, type_size> & result, bool & nan);
+
+template<uuint type_size>
+bool check_interval_bound(const Big<1, type_size> & result, const Big<1, type_size> & new_result,
+						  bool upper, uuint ulps);
+
+template<uuint type_size>
+bool check_big_ulps(const Big<1, type_size> & result, bool nan, const Big<1, type_size> & new_result,
+					ErrorCode err, uuint ulps);
 
 	template<uuint type_size> bool check_result_carry(const ttmath::UInt<type_size> & result, const ttmath::UInt<type_size> & new_result,
 						int carry, int new_carry);
 
 	template<uuint type_size> bool check_result_or_carry(const ttmath::UInt<type_size> & result, const ttmath::UInt<type_size> & new_result,
 						int carry, int new_carry);
+	template<uuint type_size> bool check_vector(const ttmath::UInt<type_size> & result, const ttmath::UInt<type_size> & new_result,
+						uuint carry, uuint new_carry, const char * variant);
 
 int upper_char(int c);
 bool is_white(int c);
@@ -52,6 +52,8 @@
 
 
 #include "ttmathbig.h"
+#include "ttmathmontgomery.h"
+#include "ttmathdynint.h"
 #include "ttmathobjects.h"
 
 #include <string>
@@ -226,40 +228,58 @@ namespace ttmath
 	
 	/*!
 		this method calculates the natural logarithm (logarithm with the base 'e')
+
+		the result is stored in 'result' (without making a temporary object
+		and copying it out), x can be the same object as result
 	*/
 	template<class ValueType>
-	ValueType Ln(const ValueType & x, ErrorCode * err = 0)
+	ErrorCode Ln(const ValueType & x, ValueType & result)
 	{
 		if( x.IsNan() )
 		{
-			if( err )
-				*err = err_improper_argument;
+			result.SetNan();
 
-		return x; // NaN
+		return err_improper_argument;
+		}
+
+		if( &x == &result )
+		{
+			// Big::Ln() cannot take 'this' as the argument
+			ValueType temp(x);
+
+		return Ln(temp, result);
 		}
 
-		ValueType result;
 		uint state = result.Ln(x);
 
-		if( err )
+		switch( state )
 		{
-			switch( state )
-			{
-			case 0:
-				*err = err_ok;
-				break;
-			case 1:
-				*err = err_overflow;
-				break;
-			case 2:
-				*err = err_improper_argument;
-				break;
-			default:
-				*err = err_internal_error;
-				break;
-			}
+		case 0:
+			return err_ok;
+
+		case 1:
+			return err_overflow;
+
+		case 2:
+			return err_improper_argument;
 		}
 
+	return err_internal_error;
+	}
+
+
+	/*!
+		this method calculates the natural logarithm (logarithm with the base 'e')
+	*/
+	template<class ValueType>
+	ValueType Ln(const ValueType & x, ErrorCode * err = 0)
+	{
+	ValueType result;
+
+		ErrorCode e = Ln(x, result);
+
+		if( err )
+			*err = e;
 
 	return result;
 	}
@@ -267,64 +287,103 @@ namespace ttmath
 
 	/*!
 		this method calculates the logarithm
+
+		the result is stored in 'result', x and base can be the same object as result
 	*/
 	template<class ValueType>
-	ValueType Log(const ValueType & x, const ValueType & base, ErrorCode * err = 0)
+	ErrorCode Log(const ValueType & x, const ValueType & base, ValueType & result)
 	{
 		if( x.IsNan() || base.IsNan() )
 		{
-			if( err )
-				*err = err_improper_argument;
+			result.SetNan();
+
+		return err_improper_argument;
+		}
+
+		if( &x == &result || &base == &result )
+		{
+			// Big::Log() cannot take 'this' as an argument
+			ValueType temp(result);
 
-		return ValueType(); // default NaN
+		return Log( (&x == &result) ? temp : x, (&base == &result) ? temp : base, result );
 		}
 
-		ValueType result;
 		uint state = result.Log(x, base);
 
-		if( err )
+		switch( state )
 		{
-			switch( state )
-			{
-			case 0:
-				*err = err_ok;
-				break;
-			case 1:
-				*err = err_overflow;
-				break;
-			case 2:
-			case 3:
-				*err = err_improper_argument;
-				break;
-			default:
-				*err = err_internal_error;
-				break;
-			}
+		case 0:
+			return err_ok;
+
+		case 1:
+			return err_overflow;
+
+		case 2:
+		case 3:
+			return err_improper_argument;
 		}
 
+	return err_internal_error;
+	}
+
+
+	/*!
+		this method calculates the logarithm
+	*/
+	template<class ValueType>
+	ValueType Log(const ValueType & x, const ValueType & base, ErrorCode * err = 0)
+	{
+	ValueType result;
+
+		ErrorCode e = Log(x, base, result);
+
+		if( err )
+			*err = e;
+
 	return result;
 	}
 
 
 	/*!
 		this method calculates the expression e^x
+
+		the result is stored in 'result', x can be the same object as result
 	*/
 	template<class ValueType>
-	ValueType Exp(const ValueType & x, ErrorCode * err = 0)
+	ErrorCode Exp(const ValueType & x, ValueType & result)
 	{
 		if( x.IsNan() )
 		{
-			if( err )
-				*err = err_improper_argument;
+			result.SetNan();
 
-		return x; // NaN
+		return err_improper_argument;
+		}
+
+		if( &x == &result )
+		{
+			ValueType temp(x);
+
+		return Exp(temp, result);
 		}
 
-		ValueType result;
 		uint c = result.Exp(x);
 
+	return c ? err_overflow : err_ok;
+	}
+
+
+	/*!
+		this method calculates the expression e^x
+	*/
+	template<class ValueType>
+	ValueType Exp(const ValueType & x, ErrorCode * err = 0)
+	{
+	ValueType result;
+
+		ErrorCode e = Exp(x, result);
+
 		if( err )
-			*err = c ? err_overflow : err_ok;
+			*err = e;
 
 	return result;
 	}
@@ -347,322 +406,677 @@ namespace ttmath
 	/*!
 		an auxiliary function for calculating the Sine
 		(you don't have to call this function) 
+
+		it reduces x (x >= 0) by the period: x = quadrant*pi/2 + r or x = quadrant*pi/2 - r
+		(when 'negative' is true) and sets 'x' to r which is from <0, pi/4>
+
+		this is used for big values of x (look at ReducePeriod()),
+		we're using the Payne-Hanek method: x = m * 2^e (m is the mantissa - an integer)
+			x * 2/pi = m * floor(2/pi * 2^(e+s)) / 2^s
+		and the bits of 2/pi which give a multiple of 4 in the product are not needed,
+		so the multiplication is made on integers independent of the exponent
+		(only the bits of 2/pi are taken from a different place)
+
+		s = 3 * (mantissa bits) + 2 words, so the result has the full precision even
+		if x is very near to a multiple of pi/2
 	*/
-	template<class ValueType>
-	uint PrepareSin(ValueType & x, bool & change_sign)
+	template<uint exp, uint man>
+	uint ReducePeriodPayneHanek(Big<exp,man> & x, uint & quadrant, bool & negative)
 	{
-	ValueType temp;
+	const uint s_words = 3*man + 2;
+	const sint s       = sint(s_words * TTMATH_BITS_PER_UINT);
+	UInt<3*man+3> t; // floor(2/pi * 2^(e+s)) mod 2^(s+2)
+	UInt<4*man+3> p; // m * t
+	uint i;
 
-		change_sign = false;
-	
-		if( x.IsSign() )
+		if( x.exponent > sint(TTMATH_REDUCTION_MAX_EXPONENT) )
+			return 1;
+
+		if( x.IsZero() || x.exponent < -s )
 		{
-			// we're using the formula 'sin(-x) = -sin(x)'
-			change_sign = !change_sign;
-			x.ChangeSign();
+			// x * 2/pi is smaller than 2^(-s)
+			p.SetZero();
+		}
+		else
+		{
+			BinarySplitting::TwoOverPi(uint(x.exponent.ToInt() + s), t.table, 3*man+3);
+			t.table[3*man+2] &= 3;
+			UInt<man>::MulBigVector(x.mantissa.table, man, t.table, 3*man+3, p.table);
 		}
-	
-		// we're reducing the period 2*PI
-		// (for big values there'll always be zero)
-		temp.Set2Pi();
-		
-		if( x.Mod(temp) )
-			return 1;
-		
 
-		// we're setting 'x' as being in the range of <0, 0.5PI>
+		// x * 2/pi = q + p/2^s
+		quadrant = p.table[s_words] & 3;
+		negative = false;
 
-		temp.SetPi();
+		if( (p.table[s_words-1] & TTMATH_UINT_HIGHEST_BIT) != 0 )
+		{
+			// p/2^s >= 1/2, we're taking the next quadrant: q+1 - (2^s - p)/2^s
+			quadrant = (quadrant + 1) & 3;
+			negative = true;
+
+			for(i=0 ; i<s_words ; ++i)
+				p.table[i] = ~p.table[i];
+
+			for(i=0 ; i<s_words && ++p.table[i]==0 ; ++i);
+		}
 
-		if( x > temp )
+		// the highest non zero word
+		for(i=s_words-1 ; i>0 && p.table[i]==0 ; --i);
+
+		if( p.table[i] == 0 )
 		{
-			// x is in (pi, 2*pi>
-			x.Sub( temp );
-			change_sign = !change_sign;
+			x.SetZero();
+			return 0;
 		}
-		
-		temp.Set05Pi();
 
-		if( x > temp )
+		// the multiplication by pi/2 is made with one more word
+		// and the result is rounded
+		Big<exp,man+1> fraction, pi05;
+		uint move = TTMATH_BITS_PER_UINT - 1 - uint(UInt<1>::FindLeadingBitInWord(p.table[i]));
+
+		// the mantissa is taken from the highest bits of p
+		for(uint j=0 ; j<man+1 ; ++j)
 		{
-			// x is in (0.5pi, pi>
-			x.Sub( temp );
-			x = temp - x;
+			sint index = sint(i) - sint(man) + sint(j);
+			uint low   = (index >= 1) ? p.table[index-1] : 0;
+			uint high  = (index >= 0) ? p.table[index]   : 0;
+
+			fraction.mantissa.table[j] = (move == 0) ? high : ((high << move) | (low >> (TTMATH_BITS_PER_UINT - move)));
 		}
 
+		fraction.exponent = (sint(i) - sint(man)) * sint(TTMATH_BITS_PER_UINT) - sint(move) - s;
+		fraction.info = 0;
+
+		// x = pi/2 * p/2^s
+		pi05.Set05Pi();
+		fraction.Mul(pi05);
+		x.FromBig(fraction, round_nearest_even);
+
 	return 0;
 	}
 
-	
+
 	/*!
 		an auxiliary function for calculating the Sine
 		(you don't have to call this function) 
 
-		it returns Sin(x) where 'x' is from <0, PI/2>
-		we're calculating the Sin with using Taylor series in zero or PI/2
-		(depending on which point of these two points is nearer to the 'x')
+		it reduces x (x >= 0) by the period in the same way as ReducePeriodPayneHanek()
+		but x must be from (pi/4, 2^(TTMATH_BITS_PER_UINT-2))
 
-		Taylor series:
-		sin(x) = sin(a) + cos(a)*(x-a)/(1!)
-		         - sin(a)*((x-a)^2)/(2!) - cos(a)*((x-a)^3)/(3!)
-				 + sin(a)*((x-a)^4)/(4!) + ...
+		we're using the Cody-Waite method:
+			q = round(x * 2/pi)
+			r = x - q * pi/2
+		q is calculated from the highest word of x and one word of 2/pi, it can be
+		wrong by one near the middle between two multiples of pi/2 but then r is only
+		a bit greater than pi/4 (the sign of r is in 'negative')
 
-		when a=0 it'll be:
-		sin(x) = (x)/(1!) - (x^3)/(3!) + (x^5)/(5!) - (x^7)/(7!) + (x^9)/(9!) ...
-
-		and when a=PI/2:
-		sin(x) = 1 - ((x-PI/2)^2)/(2!) + ((x-PI/2)^4)/(4!) - ((x-PI/2)^6)/(6!) ...
+		pi/2 is taken from the built-in table of pi (nothing is calculated at runtime)
+		with 3 * (mantissa words) + 3 words and the subtraction is made on integers,
+		the extra words are needed because x can be very near to a multiple of pi/2
+		(then the high bits of x and q*pi/2 cancel out)
 	*/
-	template<class ValueType>
-	ValueType Sin0pi05(const ValueType & x)
+	template<uint exp, uint man>
+	void ReducePeriodCodyWaite(Big<exp,man> & x, uint & quadrant, bool & negative)
 	{
-	ValueType result;
-	ValueType numerator, denominator;
-	ValueType d_numerator, d_denominator;
-	ValueType one, temp, old_result;
-
-		// temp = pi/4
-		temp.Set05Pi();
-		temp.exponent.SubOne();
+	Big<exp,3*man+3> pi05;
+	UInt<3*man+4> xx, p;
+	uint q, high, low;
 
-		one.SetOne();
+		#ifdef TTMATH_PLATFORM32
+		const uint two_over_pi = 0xa2f9836eu;   // floor(2/pi * 2^32)
+		#else
+		const uint two_over_pi = 0xa2f9836e4e441529ul;   // floor(2/pi * 2^64)
+		#endif
 
-		if( x < temp ) 
-		{	
-			// we're using the Taylor series with a=0
-			result    = x;
-			numerator = x;
-			denominator = one;
+		// x = m * 2^e where m is the highest word of the mantissa (it has the highest bit set),
+		// 2 <= -e <= TTMATH_BITS_PER_UINT because pi/4 < x < 2^(TTMATH_BITS_PER_UINT-2)
+		uint shift = uint(-(x.exponent.ToInt() + sint((man-1) * TTMATH_BITS_PER_UINT)));
 
-			// d_numerator = x^2
-			d_numerator = x;
-			d_numerator.Mul(x);
+		UInt<1>::MulTwoWords(x.mantissa.table[man-1], two_over_pi, &high, &low);
+		q = ((high >> (shift - 1)) + 1) >> 1;
 
-			d_denominator = 2;
-		}
-		else
-		{
-			// we're using the Taylor series with a=PI/2
-			result = one;
-			numerator = one;
-			denominator = one;
+		// q * pi/2 and x as integers (multiplied by 2^(-pi05.exponent))
+		pi05.Set05Pi();
+		pi05.mantissa.MulInt(q, p);
 
-			// d_numerator = (x-pi/2)^2
-			ValueType pi05;
-			pi05.Set05Pi();
+		xx.SetZero();
 
-			temp = x;
-			temp.Sub( pi05 );
-			d_numerator = temp;
-			d_numerator.Mul( temp );
+		for(uint i=0 ; i<man ; ++i)
+			xx.table[i] = x.mantissa.table[i];
 
-			d_denominator = one;
-		}
+		xx.Rcl(uint((x.exponent - pi05.exponent).ToInt()));
 
-		uint c = 0;
-		bool addition = false;
+		quadrant = q & 3;
+		negative = false;
 
-		old_result = result;
-		for(uint i=1 ; i<=TTMATH_ARITHMETIC_MAX_LOOP ; ++i)
+		if( xx < p )
+		{
+			// x < q * pi/2
+			p.Sub(xx);
+			xx = p;
+			negative = true;
+		}
+		else
 		{
-			// we're starting from a second part of the formula
-			c += numerator.    Mul( d_numerator );
-			c += denominator.  Mul( d_denominator );
-			c += d_denominator.Add( one );
-			c += denominator.  Mul( d_denominator );
-			c += d_denominator.Add( one );
-			temp = numerator;
-			c += temp.Div(denominator);
+			xx.Sub(p);
+		}
 
-			if( c )
-				// Sin is from <-1,1> and cannot make an overflow
-				// but the carry can be from the Taylor series
-				// (then we only break our calculations)
-				break;
+		Big<exp,3*man+4> r;
+		r.mantissa = xx;
+		r.exponent = pi05.exponent;
+		r.info     = 0;
+		r.Standardizing();
 
-			if( addition )
-				result.Add( temp );
-			else
-				result.Sub( temp );
+		x.FromBig(r, round_nearest_even);
+	}
 
 
-			addition = !addition;
-	
-			// we're testing whether the result has changed after adding
-			// the next part of the Taylor formula, if not we end the loop
-			// (it means 'x' is zero or 'x' is PI/2 or this part of the formula
-			// is too small)
-			if( result == old_result )
-				break;
+	/*!
+		an auxiliary function for calculating the Sine
+		(you don't have to call this function) 
 
-			old_result = result;
+		it reduces x (x >= 0) by the period: x = quadrant*pi/2 + r or x = quadrant*pi/2 - r
+		(when 'negative' is true) and sets 'x' to r which is about from <0, pi/4>
+
+		if x is not too big and pi has enough words in the built-in table
+		the Cody-Waite method is used, otherwise the Payne-Hanek method
+	*/
+	template<uint exp, uint man>
+	uint ReducePeriod(Big<exp,man> & x, uint & quadrant, bool & negative)
+	{
+		if( 3*man+3 <= TTMATH_BUILTIN_VARIABLES_SIZE &&
+			x.exponent < sint(TTMATH_BITS_PER_UINT - 2) - sint(man * TTMATH_BITS_PER_UINT) )
+		{
+			ReducePeriodCodyWaite(x, quadrant, negative);
+			return 0;
 		}
 
-	return result;
+	return ReducePeriodPayneHanek(x, quadrant, negative);
 	}
 
-	} // namespace auxiliaryfunctions
-
-
 
 	/*!
-		this function calculates the Sine
+		an auxiliary function for calculating the Sine
+		(you don't have to call this function) 
+
+		it sets 'x' to r from <0, pi/4> where:
+			x = quadrant*pi/2 + r   or
+			x = quadrant*pi/2 - r   (when 'negative' is true)
+		(modulo 2*pi)
 	*/
 	template<class ValueType>
-	ValueType Sin(ValueType x, ErrorCode * err = 0)
+	uint PrepareSin(ValueType & x, uint & quadrant, bool & negative)
 	{
-	using namespace auxiliaryfunctions;
-
-	ValueType one, result;
-	bool change_sign;	
-	
-		if( x.IsNan() )
-		{
-			if( err )
-				*err = err_improper_argument;
+	ValueType temp;
+	bool sign = x.IsSign();
 
-		return result; // NaN is set by default
-		}
+		quadrant = 0;
+		negative = false;
 
-		if( err )
-			*err = err_ok;
+		if( sign )
+			x.ChangeSign();
 
-		if( PrepareSin( x, change_sign ) )
-		{
-			// x is too big, we cannnot reduce the 2*PI period
-			// prior to version 0.8.5 the result was zero
-			
-			// result has NaN flag set by default
+		// temp = pi/4
+		temp.Set05Pi();
+		temp.exponent.SubOne();
 
-			if( err )
-				*err = err_overflow; // maybe another error code? err_improper_argument?
+		if( x > temp && ReducePeriod(x, quadrant, negative) )
+			return 1;
 
-		return result; // NaN is set by default
+		if( sign )
+		{
+			// -(q*pi/2 + r) = (4-q)*pi/2 - r
+			quadrant = (4 - quadrant) & 3;
+			negative = !negative;
 		}
 
-		result = Sin0pi05( x );
-	
-		one.SetOne();
-
-		// after calculations there can be small distortions in the result
-		if( result > one )
-			result = one;
-		else
-		if( result.IsSign() )
-			// we've calculated the sin from <0, pi/2> and the result
-			// should be positive
-			result.SetZero();
-
-		if( change_sign )
-			result.ChangeSign();	
-		
-	return result;
+	return 0;
 	}
 
-	
+
 	/*!
-		this function calulates the Cosine
-		we're using the formula cos(x) = sin(x + PI/2)
+		an auxiliary function for calculating the Sine
+		(you don't have to call this function) 
+
+		result = sin(quadrant*pi/2 + r) or sin(quadrant*pi/2 - r) (when 'negative' is true)
+		where sin_r = sin(r) and cos_r = cos(r)
 	*/
 	template<class ValueType>
-	ValueType Cos(ValueType x, ErrorCode * err = 0)
+	void SinOfQuadrant(uint quadrant, bool negative, const ValueType & sin_r, const ValueType & cos_r, ValueType & result)
 	{
-		if( x.IsNan() )
-		{
-			if( err )
-				*err = err_improper_argument;
+		bool change_sign;
 
-		return x; // NaN
+		if( (quadrant & 1) == 0 )
+		{
+			result = sin_r;
+			change_sign = ((quadrant & 3) == 2) != negative;
 		}
-
-		ValueType pi05;
-		pi05.Set05Pi();
-
-		uint c = x.Add( pi05 );
-
-		if( c )
+		else
 		{
-			if( err )
-				*err = err_overflow;
-	
-		return ValueType(); // result is undefined (NaN is set by default)
+			result = cos_r;
+			change_sign = ((quadrant & 3) == 3);
 		}
 
-	return Sin(x, err);
+		if( change_sign && !result.IsZero() )
+			result.ChangeSign();
 	}
-	
+
 
 	/*!
-		this function calulates the Tangent
-		we're using the formula tan(x) = sin(x) / cos(x)
+		an auxiliary function for SinCos0pi025()
+		(you don't have to call this function) 
 
-		it takes more time than calculating the Tan directly
-		from for example Taylor series but should be a bit preciser
-		because Tan receives its values from -infinity to +infinity
-		and when we calculate it from any series then we can make
-		a greater mistake than calculating 'sin/cos'
+		result = a * b / 2^shift where a, b and the result are fractions
+		with value_size words (the value is table / 2^(value_size*TTMATH_BITS_PER_UINT)),
+		shift can be -1, the result is truncated (result can be the same object as a or b)
 	*/
-	template<class ValueType>
-	ValueType Tan(const ValueType & x, ErrorCode * err = 0)
+	template<uint value_size>
+	void MulFraction(const UInt<value_size> & a, const UInt<value_size> & b, UInt<value_size> & result, sint shift)
 	{
-		ValueType result = Cos(x, err);
-		
-		if( err && *err != err_ok )
-			return result;
-
-		if( result.IsZero() )
-		{
-			if( err )
-				*err = err_improper_argument;
+	UInt<value_size*2> product;
 
-			result.SetNan();
+		UInt<value_size>::MulBigVector(a.table, value_size, b.table, value_size, product.table);
 
-		return result;
-		}
+		if( shift < 0 )
+			product.Rcl(uint(-shift));
+		else
+			product.Rcr(uint(shift));
 
-	return Sin(x, err) / result;
+		for(uint i=0 ; i<value_size ; ++i)
+			result.table[i] = product.table[value_size + i];
 	}
 
 
 	/*!
-		this function calulates the Tangent
-		look at the description of Tan(...)
+		an auxiliary function for calculating the Sine and the Cosine
+		(you don't have to call this function) 
 
-		(the abbreviation of Tangent can be 'tg' as well)
+		it calculates sin(x) and cos(x) where 'x' is from <0, PI/4>
+		(x can be a bit greater than pi/4 and x can be the same object as sin_x or cos_x)
+
+		we're halving the argument: u = x / 2^k (k is about sqrt(bits/2)),
+		sin(u) and h(u) = 1 - cos(u) are calculated from the Taylor series:
+			sin(u) = u - u^3/3! + u^5/5! - ...
+			h(u)   = u^2/2! - u^4/4! + u^6/6! - ...
+		(there are only a few terms because u is small) and then k times:
+			sin(2u) = 2 * sin(u) * (1 - h(u))
+			h(2u)   = 2 * sin(u)^2
+		(there is no subtraction of near values here)
+
+		the calculations are made on fractions (integers) with one more word
+		than the mantissa, sin(u) is kept multiplied by 2^(k+t) where x = m * 2^(-t)
+		and m is from <1/2, 1) so it has always the full precision, there is no
+		normalization of the exponent as in Big<> and the kernel is fast for small
+		mantissas too
 	*/
-	template<class ValueType>
-	ValueType Tg(const ValueType & x, ErrorCode * err = 0)
+	template<uint exp, uint man>
+	void SinCos0pi025(const Big<exp,man> & x, Big<exp,man> & sin_x, Big<exp,man> & cos_x)
 	{
-		return Tan(x, err);
-	}
+	const sint bits = sint((man+1) * TTMATH_BITS_PER_UINT);
+	UInt<man+1> s, h, u2, term, hterm, cos_u;
+	Big<exp,man+1> result;
+	sint t, level;
+	uint k, i;
 
+		if( x.IsZero() || x.exponent < -sint(man*TTMATH_BITS_PER_UINT) - bits/2 )
+		{
+			// x^2 < 2^(-bits) so sin(x) = x and cos(x) = 1 after rounding
+			sin_x = x;
+			cos_x.SetOne();
+			return;
+		}
 
-	/*!
-		this function calulates the Cotangent
-		we're using the formula tan(x) = cos(x) / sin(x)
+		// x = s * 2^(-t), s is from <1/2, 1) (t is -1 if x is greater than one)
+		t = -(x.exponent.ToInt() + sint(man*TTMATH_BITS_PER_UINT));
+		s.table[0] = 0;
+
+		for(i=0 ; i<man ; ++i)
+			s.table[i+1] = x.mantissa.table[i];
+
+		for(k=0 ; 2*k*k < uint(bits) ; ++k);
+
+		// s = sin(u) * 2^level, u^2 = s^2 * 2^(-2*level)
+		level = sint(k) + t;
+		MulFraction(s, s, u2, 2*level);
+
+		term  = s;
+		hterm = u2;
+		hterm.Rcr(1);
+		h     = hterm;
+
+		for(i=2 ; i<=TTMATH_ARITHMETIC_MAX_LOOP ; i+=2)
+		{
+			// term = s * u^i / (i+1)!   hterm = u^(i+2) / (i+2)!
+			MulFraction(term, u2, term, 0);
+			term.DivInt(i * (i+1));
+
+			MulFraction(hterm, u2, hterm, 0);
+			hterm.DivInt((i+1) * (i+2));
+
+			if( (i & 3) == 2 )
+			{
+				s.Sub(term);
+				h.Sub(hterm);
+			}
+			else
+			{
+				s.Add(term);
+				h.Add(hterm);
+			}
+
+			if( term.IsZero() && hterm.IsZero() )
+				break;
+		}
+
+		for(i=0 ; i<k ; ++i, --level)
+		{
+			// cos_u = 1 - h (h is greater than zero)
+			cos_u.SetZero();
+			cos_u.Sub(h);
+
+			// h(2u) = 2 * sin(u)^2 = s^2 * 2^(1 - 2*level)
+			MulFraction(s, s, h, 2*level - 1);
+
+			// sin(2u) * 2^(level-1) = s * cos(u)
+			if( !cos_u.IsZero() )
+				MulFraction(s, cos_u, s, 0);
+		}
+
+		// cos(x) = 1 - h
+		if( h.IsZero() )
+		{
+			cos_x.SetOne();
+		}
+		else
+		{
+			result.mantissa.SetZero();
+			result.mantissa.Sub(h);
+			result.exponent = -bits;
+			result.info = 0;
+			result.Standardizing();
+			cos_x.FromBig(result, round_nearest_even);
+		}
+
+		// sin(x) = s * 2^(-t)
+		result.mantissa = s;
+		result.exponent = -bits - t;
+		result.info = 0;
+		result.Standardizing();
+		sin_x.FromBig(result, round_nearest_even);
+	}
+
+
+	/*!
+		an auxiliary function for calculating the Sine and the Cosine
+		(you don't have to call this function)
+
+		result = sin(x + quadrant*pi/2)
+	*/
+	template<class ValueType>
+	ErrorCode SinShifted(const ValueType & x, ValueType & result, uint quadrant)
+	{
+	ValueType sin_r, cos_r;
+	uint q;
+	bool negative;
+	
+		if( x.IsNan() )
+		{
+			result.SetNan();
+
+		return err_improper_argument;
+		}
+
+		result = x;
+
+		if( PrepareSin( result, q, negative ) )
+		{
+			// x is too big, we cannnot reduce the 2*PI period
+			// prior to version 0.8.5 the result was zero
+			result.SetNan();
+
+		return err_overflow; // maybe another error code? err_improper_argument?
+		}
+
+		SinCos0pi025(result, sin_r, cos_r);
+		SinOfQuadrant(q + quadrant, negative, sin_r, cos_r, result);
+
+	return err_ok;
+	}
+
+	} // namespace auxiliaryfunctions
+
+
+
+	/*!
+		this function calculates the Sine
+
+		the result is stored in 'result' (without making a temporary object
+		and copying it out), x can be the same object as result
+	*/
+	template<class ValueType>
+	ErrorCode Sin(const ValueType & x, ValueType & result)
+	{
+		return auxiliaryfunctions::SinShifted(x, result, 0);
+	}
+
+
+	/*!
+		this function calculates the Sine
+	*/
+	template<class ValueType>
+	ValueType Sin(const ValueType & x, ErrorCode * err = 0)
+	{
+	ValueType result;
+
+		ErrorCode e = Sin(x, result);
+
+		if( err )
+			*err = e;
+
+	return result;
+	}
+
+	
+	/*!
+		this function calulates the Cosine
+		we're using the formula cos(x) = sin(x + PI/2)
+		(PI/2 is not added to x but the reduction of the period takes it into account)
+
+		the result is stored in 'result', x can be the same object as result
+	*/
+	template<class ValueType>
+	ErrorCode Cos(const ValueType & x, ValueType & result)
+	{
+		return auxiliaryfunctions::SinShifted(x, result, 1);
+	}
+
+
+	/*!
+		this function calulates the Cosine
+		we're using the formula cos(x) = sin(x + PI/2)
+	*/
+	template<class ValueType>
+	ValueType Cos(const ValueType & x, ErrorCode * err = 0)
+	{
+	ValueType result;
+
+		ErrorCode e = Cos(x, result);
+
+		if( err )
+			*err = e;
+
+	return result;
+	}
+
+
+	/*!
+		this function calculates the Sine and the Cosine at once
+		(the period is reduced only once and both values are taken
+		from the same series, it's about two times faster than Sin() and Cos())
+
+		x can be the same object as sin_x or cos_x
+	*/
+	template<class ValueType>
+	ErrorCode SinCos(const ValueType & x, ValueType & sin_x, ValueType & cos_x)
+	{
+	using namespace auxiliaryfunctions;
+
+	ValueType r, sin_r, cos_r;
+	uint quadrant;
+	bool negative;
+
+		if( x.IsNan() )
+		{
+			sin_x.SetNan();
+			cos_x.SetNan();
+
+		return err_improper_argument;
+		}
+
+		r = x;
+
+		if( PrepareSin( r, quadrant, negative ) )
+		{
+			sin_x.SetNan();
+			cos_x.SetNan();
+
+		return err_overflow;
+		}
+
+		SinCos0pi025(r, sin_r, cos_r);
+		SinOfQuadrant(quadrant,     negative, sin_r, cos_r, sin_x);
+		SinOfQuadrant(quadrant + 1, negative, sin_r, cos_r, cos_x);
+
+	return err_ok;
+	}
+	
+
+	/*!
+		this function calulates the Tangent
+		we're using the formula tan(x) = sin(x) / cos(x)
+
+		it takes more time than calculating the Tan directly
+		from for example Taylor series but should be a bit preciser
+		because Tan receives its values from -infinity to +infinity
+		and when we calculate it from any series then we can make
+		a greater mistake than calculating 'sin/cos'
+
+		(the sine and cosine are taken from SinCos() so the period
+		is reduced only once)
+
+		the result is stored in 'result', x can be the same object as result
+	*/
+	template<class ValueType>
+	ErrorCode Tan(const ValueType & x, ValueType & result)
+	{
+	ValueType sin_x, cos_x;
+
+		ErrorCode err = SinCos(x, sin_x, cos_x);
+
+		if( err != err_ok )
+		{
+			result.SetNan();
+
+		return err;
+		}
+
+		if( cos_x.IsZero() )
+		{
+			result.SetNan();
+
+		return err_improper_argument;
+		}
+
+		result = sin_x;
+		result.Div(cos_x);
+
+	return err;
+	}
+
+
+	/*!
+		this function calulates the Tangent
+		look at the description of Tan(x, result)
+	*/
+	template<class ValueType>
+	ValueType Tan(const ValueType & x, ErrorCode * err = 0)
+	{
+	ValueType result;
+
+		ErrorCode e = Tan(x, result);
+
+		if( err )
+			*err = e;
+
+	return result;
+	}
+
+
+	/*!
+		this function calulates the Tangent
+		look at the description of Tan(...)
+
+		(the abbreviation of Tangent can be 'tg' as well)
+	*/
+	template<class ValueType>
+	ValueType Tg(const ValueType & x, ErrorCode * err = 0)
+	{
+		return Tan(x, err);
+	}
+
+
+	/*!
+		this function calulates the Cotangent
+		we're using the formula tan(x) = cos(x) / sin(x)
 
 		(why do we make it in this way? 
 		look at information in Tan() function)
+
+		the result is stored in 'result', x can be the same object as result
 	*/
 	template<class ValueType>
-	ValueType Cot(const ValueType & x, ErrorCode * err = 0)
+	ErrorCode Cot(const ValueType & x, ValueType & result)
 	{
-		ValueType result = Sin(x, err);
+	ValueType sin_x, cos_x;
 
-		if( err && *err != err_ok )
-			return result;
+		ErrorCode err = SinCos(x, sin_x, cos_x);
 
-		if( result.IsZero() )
+		if( err != err_ok )
 		{
-			if( err )
-				*err = err_improper_argument;
+			result.SetNan();
+
+		return err;
+		}
 
+		if( sin_x.IsZero() )
+		{
 			result.SetNan();
 
-		return result;
+		return err_improper_argument;
 		}
-	
-	return Cos(x, err) / result;
+
+		result = cos_x;
+		result.Div(sin_x);
+
+	return err;
+	}
+
+
+	/*!
+		this function calulates the Cotangent
+		look at the description of Cot(x, result)
+	*/
+	template<class ValueType>
+	ValueType Cot(const ValueType & x, ErrorCode * err = 0)
+	{
+	ValueType result;
+
+		ErrorCode e = Cot(x, result);
+
+		if( err )
+			*err = e;
+
+	return result;
 	}
 
 
@@ -701,29 +1115,21 @@ namespace ttmath
 	template<class ValueType>
 	ValueType ASin_0(const ValueType & x)
 	{
-	ValueType nominator, denominator, nominator_add, nominator_x, denominator_add, denominator_x;
-	ValueType two, result(x), x2(x);
-	ValueType nominator_temp, denominator_temp, old_result = result;
+	ValueType nominator_x, nominator_temp, result(x), x2(x), old_result = result;
 	uint c = 0;
 
-	x2.Mul(x);
-	two = 2;
-
-	nominator.SetOne();
-	denominator     = two;
-	nominator_add   = nominator;
-	denominator_add = denominator;
-	nominator_x     = x;
-	denominator_x   = 3;
+	x2.Mul(x2);
+	nominator_x = x;
 
 		for(uint i=1 ; i<=TTMATH_ARITHMETIC_MAX_LOOP ; ++i)
 		{
+			// nominator_x = x^(2i+1) * (1*3*...*(2i-1)) / (2*4*...*(2i))
+			// (the factors are small so there are only one-word multiplications and divisions)
 			c += nominator_x.Mul(x2);
-			nominator_temp = nominator_x;	
-			c += nominator_temp.Mul(nominator);
-			denominator_temp = denominator;
-			c += denominator_temp.Mul(denominator_x);
-			c += nominator_temp.Div(denominator_temp);
+			c += nominator_x.MulUInt(2*i-1);
+			c += nominator_x.DivUInt(2*i);
+			nominator_temp = nominator_x;
+			c += nominator_temp.DivUInt(2*i+1);
 
 			// if there is a carry somewhere we only break the calculating
 			// the result should be ok -- it's from <-pi/2, pi/2>
@@ -737,13 +1143,6 @@ namespace ttmath
 				break;
 
 			old_result = result;
-
-
-			c += nominator_add.Add(two);
-			c += denominator_add.Add(two);
-			c += nominator.Mul(nominator_add);
-			c += denominator.Mul(denominator_add);
-			c += denominator_x.Add(two);
 		}
 
 	return result;
@@ -765,36 +1164,28 @@ namespace ttmath
 	template<class ValueType>
 	ValueType ASin_1(const ValueType & x)
 	{
-	ValueType nominator, denominator, nominator_add, nominator_x, nominator_x_add, denominator_add, denominator_x;
-	ValueType denominator2;
-	ValueType one, two, result;
-	ValueType nominator_temp, denominator_temp, old_result;
+	ValueType nominator_x, nominator_x_add;
+	ValueType one, result;
+	ValueType nominator_temp, old_result;
 	uint c = 0;
 
-	two = 2;
-
 	one.SetOne();
-	nominator		= one;
 	result			= one;
 	old_result		= result;
-	denominator     = two;
-	nominator_add   = nominator;
-	denominator_add = denominator;
 	nominator_x     = one;
-	nominator_x.Sub(x);
-	nominator_x_add = nominator_x;
-	denominator_x   = 3;
-	denominator2	= two;
+	nominator_x_add = one;
+	nominator_x_add.Sub(x);
 
 
 		for(uint i=1 ; i<=TTMATH_ARITHMETIC_MAX_LOOP ; ++i)
 		{
-			nominator_temp = nominator_x;	
-			c += nominator_temp.Mul(nominator);
-			denominator_temp = denominator;
-			c += denominator_temp.Mul(denominator_x);
-			c += denominator_temp.Mul(denominator2);
-			c += nominator_temp.Div(denominator_temp);
+			// nominator_x = (1-x)^i * (1*3*...*(2i-1)) / ((2*4*...*(2i)) * 2^i)
+			// (the factors are small so there are only one-word multiplications and divisions)
+			c += nominator_x.Mul(nominator_x_add);
+			c += nominator_x.MulUInt(2*i-1);
+			c += nominator_x.DivUInt(4*i);
+			nominator_temp = nominator_x;
+			c += nominator_temp.DivUInt(2*i+1);
 
 			// if there is a carry somewhere we only break the calculating
 			// the result should be ok -- it's from <-pi/2, pi/2>
@@ -808,14 +1199,6 @@ namespace ttmath
 				break;
 
 			old_result = result;
-
-			c += nominator_x.Mul(nominator_x_add);
-			c += nominator_add.Add(two);
-			c += denominator_add.Add(two);
-			c += nominator.Mul(nominator_add);
-			c += denominator.Mul(denominator_add);
-			c += denominator_x.Add(two);
-			c += denominator2.Mul(two);
 		}
 
 		
@@ -837,56 +1220,88 @@ namespace ttmath
 	/*!
 		this function calculates the Arc Sine
 		x is from <-1,1>
+
+		the result is stored in 'result', x can be the same object as result
 	*/
 	template<class ValueType>
-	ValueType ASin(ValueType x, ErrorCode * err = 0)
+	ErrorCode ASin(const ValueType & x, ValueType & result)
 	{
 	using namespace auxiliaryfunctions;
 
-		ValueType result, one;
+		ValueType one;
 		one.SetOne();
 		bool change_sign = false;
 
-		if( x.IsNan() )
+		if( x.IsNan() || x.GreaterWithoutSignThan(one) )
 		{
-			if( err )
-				*err = err_improper_argument;
+			result.SetNan();
 
-		return result; // NaN is set by default
+		return err_improper_argument;
 		}
 
-		if( x.GreaterWithoutSignThan(one) )
-		{
-			if( err )
-				*err = err_improper_argument;
-
-			return result; // NaN is set by default
-		}
+		result = x;
 
-		if( x.IsSign() )
+		if( result.IsSign() )
 		{
 			change_sign = true;
-			x.Abs();
+			result.Abs();
 		}
 
 		one.exponent.SubOne(); // =0.5
 
 		// asin(-x) = -asin(x)
-		if( x.GreaterWithoutSignThan(one) )
-			result = ASin_1(x);	
+		if( result.GreaterWithoutSignThan(one) )
+			result = ASin_1(result);	
 		else
-			result = ASin_0(x);
+			result = ASin_0(result);
 
 		if( change_sign )
 			result.ChangeSign();
 
+	return err_ok;
+	}
+
+
+	/*!
+		this function calculates the Arc Sine
+		x is from <-1,1>
+	*/
+	template<class ValueType>
+	ValueType ASin(const ValueType & x, ErrorCode * err = 0)
+	{
+	ValueType result;
+
+		ErrorCode e = ASin(x, result);
+
 		if( err )
-			*err = err_ok;
+			*err = e;
 
 	return result;
 	}
 
 
+	/*!
+		this function calculates the Arc Cosine
+
+		we're using the formula:
+		acos(x) = pi/2 - asin(x)
+
+		the result is stored in 'result', x can be the same object as result
+	*/
+	template<class ValueType>
+	ErrorCode ACos(const ValueType & x, ValueType & result)
+	{
+	ValueType asin_x;
+
+		ErrorCode err = ASin(x, asin_x);
+
+		result.Set05Pi();
+		result.Sub(asin_x);
+
+	return err;
+	}
+
+
 	/*!
 		this function calculates the Arc Cosine
 
@@ -896,12 +1311,14 @@ namespace ttmath
 	template<class ValueType>
 	ValueType ACos(const ValueType & x, ErrorCode * err = 0)
 	{
-	ValueType temp;
+	ValueType result;
 
-		temp.Set05Pi();
-		temp.Sub(ASin(x, err));
+		ErrorCode e = ACos(x, result);
 
-	return temp;
+		if( err )
+			*err = e;
+
+	return result;
 	}
 
 
@@ -917,31 +1334,29 @@ namespace ttmath
 
 		we're using the Taylor series expanded in zero:
 		atan(x) = x - (x^3)/3 + (x^5)/5 - (x^7)/7 + ...
+		(the denominators are small so we're dividing only by one word - Big::DivUInt())
 	*/
 	template<class ValueType>
 	ValueType ATan0(const ValueType & x)
 	{
-		ValueType nominator, denominator, nominator_add, denominator_add, temp;
+		ValueType nominator, nominator_add, temp;
 		ValueType result, old_result;
 		bool adding = false;
-		uint c = 0;
+		uint c = 0, denominator = 1;
 
 		result        = x;
 		old_result    = result;
 		nominator     = x;
 		nominator_add = x;
-		nominator_add.Mul(x);
-
-		denominator.SetOne();
-		denominator_add = 2;
+		nominator_add.Mul(nominator_add);
 
 		for(uint i=1 ; i<=TTMATH_ARITHMETIC_MAX_LOOP ; ++i)
 		{
 			c += nominator.Mul(nominator_add);
-			c += denominator.Add(denominator_add);
+			denominator += 2;
 	
 			temp = nominator;
-			c += temp.Div(denominator);
+			c += temp.DivUInt(denominator);
 
 			if( c )
 				// the result should be ok
@@ -999,220 +1414,500 @@ namespace ttmath
 			x>=0.5 and x<=1
 			(x can be even smaller than 0.5)
 
-			y = atac(x)
-			x = tan(y)
+			y = atac(x)
+			x = tan(y)
+
+			tan(y-b) = (tan(y)-tab(b)) / (1+tan(y)*tan(b))
+			y-b      = atan( (tan(y)-tab(b)) / (1+tan(y)*tan(b)) )
+			y        = b + atan( (x-tab(b)) / (1+x*tan(b)) )
+
+			let b = pi/4
+			tan(b) = tan(pi/4) = 1
+			y = pi/4 + atan( (x-1)/(1+x) )
+
+			so
+			atac(x) = pi/4 + atan( (x-1)/(1+x) )
+			when x->1 (x converges to 1) the (x-1)/(1+x) -> 0
+			and we can use ATan0() function here
+		*/
+
+		ValueType n(x),d(x),one,result;
+
+		one.SetOne();
+		n.Sub(one);
+		d.Add(one);
+		n.Div(d);
+
+		result = ATan0(n);
+
+		n.Set05Pi();
+		n.exponent.SubOne(); // =pi/4
+		result.Add(n);
+
+	return result;
+	}
+
+
+	/*!
+		an auxiliary function for calculating the Arc Tangent
+		where x > 1
+
+		we're using the formula:
+		atan(x) = pi/2 - atan(1/x) for x>0
+	*/
+	template<class ValueType>
+	ValueType ATanGreaterThanPlusOne(const ValueType & x)
+	{
+	ValueType temp, atan;
+
+		temp.SetOne();
+		
+		if( temp.Div(x) )
+		{
+			// if there was a carry here that means x is very big
+			// and atan(1/x) fast converged to 0
+			atan.SetZero();
+		}
+		else
+			atan = ATan01(temp);
+		
+		temp.Set05Pi();
+		temp.Sub(atan);
+
+	return temp;
+	}
+
+	} // namespace auxiliaryfunctions
+
+
+	/*!
+		this function calculates the Arc Tangent
+
+		the result is stored in 'result', x can be the same object as result
+	*/
+	template<class ValueType>
+	ErrorCode ATan(const ValueType & x, ValueType & result)
+	{
+	using namespace auxiliaryfunctions;
+
+		ValueType one;
+		one.SetOne();
+		bool change_sign = false;
+
+		if( x.IsNan() )
+		{
+			result.SetNan();
+
+		return err_improper_argument;
+		}
+
+		result = x;
+
+		// if x is negative we're using the formula:
+		// atan(-x) = -atan(x)
+		if( result.IsSign() )
+		{
+			change_sign = true;
+			result.Abs();
+		}
+
+		if( result.GreaterWithoutSignThan(one) )
+			result = ATanGreaterThanPlusOne(result);
+		else
+			result = ATan01(result);
+
+		if( change_sign )
+			result.ChangeSign();
+
+	return err_ok;
+	}
+
+
+	/*!
+		this function calculates the Arc Tangent
+	*/
+	template<class ValueType>
+	ValueType ATan(const ValueType & x)
+	{
+	ValueType result;
+
+		ATan(x, result);
+
+	return result;
+	}
+
+
+	/*!
+		this function calculates the Arc Tangent
+		look at the description of ATan(...)
+
+		(the abbreviation of Arc Tangent can be 'atg' as well)
+	*/
+	template<class ValueType>
+	ValueType ATg(const ValueType & x)
+	{
+		return ATan(x);
+	}
+
+
+	/*!
+		this function calculates the Arc Cotangent
+	
+		we're using the formula:
+		actan(x) = pi/2 - atan(x)
+
+		the result is stored in 'result', x can be the same object as result
+	*/
+	template<class ValueType>
+	ErrorCode ACot(const ValueType & x, ValueType & result)
+	{
+	ValueType atan_x;
+
+		ErrorCode err = ATan(x, atan_x);
+
+		result.Set05Pi();
+		result.Sub(atan_x);
+
+	return err;
+	}
+
+
+	/*!
+		this function calculates the Arc Cotangent
+	
+		we're using the formula:
+		actan(x) = pi/2 - atan(x)
+	*/
+	template<class ValueType>
+	ValueType ACot(const ValueType & x)
+	{
+	ValueType result;
+
+		ACot(x, result);
+
+	return result;
+	}
+
+
+	/*!
+		this function calculates the Arc Cotangent
+		look at the description of ACot(...)
+
+		(the abbreviation of Arc Cotangent can be 'actg' as well)
+	*/
+	template<class ValueType>
+	ValueType ACtg(const ValueType & x)
+	{
+		return ACot(x);
+	}
+
+
+	/*
+ 	 *
+	 *  hyperbolic functions
+	 *
+	 *
+	 */
+
+
+	namespace auxiliaryfunctions
+	{
+
+	/*!
+		an auxiliary function for calculating the Hyperbolic Sine and Cosine
+		(you don't have to call this function)
+
+		it calculates sinh(|x|) and cosh(|x|)
+		(x can be the same object as sinh_x or cosh_x)
+
+		we're halving the argument: u = |x| / 2^k (k is about sqrt(bits) and if |x|
+		is greater than one then k is increased by the binary exponent of |x|),
+		sinh(u) and h(u) = cosh(u) - 1 are calculated from the Taylor series:
+			sinh(u) = u + u^3/3! + u^5/5! + ...
+			h(u)    = u^2/2! + u^4/4! + u^6/6! + ...
+		and then k times:
+			sinh(2u) = 2 * sinh(u) * (1 + h(u))
+			h(2u)    = 2 * sinh(u)^2
+		(all values are positive so there is no subtraction of near values,
+		beforehand e^x - e^(-x) lost the precision for small x)
+
+		the calculations are made with one more word of the mantissa,
+		a carry is returned if the result is too big (or if x is NaN)
+	*/
+	template<uint exp, uint man>
+	uint SinhCoshAbs(const Big<exp,man> & x, Big<exp,man> & sinh_x, Big<exp,man> & cosh_x)
+	{
+	Big<exp,man+1> u, s, h, term, old_h, one;
+	uint k, i, c = 0;
+
+		// FromBig() doesn't set the mantissa and the exponent of NaN
+		if( x.IsNan() )
+			return 1;
+
+		u.FromBig(x);
+		u.Abs();
+		one.SetOne();
+
+		// if |x| >= 2^(exp*TTMATH_BITS_PER_UINT) then e^|x| cannot be stored
+		if( !u.IsZero() && u.exponent > sint(exp*TTMATH_BITS_PER_UINT) - sint((man+1)*TTMATH_BITS_PER_UINT) )
+			return 1;
+
+		for(k=0 ; k*k < man*TTMATH_BITS_PER_UINT ; ++k);
+
+		if( u.IsZero() || u.exponent < -sint(k + (man+1)*TTMATH_BITS_PER_UINT) )
+		{
+			k = 0;
+		}
+		else
+		{
+			// u < 2^e
+			sint e = u.exponent.ToInt() + sint((man+1)*TTMATH_BITS_PER_UINT);
+			k = (sint(k) + e > 0) ? uint(sint(k) + e) : 0;
+			u.exponent.SubInt(k);
+		}
+
+		s = u;
+		h.SetZero();
+		term = u;
+
+		for(i=2 ; i<=TTMATH_ARITHMETIC_MAX_LOOP ; ++i)
+		{
+			// term = u^i / i!
+			term.Mul(u);
+			term.DivUInt(i);
+
+			if( (i & 1) == 1 )
+			{
+				s.Add(term);
+			}
+			else
+			{
+				old_h = h;
+				h.Add(term);
+
+				// h is smaller than s so the next terms don't change s either
+				if( h == old_h )
+					break;
+			}
+		}
+
+		for(i=0 ; i<k && c==0 ; ++i)
+		{
+			// term = cosh(u)
+			term = one;
+			c += term.Add(h);
+
+			h = s;
+			c += h.Mul(s);
+			c += h.exponent.AddOne();
 
-			tan(y-b) = (tan(y)-tab(b)) / (1+tan(y)*tan(b))
-			y-b      = atan( (tan(y)-tab(b)) / (1+tan(y)*tan(b)) )
-			y        = b + atan( (x-tab(b)) / (1+x*tan(b)) )
+			c += s.Mul(term);
+			c += s.exponent.AddOne();
+		}
 
-			let b = pi/4
-			tan(b) = tan(pi/4) = 1
-			y = pi/4 + atan( (x-1)/(1+x) )
+		term = one;
+		c += term.Add(h);
 
-			so
-			atac(x) = pi/4 + atan( (x-1)/(1+x) )
-			when x->1 (x converges to 1) the (x-1)/(1+x) -> 0
-			and we can use ATan0() function here
-		*/
+		c += sinh_x.FromBig(s, round_nearest_even);
+		c += cosh_x.FromBig(term, round_nearest_even);
 
-		ValueType n(x),d(x),one,result;
+	return c;
+	}
 
-		one.SetOne();
-		n.Sub(one);
-		d.Add(one);
-		n.Div(d);
 
-		result = ATan0(n);
+	/*!
+		an auxiliary function for calculating the Hyperbolic Tangent and Cotangent
+		(you don't have to call this function) 
 
-		n.Set05Pi();
-		n.exponent.SubOne(); // =pi/4
-		result.Add(n);
+		it returns true if |x| is so big that tanh(x) and coth(x) are equal to one
+		(or minus one) after rounding: for |x| >= bits (the number of bits of the mantissa)
+		|1 - tanh(|x|)| and |coth(|x|) - 1| are smaller than 2*e^(-2*|x|) < 2^(-2*bits),
+		then SinhCosh() is not called (e^|x| could not be stored)
+	*/
+	template<class ValueType>
+	bool HyperbolicIsOne(const ValueType & x)
+	{
+	ValueType bits;
 
-	return result;
+		bits = x.mantissa.Size() * TTMATH_BITS_PER_UINT;
+
+	return !x.SmallerWithoutSignThan(bits);
 	}
 
 
 	/*!
-		an auxiliary function for calculating the Arc Tangent
-		where x > 1
+		an auxiliary function for calculating the Hyperbolic Tangent and Cotangent
+		(you don't have to call this function) 
 
-		we're using the formula:
-		atan(x) = pi/2 - atan(1/x) for x>0
+		result = 1 or -1 (the sign is taken from x), x can be the same object as result
 	*/
 	template<class ValueType>
-	ValueType ATanGreaterThanPlusOne(const ValueType & x)
+	void HyperbolicOne(const ValueType & x, ValueType & result)
 	{
-	ValueType temp, atan;
+		bool negative = x.IsSign();
 
-		temp.SetOne();
-		
-		if( temp.Div(x) )
-		{
-			// if there was a carry here that means x is very big
-			// and atan(1/x) fast converged to 0
-			atan.SetZero();
-		}
-		else
-			atan = ATan01(temp);
-		
-		temp.Set05Pi();
-		temp.Sub(atan);
+		result.SetOne();
 
-	return temp;
+		if( negative )
+			result.ChangeSign();
 	}
 
 	} // namespace auxiliaryfunctions
 
 
 	/*!
-		this function calculates the Arc Tangent
+		this function calculates the Hyperbolic Sine and the Hyperbolic Cosine at once
+
+		we're using the formulas:
+			sinh(x) = ( e^x - e^(-x) ) / 2
+			cosh(x) = ( e^x + e^(-x) ) / 2
+		but both values are taken from one series (look at auxiliaryfunctions::SinhCoshAbs())
+
+		x can be the same object as sinh_x or cosh_x
 	*/
 	template<class ValueType>
-	ValueType ATan(ValueType x)
+	ErrorCode SinhCosh(const ValueType & x, ValueType & sinh_x, ValueType & cosh_x)
 	{
-	using namespace auxiliaryfunctions;
+		if( x.IsNan() )
+		{
+			sinh_x.SetNan();
+			cosh_x.SetNan();
 
-		ValueType one, result;
-		one.SetOne();
-		bool change_sign = false;
+		return err_improper_argument;
+		}
 
-		if( x.IsNan() )
-			return result; // NaN is set by default
+		bool negative = x.IsSign();
 
-		// if x is negative we're using the formula:
-		// atan(-x) = -atan(x)
-		if( x.IsSign() )
+		if( auxiliaryfunctions::SinhCoshAbs(x, sinh_x, cosh_x) )
 		{
-			change_sign = true;
-			x.Abs();
-		}
+			sinh_x.SetNan();
+			cosh_x.SetNan();
 
-		if( x.GreaterWithoutSignThan(one) )
-			result = ATanGreaterThanPlusOne(x);
-		else
-			result = ATan01(x);
+		return err_overflow;
+		}
 
-		if( change_sign )
-			result.ChangeSign();
+		if( negative && !sinh_x.IsZero() )
+			sinh_x.ChangeSign();
 
-	return result;
+	return err_ok;
 	}
 
 
 	/*!
-		this function calculates the Arc Tangent
-		look at the description of ATan(...)
+		this function calculates the Hyperbolic Sine
 
-		(the abbreviation of Arc Tangent can be 'atg' as well)
+		we're using the formula sinh(x)= ( e^x - e^(-x) ) / 2
+		(look at SinhCosh())
+
+		the result is stored in 'result', x can be the same object as result
 	*/
 	template<class ValueType>
-	ValueType ATg(const ValueType & x)
+	ErrorCode Sinh(const ValueType & x, ValueType & result)
 	{
-		return ATan(x);
+	ValueType cosh_x;
+
+		return SinhCosh(x, result, cosh_x);
 	}
 
 
 	/*!
-		this function calculates the Arc Cotangent
-	
-		we're using the formula:
-		actan(x) = pi/2 - atan(x)
+		this function calculates the Hyperbolic Sine
+
+		we're using the formula sinh(x)= ( e^x - e^(-x) ) / 2
 	*/
 	template<class ValueType>
-	ValueType ACot(const ValueType & x)
+	ValueType Sinh(const ValueType & x, ErrorCode * err = 0)
 	{
 	ValueType result;
 
-		result.Set05Pi();
-		result.Sub(ATan(x));
+		ErrorCode e = Sinh(x, result);
+
+		if( err )
+			*err = e;
 
 	return result;
 	}
 
 
 	/*!
-		this function calculates the Arc Cotangent
-		look at the description of ACot(...)
+		this function calculates the Hyperbolic Cosine
 
-		(the abbreviation of Arc Cotangent can be 'actg' as well)
+		we're using the formula cosh(x)= ( e^x + e^(-x) ) / 2
+		(look at SinhCosh())
+
+		the result is stored in 'result', x can be the same object as result
 	*/
 	template<class ValueType>
-	ValueType ACtg(const ValueType & x)
+	ErrorCode Cosh(const ValueType & x, ValueType & result)
 	{
-		return ACot(x);
-	}
-
+	ValueType sinh_x;
 
-	/*
- 	 *
-	 *  hyperbolic functions
-	 *
-	 *
-	 */
+		return SinhCosh(x, sinh_x, result);
+	}
 
 
 	/*!
-		this function calculates the Hyperbolic Sine
+		this function calculates the Hyperbolic Cosine
 
-		we're using the formula sinh(x)= ( e^x - e^(-x) ) / 2
+		we're using the formula cosh(x)= ( e^x + e^(-x) ) / 2
 	*/
 	template<class ValueType>
-	ValueType Sinh(const ValueType & x, ErrorCode * err = 0)
+	ValueType Cosh(const ValueType & x, ErrorCode * err = 0)
 	{
-		if( x.IsNan() )
-		{
-			if( err )
-				*err = err_improper_argument;
-
-		return x; // NaN
-		}
-
-		ValueType ex, emx;
-		uint c = 0;
-
-		c += ex.Exp(x);
-		c += emx.Exp(-x);
+	ValueType result;
 
-		c += ex.Sub(emx);
-		c += ex.exponent.SubOne();
+		ErrorCode e = Cosh(x, result);
 
 		if( err )
-			*err = c ? err_overflow : err_ok;
+			*err = e;
 
-	return ex;
+	return result;
 	}
 
 
 	/*!
-		this function calculates the Hyperbolic Cosine
+		this function calculates the Hyperbolic Tangent
 
-		we're using the formula cosh(x)= ( e^x + e^(-x) ) / 2
+		we're using the formula tanh(x)= ( e^x - e^(-x) ) / ( e^x + e^(-x) )
+		(both values are taken from SinhCosh()), if |x| is greater than or equal to the number
+		of bits of the mantissa the result is 1 or -1 (e^x is not calculated)
+
+		the result is stored in 'result', x can be the same object as result
 	*/
 	template<class ValueType>
-	ValueType Cosh(const ValueType & x, ErrorCode * err = 0)
+	ErrorCode Tanh(const ValueType & x, ValueType & result)
 	{
 		if( x.IsNan() )
 		{
-			if( err )
-				*err = err_improper_argument;
+			result.SetNan();
 
-		return x; // NaN
+		return err_improper_argument;
 		}
 
-		ValueType ex, emx;
-		uint c = 0;
+		if( auxiliaryfunctions::HyperbolicIsOne(x) )
+		{
+			auxiliaryfunctions::HyperbolicOne(x, result);
 
-		c += ex.Exp(x);
-		c += emx.Exp(-x);
+		return err_ok;
+		}
 
-		c += ex.Add(emx);
-		c += ex.exponent.SubOne();
+		ValueType sinh_x, cosh_x;
 
-		if( err )
-			*err = c ? err_overflow : err_ok;
+		ErrorCode err = SinhCosh(x, sinh_x, cosh_x);
+
+		if( err != err_ok )
+		{
+			result.SetNan();
+
+		return err;
+		}
+
+		result = sinh_x;
+
+		if( result.Div(cosh_x) )
+			return err_overflow;
 
-	return ex;
+	return err_ok;
 	}
 
 
@@ -1224,31 +1919,14 @@ namespace ttmath
 	template<class ValueType>
 	ValueType Tanh(const ValueType & x, ErrorCode * err = 0)
 	{
-		if( x.IsNan() )
-		{
-			if( err )
-				*err = err_improper_argument;
-
-		return x; // NaN
-		}
-
-		ValueType ex, emx, nominator, denominator;
-		uint c = 0;
-
-		c += ex.Exp(x);
-		c += emx.Exp(-x);
+	ValueType result;
 
-		nominator = ex;
-		c += nominator.Sub(emx);
-		denominator = ex;
-		c += denominator.Add(emx);
-		
-		c += nominator.Div(denominator);
+		ErrorCode e = Tanh(x, result);
 
 		if( err )
-			*err = c ? err_overflow : err_ok;
+			*err = e;
 
-	return nominator;
+	return result;
 	}
 
 
@@ -1268,43 +1946,64 @@ namespace ttmath
 		this function calculates the Hyperbolic Cotangent
 
 		we're using the formula coth(x)= ( e^x + e^(-x) ) / ( e^x - e^(-x) )
+		(both values are taken from SinhCosh()), if |x| is greater than or equal to the number
+		of bits of the mantissa the result is 1 or -1 (e^x is not calculated)
+
+		the result is stored in 'result', x can be the same object as result
 	*/
 	template<class ValueType>
-	ValueType Coth(const ValueType & x, ErrorCode * err = 0)
+	ErrorCode Coth(const ValueType & x, ValueType & result)
 	{
-		if( x.IsNan() )
+		if( x.IsNan() || x.IsZero() )
 		{
-			if( err )
-				*err = err_improper_argument;
+			result.SetNan();
 
-		return x; // NaN
+		return err_improper_argument;
 		}
 
-		if( x.IsZero() )
+		if( auxiliaryfunctions::HyperbolicIsOne(x) )
 		{
-			if( err )
-				*err = err_improper_argument;
+			auxiliaryfunctions::HyperbolicOne(x, result);
 
-			return ValueType(); // NaN is set by default
+		return err_ok;
 		}
 
-		ValueType ex, emx, nominator, denominator;
-		uint c = 0;
+		ValueType sinh_x, cosh_x;
 
-		c += ex.Exp(x);
-		c += emx.Exp(-x);
+		ErrorCode err = SinhCosh(x, sinh_x, cosh_x);
 
-		nominator = ex;
-		c += nominator.Add(emx);
-		denominator = ex;
-		c += denominator.Sub(emx);
-		
-		c += nominator.Div(denominator);
+		if( err != err_ok )
+		{
+			result.SetNan();
+
+		return err;
+		}
+
+		result = cosh_x;
+
+		if( result.Div(sinh_x) )
+			return err_overflow;
+
+	return err_ok;
+	}
+
+
+	/*!
+		this function calculates the Hyperbolic Cotangent
+
+		we're using the formula coth(x)= ( e^x + e^(-x) ) / ( e^x - e^(-x) )
+	*/
+	template<class ValueType>
+	ValueType Coth(const ValueType & x, ErrorCode * err = 0)
+	{
+	ValueType result;
+
+		ErrorCode e = Coth(x, result);
 
 		if( err )
-			*err = c ? err_overflow : err_ok;
+			*err = e;
 
-	return nominator;
+	return result;
 	}
 
 
@@ -1831,37 +2530,46 @@ namespace ttmath
 		this function calculates the square root
 
 		Sqrt(9) = 3
+
+		the result is stored in 'result', x can be the same object as result
+		(the result is correctly rounded to the nearest value)
 	*/
 	template<class ValueType>
-	ValueType Sqrt(ValueType x, ErrorCode * err = 0)
+	ErrorCode Sqrt(const ValueType & x, ValueType & result)
 	{
 		if( x.IsNan() || x.IsSign() )
 		{
-			if( err )
-				*err = err_improper_argument;
+			result.SetNan();
 
-		return ValueType(); // NaN is set by default
+		return err_improper_argument;
 		}
 
-		if( x.IsZero() )
-		{
-			// Sqrt(0) = 0
-			if( err )
-				*err = err_ok;
+		result = x;
 
-		return x;
-		}
+		// the root is calculated on integers from the mantissa (look at Big::Sqrt())
+		// and it is correctly rounded
+		uint c = result.Sqrt(round_nearest_even);
+
+	return c ? err_overflow : err_ok;
+	}
+
+
+	/*!
+		this function calculates the square root
 
-		ValueType pow;
-		pow.Set05();
+		Sqrt(9) = 3
+	*/
+	template<class ValueType>
+	ValueType Sqrt(const ValueType & x, ErrorCode * err = 0)
+	{
+	ValueType result;
 
-		// PowFrac can return only a carry because x is greater than zero
-		uint c = x.PowFrac(pow);
+		ErrorCode e = Sqrt(x, result);
 
 		if( err )
-			*err = c ? err_overflow : err_ok;
+			*err = e;
 
-	return x;
+	return result;
 	}
 
 
@@ -2009,6 +2717,102 @@ namespace ttmath
 		return false;
 		}
 
+
+
+		/*!
+			it calculates the root of x (x > 0) with an integer index (index >= 2)
+			by using the Newton's method:
+				y(k+1) = ( (index-1) * y(k) + x / y(k)^(index-1) ) / index
+
+			x < 2^e and e = q*index + r (0 <= r < index) so the first value
+				y(0) = (1 + r/index) * 2^q
+			is greater than the root, we're calculating with one word of the mantissa
+			first and then with man+1 words (each step doubles the number of correct bits),
+			the sequence is decreasing and we stop when the value doesn't go down
+
+			it returns a carry if the value cannot be calculated in this way
+			(then x is not changed)
+		*/
+		template<uint exp, uint man>
+		uint RootNewton(Big<exp,man> & x, uint index)
+		{
+		Big<exp,1> x1, y1, next1, part1;
+		Big<exp,man+1> xx, y, next, part;
+		UInt<1> pow;
+		sint e, q, r;
+		uint i, c = 0;
+
+		const sint limit = sint(TTMATH_UINT_MAX_VALUE >> 2);
+
+			pow = index - 1;
+			c  += x1.FromBig(x);
+			xx.FromBig(x);
+
+			if( c || x1.exponent > limit || x1.exponent < -limit || index > uint(limit) )
+				return 1;
+
+			// y(0) = (1 + r/index) * 2^q
+			// (the division of sint is truncated toward zero, we need floor(e/index))
+			e  = x1.exponent.ToInt() + sint(TTMATH_BITS_PER_UINT);
+			q  = e / sint(index);
+			r  = e - q * sint(index);
+
+			if( r < 0 )
+			{
+				q -= 1;
+				r += sint(index);
+			}
+
+			y1 = uint(r);
+			c += y1.DivUInt(index);
+			next1.SetOne();
+			c += y1.Add(next1);
+			c += y1.exponent.Add(q);
+
+			for(i=0 ; !c && i<TTMATH_ARITHMETIC_MAX_LOOP ; ++i)
+			{
+				part1 = y1;
+				c += part1.Pow(pow);
+				next1 = x1;
+				c += next1.Div(part1);
+				part1 = y1;
+				c += part1.MulUInt(index - 1);
+				c += next1.Add(part1);
+				c += next1.DivUInt(index);
+
+				if( next1 >= y1 )
+					break;
+
+				y1 = next1;
+			}
+
+			// y1 can be a little smaller than the root (it's rounded) but after one step
+			// of the Newton's method the value is greater than the root so we don't test
+			// the first step
+			y.FromBig(y1);
+
+			for(i=0 ; !c && i<TTMATH_ARITHMETIC_MAX_LOOP ; ++i)
+			{
+				part = y;
+				c += part.Pow(pow);
+				next = xx;
+				c += next.Div(part);
+				part = y;
+				c += part.MulUInt(index - 1);
+				c += next.Add(part);
+				c += next.DivUInt(index);
+
+				if( i>0 && next >= y )
+					break;
+
+				y = next;
+			}
+
+			if( c )
+				return 1;
+
+		return x.FromBig(y, round_nearest_even);
+		}
 	}
 
 
@@ -2025,6 +2829,10 @@ namespace ttmath
 			       x^(1/index)) if x>0
 
 		(for index==1 the result is equal x)
+
+		the square root is calculated by Big::Sqrt() and for an index up to
+		TTMATH_ROOT_NEWTON_MAX_INDEX we're using the Newton's method (look at RootNewton()),
+		for a bigger index the result is x^(1/index) (Ln() and Exp())
 	*/
 	template<class ValueType>
 	ValueType Root(ValueType x, const ValueType & index, ErrorCode * err = 0)
@@ -2052,10 +2860,21 @@ namespace ttmath
 		bool change_sign;
 		if( RootCheckIndex(x, index, err, &change_sign ) ) return x;
 
-		ValueType newindex;
-		newindex.SetOne();
-		c += newindex.Div(index);
-		c += x.PowFrac(newindex); // here can only be a carry
+		uint n;
+		bool small_index = (index.ToUInt(n) == 0);
+
+		if( small_index && n == 2 )
+		{
+			c += x.Sqrt(round_nearest_even);
+		}
+		else
+		if( !small_index || n > TTMATH_ROOT_NEWTON_MAX_INDEX || RootNewton(x, n) )
+		{
+			ValueType newindex;
+			newindex.SetOne();
+			c += newindex.Div(index);
+			c += x.PowFrac(newindex); // here can only be a carry
+		}
 
 		if( change_sign )
 		{
@@ -2291,6 +3110,7 @@ namespace ttmath
 	he can only use '#include <ttmath/ttmath.h>' even if he uses the parser
 */
 #include "ttmathparser.h"
+#include "ttmathinterval.h"
 
 
 #ifdef _MSC_VER
@@ -44,12 +44,16 @@
 */
 
 #include "ttmathint.h"
+#include "ttmathbinsplit.h"
 
 #include <iostream>
 
 namespace ttmath
 {
 
+template<uint exp, uint man>
+class BigDivisor;
+
 
 /*!
 	\brief Big implements the floating point numbers
@@ -84,6 +88,20 @@ UInt<man> mantissa;
 unsigned char info;
 
 
+/*!
+	a divisor prepared for many divisions by the same value (look at BigDivisor)
+*/
+typedef BigDivisor<exp, man> Divisor;
+
+
+/*!
+	Big with another size can use the private methods
+	(e.g. Ln() calculates the AGM on two more words of the mantissa)
+*/
+template<uint another_exp, uint another_man>
+friend class Big;
+
+
 /*!
 	the number of a bit from 'info' which means that a value is with a sign
 	(when the bit is set)
@@ -166,6 +184,68 @@ private:
 	}
 
 
+	/*!
+		this method rounds the mantissa (which has already been cut)
+
+		'round_bit' is the first bit which was cut off and 'sticky_bit' is true
+		when any of the next bits was set, the sign should already be set too
+
+		it returns a carry (when the mantissa was 111...111 and the exponent
+		cannot be incremented)
+	*/
+	uint RoundMantissa(RoundingMode round, bool round_bit, bool sticky_bit)
+	{
+	bool add_one;
+
+		switch( round )
+		{
+		case round_nearest_even:
+			add_one = round_bit && (sticky_bit || (mantissa.table[0] & 1) != 0);
+			break;
+
+		case round_up:
+			add_one = !IsSign() && (round_bit || sticky_bit);
+			break;
+
+		case round_down:
+			add_one = IsSign() && (round_bit || sticky_bit);
+			break;
+
+		case round_truncate:
+		case round_toward_zero:
+		default:
+			add_one = false;
+			break;
+		}
+
+		if( !add_one || !mantissa.AddOne() )
+			return 0;
+
+		// the mantissa was 111...111 and now it's zero
+		mantissa.Rcr(1, 1);
+
+	return exponent.AddOne();
+	}
+
+
+	/*!
+		this method rounds the mantissa (which has already been cut)
+
+		'rest' is a table of the words which were cut off (the lowest word first),
+		the highest bit of rest[rest_size-1] is the round bit
+	*/
+	uint RoundMantissa(RoundingMode round, const uint * rest, uint rest_size)
+	{
+	bool sticky_bit = (rest[rest_size-1] & ~TTMATH_UINT_HIGHEST_BIT) != 0;
+	uint i;
+
+		for(i=0 ; i<rest_size-1 && !sticky_bit ; ++i)
+			sticky_bit = (rest[i] != 0);
+
+	return RoundMantissa(round, (rest[rest_size-1] & TTMATH_UINT_HIGHEST_BIT) != 0, sticky_bit);
+	}
+
+
 
 
 public:
@@ -219,9 +299,17 @@ private:
 
 	/*!
 		this method sets the mantissa of the value of pi
+		(if the mantissa is greater than the table it's calculated by BinarySplitting
+		and remembered in ConstantsCache when TTMATH_MULTITHREADS is defined)
 	*/
 	void SetMantissaPi()
 	{
+		if( man > TTMATH_BUILTIN_VARIABLES_SIZE )
+		{
+			ConstantsCache<man>::Get(ConstantsCache<man>::pi, mantissa);
+			return;
+		}
+
 	// this is a static table which represents the value of Pi (mantissa of it)
 	// (first is the highest word)
 	// we must define this table as 'unsigned int' because 
@@ -280,6 +368,10 @@ public:
 
 	/*!
 		this method sets the value of pi
+
+		if the mantissa is greater than TTMATH_BUILTIN_VARIABLES_SIZE the value is
+		calculated by BinarySplitting, it's remembered in ConstantsCache only when
+		TTMATH_MULTITHREADS is defined (otherwise it's calculated each time)
 	*/
 	void SetPi()
 	{
@@ -317,6 +409,14 @@ public:
 	*/
 	void SetE()
 	{
+		if( man > TTMATH_BUILTIN_VARIABLES_SIZE )
+		{
+			ConstantsCache<man>::Get(ConstantsCache<man>::e, mantissa);
+			exponent = -sint(man)*sint(TTMATH_BITS_PER_UINT) + 2;
+			info = 0;
+			return;
+		}
+
 	static const unsigned int temp_table[] = {
 		0xadf85458, 0xa2bb4a9a, 0xafdc5620, 0x273d3cf1, 0xd8b9c583, 0xce2d3695, 0xa9e13641, 0x146433fb, 
 		0xcc939dce, 0x249b3ef9, 0x7d2fe363, 0x630c75d8, 0xf681b202, 0xaec4617a, 0xd3df1ed5, 0xd5fd6561, 
@@ -374,6 +474,14 @@ public:
 	*/
 	void SetLn2()
 	{
+		if( man > TTMATH_BUILTIN_VARIABLES_SIZE )
+		{
+			ConstantsCache<man>::Get(ConstantsCache<man>::ln2, mantissa);
+			exponent = -sint(man)*sint(TTMATH_BITS_PER_UINT);
+			info = 0;
+			return;
+		}
+
 	static const unsigned int temp_table[] = {
 		0xb17217f7, 0xd1cf79ab, 0xc9e3b398, 0x03f2f6af, 0x40f34326, 0x7298b62d, 0x8a0d175b, 0x8baafa2b, 
 		0xe7b87620, 0x6debac98, 0x559552fb, 0x4afa1b10, 0xed2eae35, 0xc1382144, 0x27573b29, 0x1169b825, 
@@ -439,9 +547,21 @@ public:
 		inconvenience. Then if we're printing with base (radix) 10 and the mantissa
 		of our value is smaller than or equal to TTMATH_BUILTIN_VARIABLES_SIZE
 		we don't calculate the logarithm but take it from this constant.
+
+		if the mantissa is greater than TTMATH_BUILTIN_VARIABLES_SIZE the value
+		is calculated by BinarySplitting and remembered in ConstantsCache
+		when TTMATH_MULTITHREADS is defined (the same for pi, e and ln(2))
 	*/
 	void SetLn10()
 	{
+		if( man > TTMATH_BUILTIN_VARIABLES_SIZE )
+		{
+			ConstantsCache<man>::Get(ConstantsCache<man>::ln10, mantissa);
+			exponent = -sint(man)*sint(TTMATH_BITS_PER_UINT) + 2;
+			info = 0;
+			return;
+		}
+
 	static const unsigned int temp_table[] = {
 		0x935d8ddd, 0xaaa8ac16, 0xea56d62b, 0x82d30a28, 0xe28fecf9, 0xda5df90e, 0x83c61e82, 0x01f02d72, 
 		0x962f02d7, 0xb1a8105c, 0xcc70cbc0, 0x2c5f0d68, 0x2c622418, 0x410be2da, 0xfb8f7884, 0x02e516d6, 
@@ -497,6 +617,40 @@ public:
 	}
 
 
+	/*!
+		this method sets the value of sqrt(2)
+		(there is no table, the value is taken from ConstantsCache -- it's calculated
+		each time if TTMATH_MULTITHREADS is not defined)
+	*/
+	void SetSqrt2()
+	{
+		exponent = ConstantsCache<man>::Get(ConstantsCache<man>::sqrt2, mantissa);
+		info = 0;
+	}
+
+
+	/*!
+		this method sets the value of the Euler's constant (gamma = 0.5772156649...)
+		(there is no table, the value is taken from ConstantsCache)
+	*/
+	void SetEulerGamma()
+	{
+		exponent = ConstantsCache<man>::Get(ConstantsCache<man>::euler_gamma, mantissa);
+		info = 0;
+	}
+
+
+	/*!
+		this method sets the value of the Catalan's constant (G = 0.9159655941...)
+		(there is no table, the value is taken from ConstantsCache)
+	*/
+	void SetCatalan()
+	{
+		exponent = ConstantsCache<man>::Get(ConstantsCache<man>::catalan, mantissa);
+		info = 0;
+	}
+
+
 	/*!
 		this method sets the maximum value which can be held in this type
 	*/
@@ -656,85 +810,260 @@ public:
 		Addition this = this + ss2
 
 		it returns carry if the sum is too big
+		'round' - how the bits which don't fit into the mantissa are treated
 	*/
-	uint Add(Big<exp, man> ss2)
+	uint Add(const Big<exp, man> & ss2, RoundingMode round = round_truncate)
+	{
+		if( round != round_truncate )
+			return AddSub_Round(ss2, false, round);
+
+	return AddSub(ss2, false);
+	}
+
+
+	/*!
+		Subtraction this = this - ss2
+
+		it returns carry if the result is too big
+		'round' - how the bits which don't fit into the mantissa are treated
+	*/
+	uint Sub(const Big<exp, man> & ss2, RoundingMode round = round_truncate)
+	{
+		if( round != round_truncate )
+			return AddSub_Round(ss2, true, round);
+
+	return AddSub(ss2, true);
+	}
+
+
+private:
+
+	/*!
+		an auxiliary method for Add() and Sub()
+
+		the smaller value (in the sense of the absolute value) is moved to the right
+		by the difference of the exponents and then the mantissas are added or subtracted,
+		ss2 is not copied: if it's the smaller one its mantissa is moved directly
+		into a temporary table (ShiftRightVector) and only the used words are added,
+		if 'this' is the smaller one then its mantissa is moved in place
+		and the result takes the exponent and the sign of ss2
+
+		ss2 can be the same object as 'this'
+	*/
+	uint AddSub(const Big<exp, man> & ss2, bool subtract)
 	{
 	Int<exp> exp_offset( exponent );
 	Int<exp> mantissa_size_in_bits( man * TTMATH_BITS_PER_UINT );
-
 	uint c = 0;
 
 		if( IsNan() || ss2.IsNan() )
 			return CheckCarry(1);
 
+		bool ss2_sign  = (ss2.IsSign() != subtract);
+		bool same_sign = (IsSign() == ss2_sign);
+
 		exp_offset.Sub( ss2.exponent );
 		exp_offset.Abs();
 
-		// (1) abs(this) will be >= abs(ss2)
 		if( SmallerWithoutSignThan(ss2) )
 		{
-			Big<exp, man> temp(ss2);
+			// abs(this) < abs(ss2)
+			exponent = ss2.exponent;
 
-			ss2   = *this;
-			*this = temp;
+			if( ss2_sign )
+				SetSign();
+			else
+				Abs();
+
+			if( exp_offset >= mantissa_size_in_bits )
+			{
+				// 'this' is too small for taking into consideration in the sum
+				mantissa = ss2.mantissa;
+				return 0;
+			}
+
+			mantissa.Rcr( uint(exp_offset.ToInt()), 0 );
+
+			if( same_sign )
+				c = mantissa.Add(ss2.mantissa);
+			else
+				// mantissa = ss2.mantissa - mantissa
+				UInt<man>::SubVector(ss2.mantissa.table, mantissa.table, man, man, mantissa.table);
+		}
+		else
+		{
+			// abs(this) >= abs(ss2)
+			if( exp_offset >= mantissa_size_in_bits )
+				// the second value is too small for taking into consideration in the sum
+				return 0;
+
+			uint offset = uint( exp_offset.ToInt() );
+
+			if( offset == 0 )
+			{
+				if( same_sign )
+					c = mantissa.Add(ss2.mantissa);
+				else
+					mantissa.Sub(ss2.mantissa);
+			}
+			else
+			{
+				// the highest words of the moved mantissa are zero and they are skipped
+				uint words = offset / TTMATH_BITS_PER_UINT;
+				uint bits  = offset % TTMATH_BITS_PER_UINT;
+				uint size  = man - words;
+				UInt<man> ss2_mantissa;
+
+				if( bits != 0 )
+				{
+					UInt<man>::ShiftRightVector(ss2.mantissa.table + words, size, bits, ss2_mantissa.table);
+				}
+				else
+				{
+					for(uint i=0 ; i<size ; ++i)
+						ss2_mantissa.table[i] = ss2.mantissa.table[i + words];
+				}
+
+				// Add_Partial() and Sub_Partial() need the rest of the words to be zero
+				// (in the constant-time mode they work on all words)
+				for(uint i=size ; i<man ; ++i)
+					ss2_mantissa.table[i] = 0;
+
+				if( same_sign )
+					c = mantissa.Add_Partial(ss2_mantissa, size);
+				else
+					// there is no carry here because abs(this) >= abs(ss2)
+					mantissa.Sub_Partial(ss2_mantissa, size);
+			}
 		}
-	
 
+		if( c )
+		{
+			mantissa.Rcr(1,1);
+			c = exponent.AddOne();
+		}
+
+		c += Standardizing();
+
+	return CheckCarry(c);
+	}
+
+
+	/*!
+		an auxiliary method for Add() and Sub() with rounding
+
+		the mantissas are calculated with one word more (the lowest one),
+		the bits of the smaller value which don't fit even there are gathered
+		in the lowest bit (a sticky bit) -- it's enough to round the result
+		correctly in each mode
+
+		ss2 can be the same object as 'this'
+	*/
+	uint AddSub_Round(const Big<exp, man> & ss2, bool subtract, RoundingMode round)
+	{
+	UInt<man+1> man1, man2;
+	Int<exp> exp_offset;
+	Int<exp> mantissa_size_in_bits( (man+1) * TTMATH_BITS_PER_UINT );
+	uint i, c = 0;
+
+		if( IsNan() || ss2.IsNan() )
+			return CheckCarry(1);
+
+		bool ss2_sign  = (ss2.IsSign() != subtract);
+		bool same_sign = (IsSign() == ss2_sign);
+		const Big<exp, man> * big   = this;
+		const Big<exp, man> * small = &ss2;
+		bool result_sign = IsSign();
+
+		if( SmallerWithoutSignThan(ss2) )
+		{
+			big         = &ss2;
+			small       = this;
+			result_sign = ss2_sign;
+		}
+
+		man1.table[0] = 0;
+		man2.table[0] = 0;
+
+		for(i=0 ; i<man ; ++i)
+		{
+			man1.table[i+1] = big->mantissa.table[i];
+			man2.table[i+1] = small->mantissa.table[i];
+		}
+
+		exp_offset = big->exponent;
+		exp_offset.Sub( small->exponent );
+
+		if( small->IsZero() )
+		{
+			// the exponent of zero is zero so exp_offset can be negative here
+			man2.SetZero();
+		}
+		else
 		if( exp_offset >= mantissa_size_in_bits )
 		{
-			// the second value is too small for taking into consideration in the sum
-			return 0;
+			// only the sticky bit is left from the smaller value
+			man2.SetZero();
+			man2.table[0] = 1;
 		}
 		else
-		if( exp_offset < mantissa_size_in_bits )
 		{
-			// (2) moving 'exp_offset' times
-			ss2.mantissa.Rcr( exp_offset.ToInt(), 0 );
+			uint offset = uint( exp_offset.ToInt() );
+			uint words  = offset / TTMATH_BITS_PER_UINT;
+			uint bits   = offset % TTMATH_BITS_PER_UINT;
+			bool sticky_bit = bits != 0 && (man2.table[words] << (TTMATH_BITS_PER_UINT - bits)) != 0;
+
+			for(i=0 ; i<words && !sticky_bit ; ++i)
+				sticky_bit = (man2.table[i] != 0);
+
+			man2.Rcr(offset, 0);
+
+			if( sticky_bit )
+				man2.table[0] |= 1;
 		}
 
+		// 'big' can be 'this' so its exponent is changed after reading the mantissas
+		exponent = big->exponent;
 
-		if( IsSign() == ss2.IsSign() )
+		if( result_sign )
+			SetSign();
+		else
+			Abs();
+
+		if( same_sign )
 		{
-			// values have the same signs
-			if( mantissa.Add(ss2.mantissa) )
+			if( man1.Add(man2) )
 			{
-				mantissa.Rcr(1,1);
+				uint sticky_bit = man1.table[0] & 1;
+				man1.Rcr(1, 1);
+				man1.table[0] |= sticky_bit;
 				c = exponent.AddOne();
 			}
 		}
 		else
 		{
-			// values have different signs
-			// there shouldn't be a carry here because
-			// (1) (2) guarantee that the mantissa of this
-			// is greater than or equal to the mantissa of the ss2
-			
-			#ifdef TTMATH_DEBUG
-			// this is to get rid of a warning saying that c_temp is not used
-			uint c_temp = /* mantissa.Sub(ss2.mantissa); */
-			#endif
-			mantissa.Sub(ss2.mantissa);
+			// there is no carry here because abs(big) >= abs(small)
+			man1.Sub(man2);
+		}
 
-			TTMATH_ASSERT( c_temp == 0 )
+		if( man1.IsZero() )
+		{
+			SetZero();
+			return 0;
 		}
 
-		c += Standardizing();
+		c += exponent.Sub( man1.CompensationToLeft() );
 
-	return CheckCarry(c);
-	}
+		for(i=0 ; i<man ; ++i)
+			mantissa.table[i] = man1.table[i+1];
 
+		c += RoundMantissa(round, man1.table, 1);
 
-	/*!
-		Subtraction this = this - ss2
+	return CheckCarry(c);
+	}
 
-		it returns carry if the result is too big
-	*/
-	uint Sub(Big<exp, man> ss2)
-	{
-		ss2.ChangeSign();
 
-	return Add(ss2);
-	}
+public:
 		
 
 	/*!
@@ -968,22 +1297,95 @@ public:
 	}
 
 
+	/*!
+		division this = this / ss2 (ss2 is uint)
+
+		ss2 without a sign
+		it's much faster than Div() because the mantissa is divided only by one word
+		(the series in Exp(), Ln(), Sin() and others divide their terms by small integers),
+		the result is truncated as in Div() with round_truncate
+	*/
+	uint DivUInt(uint ss2)
+	{
+	UInt<man+1> man_result;
+	uint i, c = 0;
+
+		if( IsNan() || ss2 == 0 )
+			return CheckCarry(1);
+
+		if( IsZero() )
+			return 0;
+
+		// man_result = mantissa * 2^TTMATH_BITS_PER_UINT / ss2
+		// (the quotient has at least man*TTMATH_BITS_PER_UINT bits because the mantissa is standardized)
+		man_result.table[0] = 0;
+
+		for(i=0 ; i<man ; ++i)
+			man_result.table[i+1] = mantissa.table[i];
+
+		man_result.DivInt(ss2);
+		i = man_result.CompensationToLeft();
+
+		if( i )
+			c += exponent.Sub(i);
+
+		for(i=0 ; i<man ; ++i)
+			mantissa.table[i] = man_result.table[i+1];
+
+		c += Standardizing();
+
+	return CheckCarry(c);
+	}
+
+
+	/*!
+		division this = this / ss2 (ss2 is sint)
+
+		ss2 with a sign
+	*/
+	uint DivInt(sint ss2)
+	{
+		if( IsNan() || ss2 == 0 )
+			return CheckCarry(1);
+
+		if( IsZero() )
+			return 0;
+
+		if( ss2<0 )
+		{
+			ChangeSign();
+			ss2 = -ss2;
+		}
+
+	return DivUInt( uint(ss2) );
+	}
+
+
 	/*!
 		multiplication this = this * ss2
 		this method returns a carry
+
+		ss2 can be the same object as 'this' (x.Mul(x)), in such a case
+		the mantissa is squared (it's faster than the multiplication)
+
+		'round' - how the bits which don't fit into the mantissa are treated
 	*/
-	uint Mul(const Big<exp, man> & ss2)
+	uint Mul(const Big<exp, man> & ss2, RoundingMode round = round_truncate)
 	{
-	TTMATH_REFERENCE_ASSERT( ss2 )
-
 	UInt<man*2> man_result;
 	uint i,c;
 
 		if( IsNan() || ss2.IsNan() )
 			return CheckCarry(1);
 
+		// ss2 can be *this so we need a copy of its exponent
+		Int<exp> ss2_exponent(ss2.exponent);
+
 		// man_result = mantissa * ss2.mantissa
-		mantissa.MulBig(ss2.mantissa, man_result);
+		if( this == &ss2 )
+			mantissa.SqrBig(man_result);
+		else
+			mantissa.MulBig(ss2.mantissa, man_result);
 
 		// 'i' will be from 0 to man*TTMATH_BITS_PER_UINT
 		// because mantissa and ss2.mantissa are standardized 
@@ -993,7 +1395,7 @@ public:
 		i = man_result.CompensationToLeft();
 		
 		c  = exponent.Add( man * TTMATH_BITS_PER_UINT - i );
-		c += exponent.Add( ss2.exponent );
+		c += exponent.Add( ss2_exponent );
 
 		for(i=0 ; i<man ; ++i)
 			mantissa.table[i] = man_result.table[i+man];
@@ -1010,10 +1412,126 @@ public:
 			SetSign();
 		}
 
+		if( round != round_truncate && round != round_toward_zero )
+			c += RoundMantissa(round, man_result.table, man);
+
 		c += Standardizing();
 
 	return CheckCarry(c);
 	}
+
+
+	/*!
+		multiplication and addition: this = this + ss1 * ss2
+
+		the product is not cut to 'man' words before the addition,
+		both the product and the sum are calculated with man*2 words of the mantissa
+		and the result is cut (and standardized) only once at the end,
+		so it's more accurate than: temp = ss1; temp.Mul(ss2); Add(temp);
+
+		this method returns a carry
+	*/
+	uint MulAdd(const Big<exp, man> & ss1, const Big<exp, man> & ss2)
+	{
+		return MulAddSub(ss1, ss2, false);
+	}
+
+
+	/*!
+		multiplication and subtraction: this = this - ss1 * ss2
+		(it's calculated in the same way as MulAdd())
+
+		this method returns a carry
+	*/
+	uint MulSub(const Big<exp, man> & ss1, const Big<exp, man> & ss2)
+	{
+		return MulAddSub(ss1, ss2, true);
+	}
+
+
+	/*!
+		the dot product: this = ss1[0]*ss2[0] + ss1[1]*ss2[1] + ... + ss1[len-1]*ss2[len-1]
+
+		the products and the sum are calculated with man*2 words of the mantissa
+		and the result is cut only once at the end (as in MulAdd()),
+		'this' can be one of the elements of the tables
+
+		this method returns a carry
+	*/
+	uint Dot(const Big<exp, man> * ss1, const Big<exp, man> * ss2, uint len)
+	{
+	Big<exp+1, man*2> sum, product;
+	uint i;
+
+		sum.SetZero();
+
+		for(i=0 ; i<len ; ++i)
+		{
+			if( ss1[i].IsNan() || ss2[i].IsNan() )
+				return CheckCarry(1);
+
+			MulAddSub_Product(ss1[i], ss2[i], product);
+			sum.Add(product);
+		}
+
+	return CheckCarry( FromBig(sum) );
+	}
+
+
+private:
+
+
+	/*!
+		an auxiliary method for MulAdd(), MulSub() and Dot()
+		it calculates the exact product: product = ss1 * ss2
+	*/
+	static void MulAddSub_Product(const Big<exp, man> & ss1, const Big<exp, man> & ss2, Big<exp+1, man*2> & product)
+	{
+	Int<exp+1> ss2_exponent;
+	UInt<man> ss1_mantissa(ss1.mantissa);
+
+		product.info = 0;
+
+		if( &ss1 == &ss2 )
+			ss1_mantissa.SqrBig(product.mantissa);
+		else
+			ss1_mantissa.MulBig(ss2.mantissa, product.mantissa);
+
+		// the exponent has one word more so there is no carry here
+		product.exponent.FromInt(ss1.exponent);
+		ss2_exponent.FromInt(ss2.exponent);
+		product.exponent.Add(ss2_exponent);
+
+		if( ss1.IsSign() != ss2.IsSign() )
+			product.SetSign();
+
+		product.Standardizing();
+	}
+
+
+	/*!
+		an auxiliary method for MulAdd() and MulSub()
+	*/
+	uint MulAddSub(const Big<exp, man> & ss1, const Big<exp, man> & ss2, bool subtract)
+	{
+	Big<exp+1, man*2> sum, product;
+
+		if( IsNan() || ss1.IsNan() || ss2.IsNan() )
+			return CheckCarry(1);
+
+		MulAddSub_Product(ss1, ss2, product);
+
+		if( subtract )
+			product.ChangeSign();
+
+		sum.FromBig(*this);
+		sum.Add(product);
+
+	return CheckCarry( FromBig(sum) );
+	}
+
+
+public:
 	
 
 	/*!
@@ -1021,33 +1539,76 @@ public:
 		this method returns carry (in a division carry can be as well)
 
 		(it also returns 0 if ss2 is zero)
+
+		'round' - how the bits which don't fit into the mantissa are treated
 	*/
-	uint Div(const Big<exp, man> & ss2)
+	uint Div(const Big<exp, man> & ss2, RoundingMode round = round_truncate)
 	{
 	TTMATH_REFERENCE_ASSERT( ss2 )
 
-	UInt<man*2> man1;
 	UInt<man*2> man2;
-	uint i,c = 0;
+	uint i;
 		
 		if( IsNan() || ss2.IsNan() || ss2.IsZero() )
 			return CheckCarry(1);
 
 		for(i=0 ; i<man ; ++i)
 		{
-			man1.table[i+man] = mantissa.table[i];
 			man2.table[i]     = ss2.mantissa.table[i];
+			man2.table[i+man] = 0;
 		}
 
+	return Div_Calculate(ss2, man2, round);
+	}
+
+
+	/*!
+		division this = this / ss2
+
+		the same as Div(const Big<exp, man> &) but the divisor is prepared
+		earlier (look at BigDivisor)
+	*/
+	uint Div(const BigDivisor<exp, man> & ss2, RoundingMode round = round_truncate)
+	{
+		if( IsNan() || ss2.value.IsNan() || ss2.value.IsZero() )
+			return CheckCarry(1);
+
+	return Div_Calculate(ss2.value, ss2.mantissa, round);
+	}
+
+
+private:
+
+	/*!
+		an auxiliary method for the division
+
+		man2 is the mantissa of ss2 (in the lower half of UInt<man*2>)
+		either as UInt<man*2> or as UIntDivisor<man*2>
+	*/
+	template<class DivisorType>
+	uint Div_Calculate(const Big<exp, man> & ss2, const DivisorType & man2, RoundingMode round)
+	{
+	UInt<man*2> man1, remainder;
+	uint i,c = 0;
+	bool round_bit = false, sticky_bit = false;
+
 		for(i=0 ; i<man ; ++i)
 		{
-			man1.table[i] = 0;
-			man2.table[i+man] = 0;
+			man1.table[i+man] = mantissa.table[i];
+			man1.table[i]     = 0;
 		}
 
-		man1.Div(man2);
-
-		i = man1.CompensationToLeft();
+		if( round == round_truncate || round == round_toward_zero )
+		{
+			man1.Div(man2);
+			i = man1.CompensationToLeft();
+		}
+		else
+		{
+			man1.Div(man2, &remainder);
+			i = man1.CompensationToLeft();
+			Div_RoundBits(ss2, man1, remainder, i, round_bit, sticky_bit);
+		}
 
 		if( i )
 			c += exponent.Sub(i);
@@ -1062,12 +1623,53 @@ public:
 		else
 			SetSign(); // if there is a zero it will be corrected in Standardizing()
 
+		if( round != round_truncate && round != round_toward_zero )
+			c += RoundMantissa(round, round_bit, sticky_bit);
+
 		c += Standardizing();
 
 	return CheckCarry(c);
 	}
 
 
+	/*!
+		an auxiliary method for the division with rounding
+
+		the quotient has man*TTMATH_BITS_PER_UINT or one bit more (both mantissas
+		are standardized), in the latter case its lowest bit has been moved
+		into the lower half of man1 and it's the round bit, in the former case
+		the round bit is taken from the remainder: remainder/ss2 >= 1/2
+	*/
+	void Div_RoundBits(	const Big<exp, man> & ss2, const UInt<man*2> & man1,
+						const UInt<man*2> & remainder, uint compensation,
+						bool & round_bit, bool & sticky_bit)
+	{
+	UInt<man> rem, rest;
+	uint i;
+
+		if( compensation < man * TTMATH_BITS_PER_UINT )
+		{
+			round_bit  = (man1.table[man-1] & TTMATH_UINT_HIGHEST_BIT) != 0;
+			sticky_bit = !remainder.IsZero();
+			return;
+		}
+
+		// the remainder is smaller than the mantissa of ss2 so it has at most 'man' words
+		for(i=0 ; i<man ; ++i)
+			rem.table[i] = remainder.table[i];
+
+		rest = ss2.mantissa;
+		rest.Sub(rem);
+
+		// rest = ss2.mantissa - rem
+		round_bit  = rem >= rest;
+		sticky_bit = round_bit ? rem != rest : !rem.IsZero();
+	}
+
+
+public:
+
+
 	/*!
 		the remainder from a division
 
@@ -1084,16 +1686,45 @@ public:
 	{
 	TTMATH_REFERENCE_ASSERT( ss2 )
 
-	uint c = 0;
-
 		if( IsNan() || ss2.IsNan() )
 			return CheckCarry(1);
 
+	return Mod_Calculate(ss2, ss2);
+	}
+
+
+	/*!
+		the remainder from a division
+
+		the same as Mod(const Big<exp, man> &) but the divisor is prepared
+		earlier (look at BigDivisor)
+	*/
+	uint Mod(const BigDivisor<exp, man> & ss2)
+	{
+		if( IsNan() || ss2.value.IsNan() )
+			return CheckCarry(1);
+
+	return Mod_Calculate(ss2.value, ss2);
+	}
+
+
+private:
+
+	/*!
+		an auxiliary method for calculating the remainder
+
+		divisor is either ss2 or BigDivisor prepared from ss2
+	*/
+	template<class DivisorType>
+	uint Mod_Calculate(const Big<exp, man> & ss2, const DivisorType & divisor)
+	{
+	uint c = 0;
+
 		if( !SmallerWithoutSignThan(ss2) )
 		{
 			Big<exp, man> temp(*this);
 
-			c = temp.Div(ss2);
+			c = temp.Div(divisor);
 			temp.SkipFraction();
 			c += temp.Mul(ss2);
 			c += Sub(temp);
@@ -1106,6 +1737,9 @@ public:
 	}
 
 
+public:
+
+
 
 
 	/*!
@@ -1132,7 +1766,7 @@ public:
 			return 2;
 		}
 
-		Big<exp, man> start(*this), start_temp;
+		Big<exp, man> start(*this);
 		Big<exp, man> result;
 		result.SetOne();
 		uint c = 0;
@@ -1146,8 +1780,7 @@ public:
 			if( pow.IsZero() )
 				break;
 
-			start_temp = start;
-			c += start.Mul(start_temp);
+			c += start.Mul(start);
 		}
 
 		*this = result;
@@ -1239,7 +1872,7 @@ public:
 		if( pow.IsSign() )
 			pow.Abs();
 
-		Big<exp, man> start(*this), start_temp;
+		Big<exp, man> start(*this);
 		Big<exp, man> result;
 		Big<exp, man> one;
 		Int<exp> e_one;
@@ -1259,8 +1892,7 @@ public:
 			if( pow < one )
 				break;
 
-			start_temp = start;
-			c += start.Mul(start_temp);
+			c += start.Mul(start);
 		}
 
 		*this = result;
@@ -1366,21 +1998,90 @@ public:
 				return 2;
 			}
 
-			SetZero();
+			SetZero();
+
+		return 0;
+		}
+
+		if( pow.exponent>-int(man*TTMATH_BITS_PER_UINT) && pow.exponent<=0 )
+		{
+			Big<exp, man> pow_frac( pow );
+			pow_frac.RemainFraction();
+
+			if( pow_frac.IsZero() )
+				return PowInt( pow );
+		}
+
+	return PowFrac(pow);
+	}
+
+
+	/*!
+		square root this = sqrt(this)
+
+		the root is calculated on integers from the mantissa (look at UInt::Sqrt()):
+			this = mantissa * 2^exponent = value * 2^(2*e)
+		where value = mantissa * 2^(man*TTMATH_BITS_PER_UINT) or
+		mantissa * 2^(man*TTMATH_BITS_PER_UINT-1) when the exponent is odd,
+		so the root of value has exactly man*TTMATH_BITS_PER_UINT bits
+
+		it returns 1 (and sets NaN) if this is negative
+		'round' - how the bits which don't fit into the mantissa are treated
+		(the rest value - root^2 tells us whether the next bit is set)
+	*/
+	uint Sqrt(RoundingMode round = round_truncate)
+	{
+	UInt<man*2> value, rest, square;
+	uint i, c = 0;
+
+		if( IsNan() || IsSign() )
+			return CheckCarry(1);
+
+		if( IsZero() )
+			return 0;
+
+		for(i=0 ; i<man ; ++i)
+		{
+			value.table[i]     = 0;
+			value.table[i+man] = mantissa.table[i];
+		}
+
+		bool odd = exponent.IsTheLowestBitSet();
 
-		return 0;
+		// exponent = floor(exponent / 2)
+		exponent.Rcr(1, exponent.IsSign() ? 1 : 0);
+
+		if( odd )
+		{
+			value.Rcr(1);
+			c += exponent.Sub( sint(man*TTMATH_BITS_PER_UINT/2 - 1) );
+		}
+		else
+		{
+			c += exponent.Sub( sint(man*TTMATH_BITS_PER_UINT/2) );
 		}
 
-		if( pow.exponent>-int(man*TTMATH_BITS_PER_UINT) && pow.exponent<=0 )
+		rest = value;
+		value.Sqrt();
+
+		for(i=0 ; i<man ; ++i)
+			mantissa.table[i] = value.table[i];
+
+		if( round != round_truncate && round != round_toward_zero )
 		{
-			Big<exp, man> pow_frac( pow );
-			pow_frac.RemainFraction();
+			// the exact root is mantissa + f where 0 <= f < 1
+			// f >= 1/2 when rest > mantissa because (mantissa + 1/2)^2 = mantissa^2 + mantissa + 1/4
+			// (f cannot be equal to 1/2)
+			mantissa.SqrBig(square);
+			rest.Sub(square);
 
-			if( pow_frac.IsZero() )
-				return PowInt( pow );
+			bool round_bit  = rest > value;
+			bool sticky_bit = round_bit || !rest.IsZero();
+
+			c += RoundMantissa(round, round_bit, sticky_bit);
 		}
 
-	return PowFrac(pow);
+	return CheckCarry(c);
 	}
 
 
@@ -1394,19 +2095,16 @@ public:
 		Exponent this = exp(x) = e^x where x is in (-1,1)
 
 		we're using the formula exp(x) = 1 + (x)/(1!) + (x^2)/(2!) + (x^3)/(3!) + ...
+		(the next part is calculated from the previous one: next_part * x / i
+		and the division is only by one word - look at DivUInt())
 	*/
 	void ExpSurrounding0(const Big<exp,man> & x, uint * steps = 0)
 	{
 		TTMATH_REFERENCE_ASSERT( x )
 
-		Big<exp,man> denominator, denominator_i;
-		Big<exp,man> one, old_value, next_part;
-		Big<exp,man> numerator = x;
+		Big<exp,man> old_value, next_part = x;
 		
 		SetOne();
-		one.SetOne();
-		denominator.SetOne();
-		denominator_i.SetOne();
 
 		uint i;
 		old_value = *this;
@@ -1420,14 +2118,6 @@ public:
 		{
 			bool testing = ((i & 3) == 0); // it means '(i % 4) == 0'
 
-			next_part = numerator;
-
-			if( next_part.Div( denominator ) )
-				// if there is a carry here we only break the loop 
-				// however the result we return as good
-				// it means there are too many parts of the formula
-				break;
-
 			// there shouldn't be a carry here
 			Add( next_part );
 
@@ -1441,15 +2131,13 @@ public:
 					old_value = *this;
 			}
 
-			// we set the denominator and the numerator for a next part of the formula
-			if( denominator_i.Add(one) )
+			// we set the next part of the formula: next_part = next_part * x / (i+1)
+			if( next_part.Mul(x) )
 				// if there is a carry here the result we return as good
+				// it means there are too many parts of the formula
 				break;
 
-			if( denominator.Mul(denominator_i) )
-				break;
-
-			if( numerator.Mul(x) )
+			if( next_part.DivUInt(i+1) )
 				break;
 		}
 
@@ -1457,6 +2145,42 @@ public:
 			*steps = i;
 	}
 
+
+	/*!
+		Exponent this = exp(x) = e^x by using the Newton's method
+
+		the first approximation y is calculated with the half of the mantissa
+		(recursively) and then one step is made:
+			y = y * (1 + x - ln(y))
+		which doubles the number of correct bits
+	*/
+	uint ExpNewton(const Big<exp,man> & x)
+	{
+	Big<exp,man/2+1> half, half_x;
+	Big<exp,man> x_(x), ln_y, one;
+	uint c = 0;
+
+		// x_ is a copy because 'x' can be 'this'
+		half_x.FromBig(x_);
+		c += half.Exp(half_x);
+		c += FromBig(half);
+
+		if( c || IsZero() )
+			// an overflow or the result is too small
+			return CheckCarry(c);
+
+		// there can't be an error because 'this' is greater than zero
+		ln_y.Ln(*this);
+
+		one.SetOne();
+		ln_y.ChangeSign();
+		c += ln_y.Add(x_);
+		c += ln_y.Add(one);
+		c += Mul(ln_y);
+
+	return CheckCarry(c);
+	}
+
 public:
 
 
@@ -1484,6 +2208,9 @@ public:
 		return 0;
 		}
 
+		if( man >= TTMATH_USE_NEWTON_EXP_FROM_SIZE )
+			return ExpNewton(x);
+
 		// m will be the value of the mantissa in range (-1,1)
 		Big<exp,man> m(x);
 		m.exponent = -sint(man*TTMATH_BITS_PER_UINT);
@@ -1547,10 +2274,12 @@ public:
 
 		we're using the formula:
 		ln x = 2 * [ (x-1)/(x+1) + (1/3)((x-1)/(x+1))^3 + (1/5)((x-1)/(x+1))^5 + ... ]
+		(the denominators are small so we're dividing only by one word - DivUInt())
 	*/
 	void LnSurrounding1(const Big<exp,man> & x, uint * steps = 0)
 	{
-		Big<exp,man> old_value, next_part, denominator, one, two, x1(x), x2(x);
+		Big<exp,man> old_value, next_part, one, x1(x), x2(x);
+		uint denominator = 1;
 
 		one.SetOne();
 
@@ -1561,16 +2290,13 @@ public:
 			return;
 		}
 
-		two = 2;
-
 		x1.Sub(one);
 		x2.Add(one);
 
 		x1.Div(x2);
 		x2 = x1;
-		x2.Mul(x1);
+		x2.Mul(x2);
 
-		denominator.SetOne();
 		SetZero();
 
 		old_value = *this;
@@ -1588,7 +2314,7 @@ public:
 
 			next_part = x1;
 
-			if( next_part.Div(denominator) )
+			if( next_part.DivUInt(denominator) )
 				// if there is a carry here we only break the loop 
 				// however the result we return as good
 				// it means there are too many parts of the formula
@@ -1611,8 +2337,7 @@ public:
 				// if there is a carry here the result we return as good
 				break;
 
-			if( denominator.Add(two) )
-				break;
+			denominator += 2;
 		}
 
 		// this = this * 2
@@ -1624,6 +2349,119 @@ public:
 	}
 
 
+	/*!
+		this = sqrt(a * b) where a and b are greater than zero
+		(used by LnAgm(), the root is calculated on integers by BinarySplitting::SqrtInt())
+	*/
+	void SqrtOfProduct(const Big<exp,man> & a, const Big<exp,man> & b)
+	{
+	DynInt product(a.mantissa), temp(b.mantissa);
+	Int<exp> e(a.exponent);
+
+		product.Mul(temp);
+		e.Add(b.exponent);
+
+		if( (e.table[0] & 1) != 0 )
+		{
+			// the exponent must be even
+			product.ShiftLeft(1);
+			e.SubOne();
+		}
+
+		BinarySplitting::SqrtInt(product);
+		e.Rcr(1, e.IsSign() ? 1 : 0);
+
+		uint bits = BinarySplitting::BitLength(product);
+
+		if( bits > man*TTMATH_BITS_PER_UINT )
+		{
+			product.ShiftRight(bits - man*TTMATH_BITS_PER_UINT);
+			e.AddInt(bits - man*TTMATH_BITS_PER_UINT);
+		}
+
+		mantissa.SetZero();
+
+		for(uint i=0 ; i<product.Size() ; ++i)
+			mantissa.table[i] = product.Table()[i];
+
+		exponent = e;
+		info = 0;
+		Standardizing();
+	}
+
+
+	/*!
+		Natural logarithm this = ln(x) where x in range <1,2)
+
+		we're using the arithmetic-geometric mean:
+			ln(s) = pi / (2 * AGM(1, 4/s)) + error,  |error| < 4/s^2 * (8 + ln(s))
+		where s = x * 2^k is big enough (s^2 is greater than 2^(bits of the mantissa)),
+		then ln(x) = ln(s) - k*ln(2)
+
+		the calculation is made on two more words of the mantissa because
+		ln(s) and k*ln(2) are much greater than the result,
+		when x is very near one the series from LnSurrounding1() is used
+		(it needs only a few steps then)
+	*/
+	void LnAgm(const Big<exp,man> & x)
+	{
+	Big<exp,man> one;
+
+		one.SetOne();
+		*this = x;
+		Sub(one);
+
+		if( IsZero() || exponent < -sint((man+1)*TTMATH_BITS_PER_UINT) )
+		{
+			// x - 1 < 2^(-TTMATH_BITS_PER_UINT)
+			LnSurrounding1(x);
+			return;
+		}
+
+	Big<exp,man+2> a, b, pi, ln2, k_ln2;
+	Int<exp> limit;
+	uint bits = (man+2) * TTMATH_BITS_PER_UINT;
+	uint k    = bits / 2 + 2;
+
+		// a = 1, b = 4 / (x * 2^k)
+		a.FromBig(x);
+		b.SetOne();
+		b.Div(a);
+		b.exponent.SubInt(k - 2);
+		a.SetOne();
+
+		for(uint i=0 ; i<TTMATH_ARITHMETIC_MAX_LOOP ; ++i)
+		{
+			k_ln2 = a;
+			k_ln2.Sub(b);
+
+			// when |a-b| < a * 2^(-bits/2) the next arithmetic mean is the result
+			limit = a.exponent;
+			limit.SubInt(bits / 2);
+			bool last = k_ln2.IsZero() || k_ln2.exponent < limit;
+
+			k_ln2 = a;
+			a.Add(b);
+			a.exponent.SubOne();
+
+			if( last )
+				break;
+
+			b.SqrtOfProduct(k_ln2, b);
+		}
+
+		// ln(x) = pi / (2*a) - k*ln(2)
+		pi.SetPi();
+		a.exponent.AddOne();
+		pi.Div(a);
+
+		ln2.SetLn2();
+		k_ln2 = k;
+		k_ln2.Mul(ln2);
+		pi.Sub(k_ln2);
+
+		FromBig(pi);
+	}
 
 
 public:
@@ -1663,7 +2501,10 @@ public:
 		Big<exp,man> m(x);
 		m.exponent = -sint(man*TTMATH_BITS_PER_UINT - 1);
 
-	    LnSurrounding1(m);
+		if( man >= TTMATH_USE_AGM_LOGARITHM_FROM_SIZE )
+			LnAgm(m);
+		else
+			LnSurrounding1(m);
 
 		Big<exp,man> exponent_temp;
 		exponent_temp.FromInt( x.exponent );
@@ -1745,9 +2586,12 @@ public:
 
 	/*!
 		converting from another type of a Big object
+
+		'round' - how the bits which don't fit into the mantissa are treated
+		(when 'another' has a greater mantissa)
 	*/
 	template<uint another_exp, uint another_man>
-	uint FromBig(const Big<another_exp, another_man> & another)
+	uint FromBig(const Big<another_exp, another_man> & another, RoundingMode round = round_truncate)
 	{
 		info = another.info;
 
@@ -1794,6 +2638,9 @@ public:
 		#pragma warning( default: 4307 )
 		#endif
 
+		if( man < another_man && round != round_truncate && round != round_toward_zero )
+			c += RoundMantissa(round, another.mantissa.table, another_man - man);
+
 		// mantissa doesn't have to be standardized (either the highest bit is set or all bits are equal zero)
 		CorrectZero();
 
@@ -3462,6 +4309,38 @@ public:
 	}
 
 
+	/*!
+		a method for converting a string into its value with rounding
+
+		the value is correctly rounded by using 'round' (look at FromBig()),
+		the rest of parameters are the same as in FromString(const char * source, uint base, ...)
+
+		the string is converted exactly (on DynInt) when the number of significant digits
+		plus the magnitude of the exponent is not greater than TTMATH_FROMSTRING_EXACT_MAX_DIGITS,
+		for bigger strings the value is read with one word of the mantissa more and
+		moved by one unit in the last place in the direction of the rounding -- with round_up,
+		round_down and round_toward_zero the result is still on the correct side of the value
+		(but it can be one unit in the last place too far), round_nearest_even can be
+		one unit in the last place wrong then
+	*/
+	uint FromString(const char * source, RoundingMode round, uint base = 10, const char ** after_source = 0, bool * value_read = 0)
+	{
+		if( round == round_truncate )
+			return FromString(source, base, after_source, value_read);
+
+		Big<exp, man+1> temp;
+		uint c = temp.FromString(source, base, after_source, value_read);
+
+		if( c == 0 && !FromString_Exact(source, base, temp) )
+			c += FromString_MoveOutward(temp, round);
+
+		// FromBig() sets NaN if 'temp' is NaN
+		c += FromBig(temp, round);
+
+	return CheckCarry(c);
+	}
+
+
 
 private:
 
@@ -3694,6 +4573,200 @@ private:
 	}
 
 
+	/*!
+		this method reads the string (which has already been parsed by FromString())
+		once more and collects its significant digits: value = digits * base^exponent
+
+		it returns false if there are too many digits or the exponent is too big
+		(look at TTMATH_FROMSTRING_EXACT_MAX_DIGITS)
+	*/
+	bool FromString_ReadDigits(const char * source, uint base, std::string & digits, sint & exponent, bool & is_sign)
+	{
+	bool value_read = false, scientific_read = false, scientific_sign = false;
+	uint scientific = 0;
+	uint max_digits = TTMATH_FROMSTRING_EXACT_MAX_DIGITS;
+
+		digits.clear();
+		exponent = 0;
+
+		FromString_TestSign(source, is_sign);
+		UInt<man>::SkipWhiteCharacters(source);
+
+		for( ; UInt<man>::CharToDigit(*source, base) != -1 ; ++source )
+		{
+			value_read = true;
+
+			if( !digits.empty() || *source != '0' )
+				digits += *source;
+		}
+
+		if( FromString_TestCommaOperator(source) )
+		{
+			for( ; UInt<man>::CharToDigit(*source, base) != -1 ; ++source )
+			{
+				value_read = true;
+				exponent -= 1;
+
+				if( !digits.empty() || *source != '0' )
+					digits += *source;
+
+				if( digits.size() > max_digits )
+					return false;
+			}
+		}
+
+		if( value_read && base == 10 && FromString_TestScientific(source) )
+		{
+			FromString_TestSign(source, scientific_sign);
+			UInt<man>::SkipWhiteCharacters(source);
+
+			for( sint character ; (character=UInt<man>::CharToDigit(*source, 10)) != -1 ; ++source )
+			{
+				scientific_read = true;
+
+				if( scientific <= max_digits )
+					scientific = scientific * 10 + uint(character);
+			}
+		}
+
+		// trailing zeros are moved into the exponent
+		for( ; !digits.empty() && digits[digits.size()-1] == '0' ; exponent += 1 )
+			digits.erase(digits.size()-1);
+
+		if( scientific_read )
+		{
+			if( scientific > max_digits )
+				return false;
+
+			exponent += scientific_sign ? -sint(scientific) : sint(scientific);
+		}
+
+		uint exponent_abs = (exponent < 0) ? uint(-exponent) : uint(exponent);
+
+	return digits.size() <= max_digits && exponent_abs <= max_digits - digits.size();
+	}
+
+
+	/*!
+		this method converts the string exactly into 'result' which has one word
+		of the mantissa more: the mantissa is standardized and the lowest bit is set
+		if some non zero bits were cut off (that bit only tells FromBig()
+		that the value is greater than the mantissa)
+
+		it returns false if the string is too big to be converted in this way
+		(then 'result' is not changed)
+	*/
+	bool FromString_Exact(const char * source, uint base, Big<exp, man+1> & result)
+	{
+	std::string digits;
+	sint exponent;
+	bool is_sign;
+
+		if( !FromString_ReadDigits(source, base, digits, exponent, is_sign) )
+			return false;
+
+		if( digits.empty() )
+		{
+			result.SetZero();
+			return true;
+		}
+
+		DynInt value, power(uint(1)), base_power(base), rest, test;
+		uint bits = (man + 1) * TTMATH_BITS_PER_UINT;
+		uint exponent_abs = (exponent < 0) ? uint(-exponent) : uint(exponent);
+		sint binary_exponent = 0;
+		bool sticky = false;
+
+		value.FromString(digits, base);
+
+		for( ; exponent_abs != 0 ; exponent_abs >>= 1 )
+		{
+			if( (exponent_abs & 1) != 0 )
+				power.Mul(base_power);
+
+			if( exponent_abs > 1 )
+				base_power.Mul(base_power);
+		}
+
+		if( exponent >= 0 )
+		{
+			value.Mul(power);
+		}
+		else
+		{
+			// the quotient will have at least bits+1 bits
+			sint shift = sint(bits) + sint(BinarySplitting::BitLength(power)) - sint(BinarySplitting::BitLength(value)) + 1;
+
+			if( shift > 0 )
+			{
+				value.ShiftLeft(uint(shift));
+				binary_exponent = -shift;
+			}
+
+			value.Div(power, rest);
+			sticky = !rest.IsZero();
+		}
+
+		uint value_bits = BinarySplitting::BitLength(value);
+
+		if( value_bits > bits )
+		{
+			test = value;
+			value.ShiftRight(value_bits - bits);
+			rest = value;
+			rest.ShiftLeft(value_bits - bits);
+			sticky = sticky || rest != test;
+			binary_exponent += sint(value_bits - bits);
+		}
+		else
+		{
+			value.ShiftLeft(bits - value_bits);
+			binary_exponent -= sint(bits - value_bits);
+		}
+
+		value.ToUInt(result.mantissa);
+
+		if( sticky )
+			result.mantissa.table[0] |= 1;
+
+		result.exponent = binary_exponent;
+		result.info = 0;
+
+		if( is_sign )
+			result.SetSign();
+
+	return true;
+	}
+
+
+	/*!
+		this method moves 'value' by one unit in the last place of Big<exp,man>
+		away from zero (round_up for a positive value, round_down for a negative one)
+		or towards zero (round_toward_zero, round_up for a negative value,
+		round_down for a positive one)
+
+		it's used when the string was too big to be converted exactly, the error of
+		reading with one word of the mantissa more is much smaller than this unit
+	*/
+	uint FromString_MoveOutward(Big<exp, man+1> & value, RoundingMode round)
+	{
+		if( value.IsNan() || value.IsZero() || round == round_nearest_even )
+			return 0;
+
+		Big<exp, man+1> unit(value);
+		uint c = unit.exponent.SubInt(man * TTMATH_BITS_PER_UINT);
+
+		bool away = (round == round_up && !value.IsSign()) || (round == round_down && value.IsSign());
+
+		if( away )
+			c += value.Add(unit);
+		else
+			c += value.Sub(unit);
+
+	return (c==0)? 0 : 1;
+	}
+
+
 public:
 
 
@@ -3706,6 +4779,15 @@ public:
 	}
 
 
+	/*!
+		a method for converting a string into its value with rounding
+	*/
+	uint FromString(const std::string & string, RoundingMode round, uint base = 10)
+	{
+		return FromString( string.c_str(), round, base );
+	}
+
+
 	/*!
 		a constructor for converting a string into this class
 	*/
@@ -4232,6 +5314,73 @@ public:
 };
 
 
+
+/*!
+	\brief BigDivisor is a divisor prepared for many divisions by the same value
+
+	it keeps the mantissa of the divisor as UIntDivisor<man*2> (normalized
+	and with its reciprocal), it can be used in Big::Div() and Big::Mod()
+
+	e.g.
+		Big<1,4> pi2;
+		pi2.Set2Pi();
+		BigDivisor<1,4> divisor(pi2);
+		x.Mod(divisor);
+*/
+template<uint exp, uint man>
+class BigDivisor
+{
+public:
+
+	/*!
+		the divisor
+	*/
+	Big<exp, man> value;
+
+	/*!
+		the mantissa of the divisor (in the lower half of UInt<man*2>)
+	*/
+	UIntDivisor<man*2> mantissa;
+
+
+	/*!
+		the default constructor - the divisor is NaN
+	*/
+	BigDivisor()
+	{
+	}
+
+
+	/*!
+		a constructor for converting Big into this class
+	*/
+	explicit BigDivisor(const Big<exp, man> & divisor)
+	{
+		Set(divisor);
+	}
+
+
+	/*!
+		it prepares the divisor
+	*/
+	void Set(const Big<exp, man> & divisor)
+	{
+	UInt<man*2> man2;
+	uint i;
+
+		value = divisor;
+
+		for(i=0 ; i<man ; ++i)
+		{
+			man2.table[i]     = divisor.mantissa.table[i];
+			man2.table[i+man] = 0;
+		}
+
+		mantissa.Set(man2);
+	}
+};
+
+
 } // namespace
 
 #endif
@@ -0,0 +1,778 @@
+/*
+ * This file is a part of TTMath Bignum Library
+ * and is distributed under the (new) BSD licence.
+ * Author: Tomasz Sowa <t.sowa@slimaczek.pl>
+ */
+
+/*
+ * Copyright (c) 2006-2009, Tomasz Sowa
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ *  * Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ *  * Neither the name Tomasz Sowa nor the names of contributors to this
+ *    project may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#ifndef headerfilettmathbinsplit
+#define headerfilettmathbinsplit
+
+/*!
+	\file ttmathbinsplit.h
+    \brief the binary splitting method for series (used for calculating pi, e, ln(2), ln(10) and other constants)
+*/
+
+#include "ttmathdynint.h"
+#include "ttmaththreads.h"
+
+
+namespace ttmath
+{
+
+
+/*!
+	\brief terms of a series for BinarySplitting
+
+	the series is:
+		S = sum( a(k)/b(k) * p(0)*p(1)*...*p(k) / (q(0)*q(1)*...*q(k)) )   for k = 0, 1, 2, ...
+
+	a derived class sets the values a(k), b(k), p(k) and q(k) (all of them are integers)
+*/
+class SeriesTerms
+{
+public:
+
+	virtual void Term(uint k, DynInt & a, DynInt & b, DynInt & p, DynInt & q) const = 0;
+	virtual ~SeriesTerms() {}
+};
+
+
+
+/*!
+	\brief the binary splitting method
+
+	the sum of 'n' terms of a series (look at SeriesTerms) is calculated as
+	one fraction T / (B*Q) where the terms are joined in pairs recursively:
+		P(a,c) = P(a,m) * P(m,c)
+		Q(a,c) = Q(a,m) * Q(m,c)
+		B(a,c) = B(a,m) * B(m,c)
+		T(a,c) = B(m,c) * Q(m,c) * T(a,m) + B(a,m) * P(a,m) * T(m,c)
+	so at the end there are only a few multiplications of big numbers (and they can be
+	made by the Karatsuba algorithm) instead of adding each term with the full precision
+	which is O(n^2) (ExpSurrounding0(), LnSurrounding1())
+
+	the constants are calculated with one word more and then rounded to the nearest value,
+	Big uses them when its mantissa is greater than TTMATH_BUILTIN_VARIABLES_SIZE
+	(for smaller mantissas the values are taken from the tables)
+*/
+class BinarySplitting
+{
+public:
+
+
+	/*!
+		this method calculates the terms [from, to) of the series
+		the sum of them is equal to t / (b * q)
+	*/
+	static void Split(const SeriesTerms & series, uint from, uint to, DynInt & p, DynInt & q, DynInt & b, DynInt & t)
+	{
+		if( to - from == 1 )
+		{
+			series.Term(from, t, b, p, q);
+			t.Mul(p);
+			return;
+		}
+
+		uint middle = from + (to - from) / 2;
+		DynInt p2, q2, b2, t2;
+
+		Split(series, from, middle, p, q, b, t);
+		Split(series, middle, to, p2, q2, b2, t2);
+
+		// t = b2 * q2 * t + b * p * t2
+		t.Mul(q2);
+		t.Mul(b2);
+		t2.Mul(p);
+		t2.Mul(b);
+		t.Add(t2);
+
+		p.Mul(p2);
+		q.Mul(q2);
+		b.Mul(b2);
+	}
+
+
+	/*!
+		this method calculates numerator / denominator (both must be positive)
+		and puts the result into the mantissa (rounded to the nearest value)
+
+		it returns the exponent: numerator / denominator = mantissa * 2^exponent
+	*/
+	template<uint man>
+	static sint Divide(const DynInt & numerator, const DynInt & denominator, UInt<man> & mantissa)
+	{
+	DynInt quotient(numerator), divisor(denominator);
+	sint shift = sint((man + 1) * TTMATH_BITS_PER_UINT) + sint(BitLength(divisor)) - sint(BitLength(quotient));
+
+		// quotient has (man+1)*TTMATH_BITS_PER_UINT or one bit more
+		if( shift > 0 )
+			quotient.ShiftLeft(uint(shift));
+		else
+			divisor.ShiftLeft(uint(-shift));
+
+		quotient.Div(divisor);
+
+		uint cut = BitLength(quotient) - man * TTMATH_BITS_PER_UINT;
+		sint exponent = sint(cut) - shift;
+
+		// rounding to the nearest value
+		quotient.ShiftRight(cut - 1);
+		uint round_bit = quotient.IsZero() ? 0 : (quotient.Table()[0] & 1);
+		quotient.ShiftRight(1);
+
+		if( round_bit )
+		{
+			quotient.Add( DynInt(uint(1)) );
+
+			if( BitLength(quotient) > man * TTMATH_BITS_PER_UINT )
+			{
+				quotient.ShiftRight(1);
+				exponent += 1;
+			}
+		}
+
+		quotient.ToUInt(mantissa);
+
+	return exponent;
+	}
+
+
+	/*!
+		this method calculates pi (Chudnovsky's formula)
+		and returns the exponent (pi = mantissa * 2^exponent)
+	*/
+	template<uint man>
+	static sint Pi(UInt<man> & mantissa)
+	{
+	DynInt numerator, denominator;
+
+		PiFraction((man + 1) * TTMATH_BITS_PER_UINT, numerator, denominator);
+
+	return Divide(numerator, denominator, mantissa);
+	}
+
+
+	/*!
+		this method calculates e = 1/0! + 1/1! + 1/2! + ...
+		and returns the exponent (e = mantissa * 2^exponent)
+	*/
+	template<uint man>
+	static sint E(UInt<man> & mantissa)
+	{
+	uint bits = (man + 1) * TTMATH_BITS_PER_UINT + 2;
+	uint n, log;
+	DynInt p, q, b, t;
+
+		// n! > 2^bits
+		for(n=2, log=0 ; log < bits ; ++n)
+			log += uint(UInt<1>::FindLeadingBitInWord(n));
+
+		Split(ExpSeries(), 0, n, p, q, b, t);
+		b.Mul(q);
+
+	return Divide(t, b, mantissa);
+	}
+
+
+	/*!
+		this method calculates ln(2) = 2 * atanh(1/3)
+		and returns the exponent (ln(2) = mantissa * 2^exponent)
+	*/
+	template<uint man>
+	static sint Ln2(UInt<man> & mantissa)
+	{
+	DynInt numerator, denominator;
+
+		Atanh(3, (man + 1) * TTMATH_BITS_PER_UINT + 2, numerator, denominator);
+		numerator.MulInt(2);
+
+	return Divide(numerator, denominator, mantissa);
+	}
+
+
+	/*!
+		this method calculates ln(10) = 3 * ln(2) + ln(5/4) = 6 * atanh(1/3) + 2 * atanh(1/9)
+		and returns the exponent (ln(10) = mantissa * 2^exponent)
+	*/
+	template<uint man>
+	static sint Ln10(UInt<man> & mantissa)
+	{
+	uint bits = (man + 1) * TTMATH_BITS_PER_UINT + 4;
+	DynInt numerator, denominator, numerator2, denominator2;
+
+		Atanh(3, bits, numerator,  denominator);
+		Atanh(9, bits, numerator2, denominator2);
+
+		numerator.Mul(denominator2);
+		numerator.MulInt(6);
+		numerator2.Mul(denominator);
+		numerator2.MulInt(2);
+		numerator.Add(numerator2);
+		denominator.Mul(denominator2);
+
+	return Divide(numerator, denominator, mantissa);
+	}
+
+
+	/*!
+		this method calculates sqrt(2)
+		and returns the exponent (sqrt(2) = mantissa * 2^exponent)
+	*/
+	template<uint man>
+	static sint Sqrt2(UInt<man> & mantissa)
+	{
+	uint bits = (man + 1) * TTMATH_BITS_PER_UINT;
+	DynInt root(uint(2));
+
+		root.ShiftLeft(2 * bits);
+		SqrtInt(root);
+
+	return Divide(root, DynInt(uint(1)), mantissa) - sint(bits);
+	}
+
+
+	/*!
+		this method calculates the Catalan's constant
+		and returns the exponent (G = mantissa * 2^exponent)
+
+		Ramanujan's formula:
+			G = pi/8 * ln(2 + sqrt(3)) + 3/8 * sum( (k!)^2 / ((2k)! (2k+1)^2) )
+		where ln(2 + sqrt(3)) = 2 * atanh(1/sqrt(3)) = 2/sqrt(3) * sum( 1 / (3^k (2k+1)) )
+		so:
+			G = pi * sqrt(3) / 12 * sum( 1 / (3^k (2k+1)) ) + 3/8 * sum( (k!)^2 / ((2k)! (2k+1)^2) )
+	*/
+	template<uint man>
+	static sint Catalan(UInt<man> & mantissa)
+	{
+	uint bits = (man + 1) * TTMATH_BITS_PER_UINT + 4;
+	DynInt numerator, denominator, root, p, q, b, t, p2, q2, b2, t2;
+
+		PiFraction(bits, numerator, denominator);
+
+		root = uint(3);
+		root.ShiftLeft(2 * bits);
+		SqrtInt(root);
+
+		// the terms are at least two times smaller each time
+		Split(CatalanAtanhSeries(), 0, bits + 2, p, q, b, t);
+		Split(CatalanSeries(), 0, bits + 2, p2, q2, b2, t2);
+
+		// pi * sqrt(3) * sum1 / 12 = numerator / denominator
+		numerator.Mul(root);
+		numerator.Mul(t);
+		denominator.ShiftLeft(bits);
+		denominator.Mul(b);
+		denominator.Mul(q);
+		denominator.MulInt(12);
+
+		// 3/8 * sum2 = t2 / b2
+		t2.MulInt(3);
+		b2.Mul(q2);
+		b2.MulInt(8);
+
+		numerator.Mul(b2);
+		t2.Mul(denominator);
+		numerator.Add(t2);
+		denominator.Mul(b2);
+
+	return Divide(numerator, denominator, mantissa);
+	}
+
+
+	/*!
+		this method calculates the Euler's constant (gamma)
+		and returns the exponent (gamma = mantissa * 2^exponent)
+
+		the Brent-McMillan formula with n = 2^m:
+			gamma = U/V
+			U = sum( (n^k / k!)^2 * (H(k) - ln(n)) ), V = sum( (n^k / k!)^2 )
+			H(k) = 1 + 1/2 + ... + 1/k
+		the error is about e^(-4n), the terms are calculated one by one
+		(the recurrences have only multiplications and divisions by one word):
+			B(0) = 1, A(0) = -ln(n)
+			B(k) = B(k-1) * n^2 / k^2
+			A(k) = (A(k-1) * n^2 / k + B(k)) / k
+		on fixed point numbers (DynInt multiplied by 2^bits)
+	*/
+	template<uint man>
+	static sint EulerGamma(UInt<man> & mantissa)
+	{
+	uint bits = (man + 2) * TTMATH_BITS_PER_UINT;
+	uint m, n, k;
+	DynInt a, b, u, v, ln_numerator, ln_denominator;
+
+		// 4n > bits (e^(-4n) < 2^(-bits))
+		for(m=0, n=1 ; 4*n <= bits ; ++m, n*=2);
+
+		// a = -ln(n) = -m * 2 * atanh(1/3)
+		Atanh(3, bits + 8, ln_numerator, ln_denominator);
+		a = ln_numerator;
+		a.MulInt(2 * m);
+		a.ShiftLeft(bits);
+		a.Div(ln_denominator);
+		a.ChangeSign();
+
+		b.SetOne();
+		b.ShiftLeft(bits);
+		u = a;
+		v = b;
+
+		// the terms are decreasing quickly after k = 3.6*n
+		for(k=1 ; k <= 4*n ; ++k)
+		{
+			b.MulInt(n);
+			b.MulInt(n);
+			b.DivInt(k);
+			b.DivInt(k);
+
+			a.MulInt(n);
+			a.MulInt(n);
+			a.DivInt(k);
+			a.Add(b);
+			a.DivInt(k);
+
+			u.Add(a);
+			v.Add(b);
+		}
+
+	return Divide(u, v, mantissa);
+	}
+
+
+	/*!
+		this method returns the lowest result_size words of floor(2/pi * 2^bits)
+		(used for reducing the argument of Sin() and Cos())
+
+		2/pi is calculated only once (and recalculated if more bits are needed)
+		and kept in a static object (protected by ThreadLock), without TTMATH_MULTITHREADS
+		it's calculated each time
+	*/
+	static void TwoOverPi(uint bits, uint * result, uint result_size)
+	{
+	ThreadLock lock;
+
+		if( !lock.Lock() )
+		{
+			// we're not able to use the static value
+			DynInt value;
+			TwoOverPiCalculate(bits, value);
+			CopyBits(value, 0, result, result_size);
+			return;
+		}
+
+		// the objects are initialized when the mutex is locked
+		static DynInt value;
+		static uint value_bits = 0;
+
+		if( bits > value_bits )
+		{
+			value_bits = (bits > 2 * value_bits) ? bits : 2 * value_bits;
+			TwoOverPiCalculate(value_bits, value);
+		}
+
+		CopyBits(value, value_bits - bits, result, result_size);
+	}
+
+
+	/*!
+		this method returns how many bits the magnitude of x has
+		(zero if x is zero)
+	*/
+	static uint BitLength(const DynInt & x)
+	{
+		if( x.IsZero() )
+			return 0;
+
+	return (x.Size() - 1) * TTMATH_BITS_PER_UINT + uint(UInt<1>::FindLeadingBitInWord(x.Table()[x.Size()-1])) + 1;
+	}
+
+
+	/*!
+		the integer square root: x = floor(sqrt(x))
+		(the Newton's method started above the root)
+
+		the starting value is taken from the root of the upper half of x
+		(calculated recursively) so there are only a few iterations on the whole x
+	*/
+	static void SqrtInt(DynInt & x)
+	{
+	DynInt root, next;
+	uint bits = BitLength(x);
+
+		if( bits == 0 )
+			return;
+
+		if( bits <= 4 * TTMATH_BITS_PER_UINT )
+		{
+			root.SetOne();
+			root.ShiftLeft( (bits + 1) / 2 );
+		}
+		else
+		{
+			// x = y * 2^(2*shift) + rest
+			// (floor(sqrt(y)) + 1) * 2^shift > sqrt(x)
+			uint shift = bits / 4;
+
+			root = x;
+			root.ShiftRight(2 * shift);
+			SqrtInt(root);
+			root.Add(DynInt(uint(1)));
+			root.ShiftLeft(shift);
+		}
+
+		while( true )
+		{
+			// next = (root + x / root) / 2
+			next = x;
+			next.Div(root);
+			next.Add(root);
+			next.ShiftRight(1);
+
+			if( next >= root )
+				break;
+
+			root.Swap(next);
+		}
+
+		x.Swap(root);
+	}
+
+
+private:
+
+
+	/*!
+		pi = numerator / denominator (Chudnovsky's formula)
+		with the error less than 2^(-bits)
+	*/
+	static void PiFraction(uint bits, DynInt & numerator, DynInt & denominator)
+	{
+	DynInt p, q, b, root;
+
+		// each term gives about 47 bits
+		Split(ChudnovskySeries(), 0, bits / 47 + 2, p, q, b, denominator);
+
+		// pi = 426880 * sqrt(10005) * b * q / t
+		root = uint(10005);
+		root.ShiftLeft(2 * bits);
+		SqrtInt(root);
+
+		numerator = q;
+		numerator.Mul(b);
+		numerator.Mul(root);
+		numerator.MulInt(426880);
+		denominator.ShiftLeft(bits);
+	}
+
+
+	/*!
+		value = floor(2/pi * 2^bits) (the last bit can be wrong)
+	*/
+	static void TwoOverPiCalculate(uint bits, DynInt & value)
+	{
+	DynInt numerator;
+
+		// 2/pi = 2 * denominator / numerator
+		PiFraction(bits + TTMATH_BITS_PER_UINT, numerator, value);
+		value.ShiftLeft(bits + 1);
+		value.Div(numerator);
+	}
+
+
+	/*!
+		result = the lowest result_size words of (x >> shift)
+	*/
+	static void CopyBits(const DynInt & x, uint shift, uint * result, uint result_size)
+	{
+	const uint * table = x.Table();
+	uint size  = x.Size();
+	uint words = shift / TTMATH_BITS_PER_UINT;
+	uint bits  = shift % TTMATH_BITS_PER_UINT;
+
+		for(uint i=0 ; i<result_size ; ++i, ++words)
+		{
+			uint low  = (words     < size) ? table[words]     : 0;
+			uint high = (words + 1 < size) ? table[words + 1] : 0;
+
+			result[i] = (bits == 0) ? low : ((low >> bits) | (high << (TTMATH_BITS_PER_UINT - bits)));
+		}
+	}
+
+
+	/*!
+		atanh(1/n) = sum( 1 / ((2k+1) * n^(2k+1)) ) = numerator / denominator
+		with the error less than 2^(-bits)
+	*/
+	static void Atanh(uint n, uint bits, DynInt & numerator, DynInt & denominator)
+	{
+	DynInt p, q;
+
+		// each term is at least 2^(log) times smaller than the previous one
+		uint log = uint(UInt<1>::FindLeadingBitInWord(n * n));
+
+		Split(AtanhSeries(n), 0, bits / log + 2, p, q, denominator, numerator);
+		denominator.Mul(q);
+	}
+
+
+	/*!
+		1/0! + 1/1! + 1/2! + ...
+		a(k) = 1, b(k) = 1, p(k) = 1, q(0) = 1, q(k) = k
+	*/
+	class ExpSeries : public SeriesTerms
+	{
+	public:
+
+		void Term(uint k, DynInt & a, DynInt & b, DynInt & p, DynInt & q) const
+		{
+			a.SetOne();
+			b.SetOne();
+			p.SetOne();
+			q = (k == 0) ? uint(1) : k;
+		}
+	};
+
+
+	/*!
+		atanh(1/n) = 1/n + 1/(3*n^3) + 1/(5*n^5) + ...
+		a(k) = 1, b(k) = 2k+1, p(k) = 1, q(0) = n, q(k) = n^2
+	*/
+	class AtanhSeries : public SeriesTerms
+	{
+	uint n;
+
+	public:
+
+		AtanhSeries(uint n_) : n(n_)
+		{
+		}
+
+		void Term(uint k, DynInt & a, DynInt & b, DynInt & p, DynInt & q) const
+		{
+			a.SetOne();
+			b = 2 * k + 1;
+			p.SetOne();
+			q = n;
+
+			if( k > 0 )
+				q.MulInt(n);
+		}
+	};
+
+
+	/*!
+		1 + 1/(3*3) + 1/(5*3^2) + 1/(7*3^3) + ...
+		a(k) = 1, b(k) = 2k+1, p(k) = 1, q(0) = 1, q(k) = 3
+	*/
+	class CatalanAtanhSeries : public SeriesTerms
+	{
+	public:
+
+		void Term(uint k, DynInt & a, DynInt & b, DynInt & p, DynInt & q) const
+		{
+			a.SetOne();
+			b = 2 * k + 1;
+			p.SetOne();
+			q = (k == 0) ? uint(1) : uint(3);
+		}
+	};
+
+
+	/*!
+		sum( (k!)^2 / ((2k)! (2k+1)^2) )
+		a(k) = 1, b(k) = (2k+1)^2, p(0) = 1, q(0) = 1, p(k) = k, q(k) = 2(2k-1)
+	*/
+	class CatalanSeries : public SeriesTerms
+	{
+	public:
+
+		void Term(uint k, DynInt & a, DynInt & b, DynInt & p, DynInt & q) const
+		{
+			a.SetOne();
+			b = 2 * k + 1;
+			b.MulInt(2 * k + 1);
+
+			if( k == 0 )
+			{
+				p.SetOne();
+				q.SetOne();
+			}
+			else
+			{
+				p = k;
+				q = 2 * (2 * k - 1);
+			}
+		}
+	};
+
+
+	/*!
+		Chudnovsky's series: 1/pi = 12 * sum( (-1)^k (6k)! (13591409 + 545140134k) / ((3k)! (k!)^3 640320^(3k+3/2)) )
+		a(k) = 13591409 + 545140134k, b(k) = 1,
+		p(0) = 1, p(k) = -(6k-5)(2k-1)(6k-1),
+		q(0) = 1, q(k) = k^3 * 640320^3 / 24
+	*/
+	class ChudnovskySeries : public SeriesTerms
+	{
+	public:
+
+		void Term(uint k, DynInt & a, DynInt & b, DynInt & p, DynInt & q) const
+		{
+			a = uint(545140134);
+			a.MulInt(k);
+			a.Add( DynInt(uint(13591409)) );
+			b.SetOne();
+
+			if( k == 0 )
+			{
+				p.SetOne();
+				q.SetOne();
+				return;
+			}
+
+			p = 6 * k - 5;
+			p.MulInt(2 * k - 1);
+			p.MulInt(6 * k - 1);
+			p.ChangeSign();
+
+			// 640320^3 / 24 = 26680 * 640320 * 640320
+			q = k;
+			q.MulInt(k);
+			q.MulInt(k);
+			q.MulInt(26680);
+			q.MulInt(640320);
+			q.MulInt(640320);
+		}
+	};
+
+};
+
+
+
+/*!
+	\brief the cache of constants calculated at run time
+
+	a constant is calculated (by BinarySplitting) only when it is used the first time,
+	each mantissa size has its own cache (the template parameter)
+	the cache is protected by ThreadLock and is used only when TTMATH_MULTITHREADS
+	is defined, otherwise Get() calculates the constant each time
+
+	usage:
+		UInt<man> mantissa;
+		sint exponent = ConstantsCache<man>::Get(ConstantsCache<man>::pi, mantissa);
+		// pi = mantissa * 2^exponent
+*/
+template<uint man>
+class ConstantsCache
+{
+public:
+
+	enum Name
+	{
+		pi = 0, e, ln2, ln10, sqrt2, euler_gamma, catalan,
+		count
+	};
+
+
+	/*!
+		this method returns a constant (value = mantissa * 2^exponent)
+		the returned value is the exponent
+	*/
+	static sint Get(Name name, UInt<man> & mantissa)
+	{
+	ThreadLock lock;
+
+		if( !lock.Lock() )
+			// we're not able to use the cache
+			return Calculate(name, mantissa);
+
+		// the table is initialized when the mutex is locked
+		static Entry table[count];
+		Entry & entry = table[name];
+
+		if( !entry.ready )
+		{
+			entry.exponent = Calculate(name, entry.mantissa);
+			entry.ready    = true;
+		}
+
+		mantissa = entry.mantissa;
+
+	return entry.exponent;
+	}
+
+
+private:
+
+
+	struct Entry
+	{
+		UInt<man> mantissa;
+		sint exponent;
+		bool ready;
+
+		Entry()
+		{
+			ready = false;
+		}
+	};
+
+
+	/*!
+		the constants are calculated only by BinarySplitting (without using the cache)
+		because the lock is not recursive
+	*/
+	static sint Calculate(Name name, UInt<man> & mantissa)
+	{
+		switch( name )
+		{
+		case pi:			return BinarySplitting::Pi(mantissa);
+		case e:				return BinarySplitting::E(mantissa);
+		case ln2:			return BinarySplitting::Ln2(mantissa);
+		case ln10:			return BinarySplitting::Ln10(mantissa);
+		case sqrt2:			return BinarySplitting::Sqrt2(mantissa);
+		case euler_gamma:	return BinarySplitting::EulerGamma(mantissa);
+		default:			break;
+		}
+
+	return BinarySplitting::Catalan(mantissa);
+	}
+};
+
+
+} // namespace
+
+#endif
@@ -0,0 +1,1588 @@
+/*
+ * This file is a part of TTMath Bignum Library
+ * and is distributed under the (new) BSD licence.
+ * Author: Tomasz Sowa <t.sowa@slimaczek.pl>
+ */
+
+/*
+ * Copyright (c) 2006-2009, Tomasz Sowa
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ *  * Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ *  * Neither the name Tomasz Sowa nor the names of contributors to this
+ *    project may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#ifndef headerfilettmathdynint
+#define headerfilettmathdynint
+
+/*!
+	\file ttmathdynint.h
+    \brief class DynInt - a big integer value whose size is set at runtime
+*/
+
+#include "ttmathint.h"
+
+#include <vector>
+#include <algorithm>
+
+
+namespace ttmath
+{
+
+
+/*!
+	\brief DynInt implements a big integer value with a sign whose size is set at runtime
+
+	UInt<value_size> and Int<value_size> always have value_size words and all
+	operations work on all of them (even if the value is 7), DynInt keeps
+	only as many words as the value needs (the value is normalized - the highest
+	word is different from zero) and it grows when it's needed
+
+	small values (up to TTMATH_DYNINT_INLINE_SIZE words) are kept inside
+	the object, bigger ones are allocated on the heap
+
+	the value is kept as a sign and a magnitude (the magnitude is a vector of words
+	with the lowest word first) and the operations are made by the static vector
+	methods from UInt (AddVector(), MulAddVector(), DivIntVector() etc.)
+
+	e.g.
+		DynInt a("123456789012345678901234567890"), b(100);
+		a = a * a + b;
+		std::cout << a << std::endl;
+
+		UInt<4> u;
+		if( a.ToUInt(u) )
+			std::cout << "the value is too big for UInt<4>" << std::endl;
+*/
+class DynInt
+{
+public:
+
+
+	/*!
+		a default constructor - the value is zero
+	*/
+	DynInt()
+	{
+		Init();
+	}
+
+
+	/*!
+		a copy constructor
+	*/
+	DynInt(const DynInt & x)
+	{
+		Init();
+		operator=(x);
+	}
+
+
+	/*!
+		a constructor for converting the sint to this class
+	*/
+	DynInt(sint i)
+	{
+		Init();
+		FromInt(i);
+	}
+
+
+	/*!
+		a constructor for converting the uint to this class
+	*/
+	DynInt(uint i)
+	{
+		Init();
+		FromUInt(i);
+	}
+
+
+#ifdef TTMATH_PLATFORM64
+
+	/*!
+		a constructor for converting the signed int to this class
+
+		***this constructor is created only on a 64bit platform***
+		it takes one argument of 32bit
+	*/
+	DynInt(signed int i)
+	{
+		Init();
+		FromInt(sint(i));
+	}
+
+
+	/*!
+		a constructor for converting the unsigned int to this class
+
+		***this constructor is created only on a 64bit platform***
+		it takes one argument of 32bit
+	*/
+	DynInt(unsigned int i)
+	{
+		Init();
+		FromUInt(uint(i));
+	}
+
+#endif
+
+
+	/*!
+		a constructor for converting UInt<> to this class
+	*/
+	template<uint argument_size>
+	DynInt(const UInt<argument_size> & p)
+	{
+		Init();
+		FromUInt(p);
+	}
+
+
+	/*!
+		a constructor for converting Int<> to this class
+	*/
+	template<uint argument_size>
+	DynInt(const Int<argument_size> & p)
+	{
+		Init();
+		FromInt(p);
+	}
+
+
+	/*!
+		a constructor for converting a string to this class (with the base=10)
+	*/
+	DynInt(const char * s)
+	{
+		Init();
+		FromString(s);
+	}
+
+
+	/*!
+		a constructor for converting a string to this class (with the base=10)
+	*/
+	DynInt(const std::string & s)
+	{
+		Init();
+		FromString(s.c_str());
+	}
+
+
+	/*!
+		the destructor
+	*/
+	~DynInt()
+	{
+		if( table != inline_table )
+			delete [] table;
+	}
+
+
+	/*!
+		the assignment operator
+	*/
+	DynInt & operator=(const DynInt & x)
+	{
+		if( this != &x )
+		{
+			Reserve(x.size);
+
+			for(uint i=0 ; i<x.size ; ++i)
+				table[i] = x.table[i];
+
+			size = x.size;
+			sign = x.sign;
+		}
+
+	return *this;
+	}
+
+
+	DynInt & operator=(sint i)
+	{
+		FromInt(i);
+
+	return *this;
+	}
+
+
+	DynInt & operator=(uint i)
+	{
+		FromUInt(i);
+
+	return *this;
+	}
+
+
+#ifdef TTMATH_PLATFORM64
+
+	DynInt & operator=(signed int i)
+	{
+		FromInt(sint(i));
+
+	return *this;
+	}
+
+
+	DynInt & operator=(unsigned int i)
+	{
+		FromUInt(uint(i));
+
+	return *this;
+	}
+
+#endif
+
+
+	template<uint argument_size>
+	DynInt & operator=(const UInt<argument_size> & p)
+	{
+		FromUInt(p);
+
+	return *this;
+	}
+
+
+	template<uint argument_size>
+	DynInt & operator=(const Int<argument_size> & p)
+	{
+		FromInt(p);
+
+	return *this;
+	}
+
+
+	DynInt & operator=(const char * s)
+	{
+		FromString(s);
+
+	return *this;
+	}
+
+
+	DynInt & operator=(const std::string & s)
+	{
+		FromString(s.c_str());
+
+	return *this;
+	}
+
+
+
+	/*!
+	*
+	*	basic methods
+	*
+	*/
+
+
+	/*!
+		how many words the value has (zero if the value is zero)
+	*/
+	uint Size() const
+	{
+		return size;
+	}
+
+
+	/*!
+		the words of the magnitude (the lowest word first), there are Size() of them
+	*/
+	const uint * Table() const
+	{
+		return table;
+	}
+
+
+	/*!
+		how many words can be used without allocating memory
+	*/
+	uint Capacity() const
+	{
+		return capacity;
+	}
+
+
+	/*!
+		this method allocates memory for 'words' words (the value is not changed)
+	*/
+	void Reserve(uint words)
+	{
+		if( words <= capacity )
+			return;
+
+		uint new_capacity = capacity * 2;
+
+		if( new_capacity < words )
+			new_capacity = words;
+
+		uint * new_table = new uint[new_capacity];
+
+		for(uint i=0 ; i<size ; ++i)
+			new_table[i] = table[i];
+
+		if( table != inline_table )
+			delete [] table;
+
+		table    = new_table;
+		capacity = new_capacity;
+	}
+
+
+	/*!
+		this method sets zero (the memory is not released)
+	*/
+	void SetZero()
+	{
+		size = 0;
+		sign = false;
+	}
+
+
+	/*!
+		this method sets one
+	*/
+	void SetOne()
+	{
+		FromUInt(uint(1));
+	}
+
+
+	/*!
+		this method returns true if the value is zero
+	*/
+	bool IsZero() const
+	{
+		return size == 0;
+	}
+
+
+	/*!
+		this method returns true if the value is negative
+	*/
+	bool IsSign() const
+	{
+		return sign;
+	}
+
+
+	/*!
+		this method changes the sign (zero stays zero)
+	*/
+	void ChangeSign()
+	{
+		if( size != 0 )
+			sign = !sign;
+	}
+
+
+	/*!
+		this method sets the absolute value
+	*/
+	void Abs()
+	{
+		sign = false;
+	}
+
+
+	/*!
+		this method exchanges the values (the memory is exchanged too if it's possible)
+	*/
+	void Swap(DynInt & x)
+	{
+		if( table != inline_table && x.table != x.inline_table )
+		{
+			uint * t = table;     table    = x.table;    x.table    = t;
+			uint c   = capacity;  capacity = x.capacity; x.capacity = c;
+			uint s   = size;      size     = x.size;     x.size     = s;
+			bool g   = sign;      sign     = x.sign;     x.sign     = g;
+		}
+		else
+		{
+			DynInt temp(*this);
+			*this = x;
+			x     = temp;
+		}
+	}
+
+
+
+	/*!
+	*
+	*	conversions
+	*
+	*/
+
+
+	/*!
+		this method converts the uint type to this class
+	*/
+	void FromUInt(uint value)
+	{
+		sign = false;
+		size = 0;
+
+		if( value != 0 )
+		{
+			table[0] = value;
+			size     = 1;
+		}
+	}
+
+
+	/*!
+		this method converts the sint type to this class
+	*/
+	void FromInt(sint value)
+	{
+		if( value < 0 )
+		{
+			// this works with the smallest value too
+			FromUInt( uint(0) - uint(value) );
+			sign = true;
+		}
+		else
+		{
+			FromUInt( uint(value) );
+		}
+	}
+
+
+	/*!
+		this method converts UInt<> to this class
+	*/
+	template<uint argument_size>
+	void FromUInt(const UInt<argument_size> & p)
+	{
+		Reserve(argument_size);
+
+		for(uint i=0 ; i<argument_size ; ++i)
+			table[i] = p.table[i];
+
+		size = argument_size;
+		sign = false;
+		Normalize();
+	}
+
+
+	/*!
+		this method converts Int<> to this class
+	*/
+	template<uint argument_size>
+	void FromInt(const Int<argument_size> & p)
+	{
+		if( p.IsSign() )
+		{
+			// the two's complement, it works with the smallest value too
+			UInt<argument_size> temp(p);
+			temp.BitNot();
+			temp.AddOne();
+
+			FromUInt(temp);
+			sign = true;
+		}
+		else
+		{
+			FromUInt( static_cast<const UInt<argument_size>&>(p) );
+		}
+	}
+
+
+	/*!
+		this method converts the value to the uint type
+
+		it returns 1 if the value is negative or too big
+		(then only the lowest word is taken)
+	*/
+	uint ToUInt(uint & result) const
+	{
+		result = (size > 0) ? table[0] : 0;
+
+		if( sign )
+			result = uint(0) - result;
+
+	return (sign || size > 1) ? 1 : 0;
+	}
+
+
+	/*!
+		this method converts the value to the sint type
+
+		it returns 1 if the value is too big
+	*/
+	uint ToInt(sint & result) const
+	{
+	uint magnitude = (size > 0) ? table[0] : 0;
+
+		if( sign )
+		{
+			result = sint( uint(0) - magnitude );
+			return (size > 1 || magnitude > TTMATH_UINT_HIGHEST_BIT) ? 1 : 0;
+		}
+
+		result = sint(magnitude);
+
+	return (size > 1 || magnitude >= TTMATH_UINT_HIGHEST_BIT) ? 1 : 0;
+	}
+
+
+	/*!
+		this method converts the value to UInt<>
+
+		it returns 1 if the value is negative or too big
+		(then only the lowest argument_size words are taken)
+	*/
+	template<uint argument_size>
+	uint ToUInt(UInt<argument_size> & result) const
+	{
+		CopyLowWords(result);
+
+		if( sign )
+		{
+			result.BitNot();
+			result.AddOne();
+		}
+
+	return (sign || size > argument_size) ? 1 : 0;
+	}
+
+
+	/*!
+		this method converts the value to Int<>
+
+		it returns 1 if the value is too big
+	*/
+	template<uint argument_size>
+	uint ToInt(Int<argument_size> & result) const
+	{
+		CopyLowWords(result);
+
+		if( size > argument_size )
+			return 1;
+
+		if( sign )
+		{
+			result.BitNot();
+			result.AddOne();
+
+			// the magnitude can be at most 2^(argument_size*TTMATH_BITS_PER_UINT-1)
+			return result.IsSign() ? 0 : 1;
+		}
+
+	return result.IsSign() ? 1 : 0;
+	}
+
+
+	/*!
+		this method converts the value to a string with a base equal 'b' (from 2 to 16)
+	*/
+	void ToString(std::string & result, uint b = 10) const
+	{
+		result.clear();
+
+		if( b<2 || b>16 )
+			return;
+
+		if( size == 0 )
+		{
+			result = "0";
+			return;
+		}
+
+		// how many digits are in one word (big_base = b^digits)
+		uint big_base = b, digits = 1;
+
+		while( big_base <= TTMATH_UINT_MAX_VALUE / b )
+		{
+			big_base *= b;
+			digits   += 1;
+		}
+
+		std::vector<uint> temp(table, table + size);
+		uint temp_size = size;
+
+		while( temp_size > 0 )
+		{
+			uint rem = UInt<1>::DivIntVector(&temp[0], temp_size, big_base, &temp[0]);
+
+			while( temp_size > 0 && temp[temp_size-1] == 0 )
+				--temp_size;
+
+			// the last (the highest) part is without leading zeros
+			for(uint i=0 ; i<digits && (temp_size > 0 || rem != 0) ; ++i)
+			{
+				result += static_cast<char>( UInt<1>::DigitToChar(rem % b) );
+				rem    /= b;
+			}
+		}
+
+		if( sign )
+			result += '-';
+
+		std::reverse(result.begin(), result.end());
+	}
+
+
+	/*!
+		this method converts the value to a string with a base equal 'b'
+	*/
+	std::string ToString(uint b = 10) const
+	{
+		std::string result;
+		ToString(result, b);
+
+	return result;
+	}
+
+
+	/*!
+		this method converts a string into its value
+		it returns 1 if an incorrect base 'b' is given
+
+		string is ended with a non-digit value, for example:
+			"-12" will be translated to -12
+			as well as:
+			"- 12foo" will be translated to -12 too
+
+		existing first white characters will be ommited
+		(between '-' and a first digit can be white characters too)
+
+		after_source (if exists) is pointing at the end of the parsed string
+
+		value_read (if exists) tells whether something has actually been read (at least one digit)
+	*/
+	uint FromString(const char * s, uint b = 10, const char ** after_source = 0, bool * value_read = 0)
+	{
+	bool is_sign = false;
+	sint z;
+
+		SetZero();
+
+		if( after_source )
+			*after_source = s;
+
+		if( value_read )
+			*value_read = false;
+
+		if( b<2 || b>16 )
+			return 1;
+
+		UInt<1>::SkipWhiteCharacters(s);
+
+		if( *s == '-' )
+		{
+			is_sign = true;
+			UInt<1>::SkipWhiteCharacters(++s);
+		}
+		else
+		if( *s == '+' )
+		{
+			UInt<1>::SkipWhiteCharacters(++s);
+		}
+
+		// the digits are collected in one word and then added to the value
+		uint part = 0, part_base = 1;
+
+		for( ; (z=UInt<1>::CharToDigit(*s, b)) != -1 ; ++s)
+		{
+			if( value_read )
+				*value_read = true;
+
+			if( part_base > TTMATH_UINT_MAX_VALUE / b )
+			{
+				MulAddInt(part_base, part);
+				part      = 0;
+				part_base = 1;
+			}
+
+			part       = part * b + uint(z);
+			part_base *= b;
+		}
+
+		MulAddInt(part_base, part);
+
+		if( after_source )
+			*after_source = s;
+
+		if( is_sign )
+			ChangeSign();
+
+	return 0;
+	}
+
+
+	/*!
+		this method converts a string into its value
+		it returns 1 if an incorrect base 'b' is given
+	*/
+	uint FromString(const std::string & s, uint b = 10)
+	{
+		return FromString( s.c_str(), b );
+	}
+
+
+
+	/*!
+	*
+	*	arithmetic
+	*
+	*/
+
+
+	/*!
+		addition: this = this + ss2
+	*/
+	void Add(const DynInt & ss2)
+	{
+		if( this == &ss2 )
+		{
+			DynInt temp(ss2);
+			Add(temp);
+			return;
+		}
+
+		if( sign == ss2.sign )
+			AddMagnitude(ss2);
+		else
+			SubMagnitude(ss2, ss2.sign);
+	}
+
+
+	/*!
+		subtraction: this = this - ss2
+	*/
+	void Sub(const DynInt & ss2)
+	{
+		if( this == &ss2 )
+		{
+			SetZero();
+			return;
+		}
+
+		if( sign != ss2.sign )
+			AddMagnitude(ss2);
+		else
+			SubMagnitude(ss2, !ss2.sign);
+	}
+
+
+	/*!
+		multiplication: this = this * ss2
+
+		the schoolbook multiplication is used for small values and
+		the Karatsuba multiplication for big ones
+		(look at TTMATH_USE_KARATSUBA_MULTIPLICATION_FROM_SIZE)
+	*/
+	void Mul(const DynInt & ss2)
+	{
+		if( size == 0 || ss2.size == 0 )
+		{
+			SetZero();
+			return;
+		}
+
+		if( ss2.size == 1 )
+		{
+			bool result_sign = (sign != ss2.sign);
+			MulInt(ss2.table[0]);
+			sign = result_sign;
+			return;
+		}
+
+		DynInt result;
+		result.Reserve(size + ss2.size);
+
+		MulMagnitude(table, size, ss2.table, ss2.size, result.table);
+		result.size = size + ss2.size;
+		result.sign = (sign != ss2.sign);
+		result.Normalize();
+
+		TakeOver(result);
+	}
+
+
+	/*!
+		multiplication by one word: this = this * ss2
+	*/
+	void MulInt(uint ss2)
+	{
+		bool result_sign = sign;
+
+		MulAddInt(ss2, 0);
+		sign = result_sign && size > 0;
+	}
+
+
+	/*!
+		division: this = this / ss2
+
+		the quotient is rounded towards zero and the remainder has the same sign
+		as the dividend (the same as in Int<>)
+
+		it returns 1 if ss2 is zero (then nothing is changed)
+	*/
+	uint Div(const DynInt & ss2, DynInt * remainder = 0)
+	{
+		if( ss2.size == 0 )
+			return 1;
+
+		if( CmpMagnitude(table, size, ss2.table, ss2.size) < 0 )
+		{
+			// the quotient is zero
+			if( remainder )
+				*remainder = *this;
+
+			SetZero();
+			return 0;
+		}
+
+		bool dividend_sign = sign;
+		bool quotient_sign = (sign != ss2.sign);
+
+		DynInt quotient, rest;
+		quotient.Reserve(size - ss2.size + 1);
+		rest.Reserve(ss2.size);
+
+		DivMagnitude(table, size, ss2.table, ss2.size, quotient.table, rest.table);
+
+		quotient.size = size - ss2.size + 1;
+		quotient.sign = quotient_sign;
+		quotient.Normalize();
+
+		rest.size = ss2.size;
+		rest.sign = dividend_sign;
+		rest.Normalize();
+
+		TakeOver(quotient);
+
+		if( remainder )
+			remainder->TakeOver(rest);
+
+	return 0;
+	}
+
+
+	uint Div(const DynInt & ss2, DynInt & remainder)
+	{
+		return Div(ss2, &remainder);
+	}
+
+
+	/*!
+		division by one word: this = this / divisor
+
+		the remainder is the remainder of the magnitude
+		it returns 1 if the divisor is zero
+	*/
+	uint DivInt(uint divisor, uint * remainder = 0)
+	{
+		if( divisor == 0 )
+		{
+			if( remainder )
+				*remainder = 0;
+
+			return 1;
+		}
+
+		uint r = (size > 0) ? UInt<1>::DivIntVector(table, size, divisor, table) : 0;
+
+		if( remainder )
+			*remainder = r;
+
+		Normalize();
+
+	return 0;
+	}
+
+
+	uint DivInt(uint divisor, uint & remainder)
+	{
+		return DivInt(divisor, &remainder);
+	}
+
+
+	/*!
+		this method moves the magnitude 'bits' times into the left:
+		|this| = |this| * 2^bits
+	*/
+	void ShiftLeft(uint bits)
+	{
+		if( size == 0 || bits == 0 )
+			return;
+
+		uint words = bits / TTMATH_BITS_PER_UINT;
+		uint i;
+
+		bits %= TTMATH_BITS_PER_UINT;
+		Reserve(size + words + 1);
+
+		for(i=size ; i-- > 0 ; )
+			table[i + words] = table[i];
+
+		for(i=0 ; i<words ; ++i)
+			table[i] = 0;
+
+		size += words;
+
+		if( bits != 0 )
+		{
+			table[size] = UInt<1>::ShiftLeftVector(table + words, size - words, bits, table + words);
+			size += 1;
+			Normalize();
+		}
+	}
+
+
+	/*!
+		this method moves the magnitude 'bits' times into the right:
+		|this| = |this| / 2^bits (the bits moved out are lost)
+	*/
+	void ShiftRight(uint bits)
+	{
+		uint words = bits / TTMATH_BITS_PER_UINT;
+		uint i;
+
+		if( words >= size )
+		{
+			SetZero();
+			return;
+		}
+
+		bits %= TTMATH_BITS_PER_UINT;
+
+		for(i=0 ; i+words<size ; ++i)
+			table[i] = table[i + words];
+
+		size -= words;
+
+		if( bits != 0 )
+			UInt<1>::ShiftRightVector(table, size, bits, table);
+
+		Normalize();
+	}
+
+
+
+	/*!
+	*
+	*	operators
+	*
+	*/
+
+
+	bool operator==(const DynInt & l) const
+	{
+		return Cmp(l) == 0;
+	}
+
+	bool operator!=(const DynInt & l) const
+	{
+		return Cmp(l) != 0;
+	}
+
+	bool operator<(const DynInt & l) const
+	{
+		return Cmp(l) < 0;
+	}
+
+	bool operator>(const DynInt & l) const
+	{
+		return Cmp(l) > 0;
+	}
+
+	bool operator<=(const DynInt & l) const
+	{
+		return Cmp(l) <= 0;
+	}
+
+	bool operator>=(const DynInt & l) const
+	{
+		return Cmp(l) >= 0;
+	}
+
+
+	DynInt operator-() const
+	{
+		DynInt temp(*this);
+		temp.ChangeSign();
+
+	return temp;
+	}
+
+
+	DynInt operator+(const DynInt & p2) const
+	{
+		DynInt temp(*this);
+		temp.Add(p2);
+
+	return temp;
+	}
+
+
+	DynInt & operator+=(const DynInt & p2)
+	{
+		Add(p2);
+
+	return *this;
+	}
+
+
+	DynInt operator-(const DynInt & p2) const
+	{
+		DynInt temp(*this);
+		temp.Sub(p2);
+
+	return temp;
+	}
+
+
+	DynInt & operator-=(const DynInt & p2)
+	{
+		Sub(p2);
+
+	return *this;
+	}
+
+
+	DynInt operator*(const DynInt & p2) const
+	{
+		DynInt temp(*this);
+		temp.Mul(p2);
+
+	return temp;
+	}
+
+
+	DynInt & operator*=(const DynInt & p2)
+	{
+		Mul(p2);
+
+	return *this;
+	}
+
+
+	DynInt operator/(const DynInt & p2) const
+	{
+		DynInt temp(*this);
+		temp.Div(p2);
+
+	return temp;
+	}
+
+
+	DynInt & operator/=(const DynInt & p2)
+	{
+		Div(p2);
+
+	return *this;
+	}
+
+
+	DynInt operator%(const DynInt & p2) const
+	{
+		DynInt temp(*this), remainder;
+		temp.Div(p2, remainder);
+
+	return remainder;
+	}
+
+
+	DynInt & operator%=(const DynInt & p2)
+	{
+		DynInt remainder;
+		Div(p2, remainder);
+		TakeOver(remainder);
+
+	return *this;
+	}
+
+
+	friend std::ostream & operator<<(std::ostream & s, const DynInt & l)
+	{
+		std::string ss;
+		l.ToString(ss);
+		s << ss;
+
+	return s;
+	}
+
+
+	friend std::istream & operator>>(std::istream & s, DynInt & l)
+	{
+	std::string ss;
+	char z;
+
+		// operator>> omits white characters if they're set for ommiting
+		s >> z;
+
+		if( z=='-' || z=='+' )
+		{
+			ss += z;
+			s >> z; // we're also omitting white characters after the sign
+		}
+
+		while( s.good() && UInt<1>::CharToDigit(z, 10)>=0 )
+		{
+			ss += z;
+			z = static_cast<char>(s.get());
+		}
+
+		// we're leaving the last readed character
+		// (it's not belonging to the value)
+		s.unget();
+
+		l.FromString(ss);
+
+	return s;
+	}
+
+
+
+private:
+
+
+	/*!
+		the words of the magnitude (the lowest word first),
+		it points to inline_table or to memory allocated on the heap
+	*/
+	uint * table;
+
+	/*!
+		how many words are used (the highest one is different from zero)
+	*/
+	uint size;
+
+	/*!
+		how many words the table has
+	*/
+	uint capacity;
+
+	/*!
+		true if the value is negative (zero has always false)
+	*/
+	bool sign;
+
+	/*!
+		small values are kept here
+	*/
+	uint inline_table[TTMATH_DYNINT_INLINE_SIZE];
+
+
+	void Init()
+	{
+		table    = inline_table;
+		capacity = TTMATH_DYNINT_INLINE_SIZE;
+		size     = 0;
+		sign     = false;
+	}
+
+
+	/*!
+		this method removes the highest zero words
+	*/
+	void Normalize()
+	{
+		while( size > 0 && table[size-1] == 0 )
+			--size;
+
+		if( size == 0 )
+			sign = false;
+	}
+
+
+	/*!
+		this method takes the value from x (and its memory if it's on the heap),
+		x is zero after that
+	*/
+	void TakeOver(DynInt & x)
+	{
+		if( x.table == x.inline_table )
+		{
+			*this = x;
+		}
+		else
+		{
+			if( table != inline_table )
+				delete [] table;
+
+			table    = x.table;
+			capacity = x.capacity;
+			size     = x.size;
+			sign     = x.sign;
+
+			x.Init();
+		}
+	}
+
+
+	/*!
+		this method copies the lowest words of the magnitude into 'result'
+	*/
+	template<uint argument_size>
+	void CopyLowWords(UInt<argument_size> & result) const
+	{
+		uint i;
+
+		for(i=0 ; i<size && i<argument_size ; ++i)
+			result.table[i] = table[i];
+
+		for( ; i<argument_size ; ++i)
+			result.table[i] = 0;
+	}
+
+
+	/*!
+		comparing with a sign
+	*/
+	sint Cmp(const DynInt & l) const
+	{
+		if( sign != l.sign )
+			return sign ? -1 : 1;
+
+		sint res = CmpMagnitude(table, size, l.table, l.size);
+
+	return sign ? -res : res;
+	}
+
+
+	/*!
+		magnitude: this = this * mul + add
+	*/
+	void MulAddInt(uint mul, uint add)
+	{
+		Reserve(size + 1);
+
+		if( size > 0 )
+		{
+			table[size] = UInt<1>::MulVector(table, mul, size, table);
+			size       += 1;
+
+			// there is no carry from the highest word:
+			// this*mul + add <= (B^size - 1)*(B - 1) + B - 1 < B^(size+1)
+			UInt<1>::AddVector(table, &add, size, 1, table);
+		}
+		else
+		{
+			table[0] = add;
+			size     = 1;
+		}
+
+		Normalize();
+	}
+
+
+	/*!
+		magnitude: |this| = |this| + |ss2|
+	*/
+	void AddMagnitude(const DynInt & ss2)
+	{
+		// the vector methods need at least one word
+		if( ss2.size == 0 )
+			return;
+
+		uint n = (size > ss2.size) ? size : ss2.size;
+
+		Reserve(n + 1);
+
+		for(uint i=size ; i<n ; ++i)
+			table[i] = 0;
+
+		table[n] = UInt<1>::AddVector(table, ss2.table, n, ss2.size, table);
+		size     = n + 1;
+
+		Normalize();
+	}
+
+
+	/*!
+		magnitude: |this| = ||this| - |ss2||
+
+		ss2_sign is the sign which ss2 has in the operation,
+		it becomes the sign of the result when |ss2| is bigger
+	*/
+	void SubMagnitude(const DynInt & ss2, bool ss2_sign)
+	{
+		if( ss2.size == 0 )
+			return;
+
+		if( size == 0 )
+		{
+			*this = ss2;
+			sign  = ss2_sign;
+			return;
+		}
+
+		if( CmpMagnitude(table, size, ss2.table, ss2.size) >= 0 )
+		{
+			UInt<1>::SubVector(table, ss2.table, size, ss2.size, table);
+		}
+		else
+		{
+			Reserve(ss2.size);
+
+			for(uint i=size ; i<ss2.size ; ++i)
+				table[i] = 0;
+
+			// the result can point to the second argument
+			UInt<1>::SubVector(ss2.table, table, ss2.size, size, table);
+			size = ss2.size;
+			sign = ss2_sign;
+		}
+
+		Normalize();
+	}
+
+
+	/*!
+		comparing the magnitudes (both are normalized)
+	*/
+	static sint CmpMagnitude(const uint * ss1, uint ss1_size, const uint * ss2, uint ss2_size)
+	{
+		if( ss1_size != ss2_size )
+			return (ss1_size < ss2_size) ? -1 : 1;
+
+	return UInt<1>::CmpVector(ss1, ss2, ss1_size);
+	}
+
+
+	/*!
+		result = ss1 * ss2
+
+		result has ss1_size+ss2_size words (it cannot point to ss1 or ss2)
+	*/
+	static void MulMagnitude(const uint * ss1, uint ss1_size, const uint * ss2, uint ss2_size, uint * result)
+	{
+		if( ss1_size < ss2_size )
+		{
+			const uint * p = ss1; ss1 = ss2; ss2 = p;
+			uint s = ss1_size; ss1_size = ss2_size; ss2_size = s;
+		}
+
+		if( ss2_size < TTMATH_USE_KARATSUBA_MULTIPLICATION_FROM_SIZE )
+		{
+			UInt<1>::MulBigVector(ss1, ss1_size, ss2, ss2_size, result);
+			return;
+		}
+
+		// ss1 is divided into parts of ss2_size words
+		// and each part is multiplied by ss2 with the Karatsuba algorithm
+		std::vector<uint> temp(ss2_size*2 + KaratsubaTempSize(ss2_size));
+		uint * product = &temp[0];
+
+		for(uint i=0 ; i<ss1_size+ss2_size ; ++i)
+			result[i] = 0;
+
+		for(uint start=0 ; start<ss1_size ; start+=ss2_size)
+		{
+			uint part = ss1_size - start;
+
+			if( part >= ss2_size )
+			{
+				part = ss2_size;
+				Karatsuba(ss1+start, ss2, ss2_size, product, product + ss2_size*2);
+			}
+			else
+			{
+				MulMagnitude(ss2, ss2_size, ss1+start, part, product);
+			}
+
+			UInt<1>::AddVector(result+start, product, ss1_size+ss2_size-start, part+ss2_size, result+start);
+		}
+	}
+
+
+	/*!
+		how many words Karatsuba() needs for temporary values
+	*/
+	static uint KaratsubaTempSize(uint n)
+	{
+		uint temp_size = 0;
+
+		while( n >= TTMATH_USE_KARATSUBA_MULTIPLICATION_FROM_SIZE )
+		{
+			uint h = n - n/2;
+
+			temp_size += 4*h + 4;
+			n          = h + 1;
+		}
+
+	return temp_size;
+	}
+
+
+	/*!
+		the Karatsuba multiplication: result = x * y
+
+		x and y have n words, result has n*2 words,
+		temp has KaratsubaTempSize(n) words
+
+		x = x1*B^m + x0, y = y1*B^m + y0
+		x*y = z2*B^(2m) + z1*B^m + z0
+		where z2 = x1*y1, z0 = x0*y0 and z1 = (x1+x0)*(y1+y0) - z2 - z0
+	*/
+	static void Karatsuba(const uint * x, const uint * y, uint n, uint * result, uint * temp)
+	{
+		if( n < TTMATH_USE_KARATSUBA_MULTIPLICATION_FROM_SIZE )
+		{
+			UInt<1>::MulBigVector(x, n, y, n, result);
+			return;
+		}
+
+		uint m = n / 2;
+		uint h = n - m; // h >= m
+
+		uint * sx   = temp;           // h+1 words
+		uint * sy   = sx + h + 1;     // h+1 words
+		uint * z1   = sy + h + 1;     // 2h+2 words
+		uint * rest = z1 + 2*h + 2;
+
+		Karatsuba(x,   y,   m, result,     rest); // z0 (this works because m is h or h-1)
+		Karatsuba(x+m, y+m, h, result+2*m, rest); // z2
+
+		sx[h] = UInt<1>::AddVector(x+m, x, h, m, sx);
+		sy[h] = UInt<1>::AddVector(y+m, y, h, m, sy);
+		Karatsuba(sx, sy, h+1, z1, rest);
+
+		UInt<1>::SubVector(z1, result,     2*h+2, 2*m, z1);
+		UInt<1>::SubVector(z1, result+2*m, 2*h+2, 2*h, z1);
+
+		// z1 is smaller than B^(2h+1) so the highest word is zero
+		UInt<1>::AddVector(result+m, z1, 2*n-m, 2*h+1, result+m);
+	}
+
+
+	/*!
+		division of the magnitudes: q = u / v, r = u % v
+
+		u has un words, v has vn words (un >= vn > 0 and the highest word of v
+		is different from zero), q has un-vn+1 words and r has vn words
+
+		this is the algorithm D from Knuth's 'The Art of Computer Programming'
+		(the same as UInt::Div3() but on vectors)
+	*/
+	static void DivMagnitude(const uint * u, uint un, const uint * v, uint vn, uint * q, uint * r)
+	{
+		if( vn == 1 )
+		{
+			r[0] = UInt<1>::DivIntVector(u, un, v[0], q);
+			return;
+		}
+
+		std::vector<uint> temp(un + 1 + vn);
+		uint * un_ = &temp[0];
+		uint * vn_ = un_ + un + 1;
+		uint i;
+
+		// normalization - the highest bit of the divisor is set
+		uint shift = TTMATH_BITS_PER_UINT - 1 - uint(UInt<1>::FindLeadingBitInWord(v[vn-1]));
+
+		if( shift != 0 )
+		{
+			UInt<1>::ShiftLeftVector(v, vn, shift, vn_);
+			un_[un] = UInt<1>::ShiftLeftVector(u, un, shift, un_);
+		}
+		else
+		{
+			for(i=0 ; i<vn ; ++i)
+				vn_[i] = v[i];
+
+			for(i=0 ; i<un ; ++i)
+				un_[i] = u[i];
+
+			un_[un] = 0;
+		}
+
+		uint v1 = vn_[vn-1];
+		uint v2 = vn_[vn-2];
+
+		for(uint j=un-vn+1 ; j-- > 0 ; )
+		{
+			uint u0 = un_[j+vn];
+			uint u1 = un_[j+vn-1];
+			uint u2 = un_[j+vn-2];
+			uint qp, rp, hi, lo;
+			bool rp_overflow = false;
+
+			// the estimation of the quotient from the two highest words
+			// (u0 can't be bigger than v1)
+			if( u0 == v1 )
+			{
+				qp          = TTMATH_UINT_MAX_VALUE;
+				rp          = u1 + v1;
+				rp_overflow = (rp < u1);
+			}
+			else
+			{
+				UInt<1>::DivTwoWords(u0, u1, v1, &qp, &rp);
+			}
+
+			// the estimation is corrected by the next word (at most two times)
+			while( !rp_overflow )
+			{
+				UInt<1>::MulTwoWords(qp, v2, &hi, &lo);
+
+				if( hi < rp || (hi == rp && lo <= u2) )
+					break;
+
+				qp         -= 1;
+				rp         += v1;
+				rp_overflow = (rp < v1);
+			}
+
+			uint c = UInt<1>::MulSubVector(vn_, qp, vn, un_+j);
+
+			if( un_[j+vn] < c )
+			{
+				// qp was too big by one (it's very rare)
+				--qp;
+				un_[j+vn] += UInt<1>::AddVector(un_+j, vn_, vn, vn, un_+j);
+			}
+
+			un_[j+vn] -= c;
+			q[j]       = qp;
+		}
+
+		if( shift != 0 )
+		{
+			UInt<1>::ShiftRightVector(un_, vn, shift, r);
+		}
+		else
+		{
+			for(i=0 ; i<vn ; ++i)
+				r[i] = un_[i];
+		}
+	}
+
+};
+
+
+} // namespace
+
+#endif
@@ -50,6 +50,9 @@
 namespace ttmath
 {
 
+template<uint value_size>
+class IntDivisor;
+
 
 /*!
 	\brief Int implements a big integer value with a sign
@@ -424,6 +427,61 @@ public:
 	}
 
 
+	/*!
+		multiplication and addition: this = this + ss1 * ss2
+
+		the product is calculated in a twice bigger Int and there is only
+		one test for the carry at the end (ss1*ss2 can be too big for
+		Int<value_size> but the sum not),
+		it returns a carry if the result is too big
+	*/
+	uint MulAdd(const Int<value_size> & ss1, const Int<value_size> & ss2)
+	{
+		return MulAddSub(ss1, ss2, false);
+	}
+
+
+	/*!
+		multiplication and subtraction: this = this - ss1 * ss2
+
+		it returns a carry if the result is too big
+	*/
+	uint MulSub(const Int<value_size> & ss1, const Int<value_size> & ss2)
+	{
+		return MulAddSub(ss1, ss2, true);
+	}
+
+
+private:
+
+	/*!
+		an auxiliary method for MulAdd() and MulSub()
+	*/
+	uint MulAddSub(const Int<value_size> & ss1, const Int<value_size> & ss2, bool subtract)
+	{
+	Int<value_size*2> product, sum;
+	Int<value_size> a(ss1), b(ss2);
+
+		// the absolute values are correct as UInt even for the smallest value
+		a.Abs();
+		b.Abs();
+		a.UInt<value_size>::MulBig(b, product);
+
+		// the product is smaller than 2^(value_size*2*TTMATH_BITS_PER_UINT-2)
+		// so it's a positive value in Int<value_size*2>
+		if( (ss1.IsSign() != ss2.IsSign()) != subtract )
+			product.ChangeSign();
+
+		sum.FromInt(*this);
+		sum.Add(product);
+
+	return FromInt(sum);
+	}
+
+
+public:
+
+
 	/*!
 		division this = this / ss2
 		returned values:
@@ -468,6 +526,35 @@ public:
 	}
 
 
+	/*!
+		division this = this / ss2
+
+		the same as Div(Int<value_size>) but the divisor is prepared earlier
+		(look at IntDivisor)
+	*/
+	uint Div(const IntDivisor<value_size> & ss2, Int<value_size> * remainder = 0)
+	{
+	bool ss1_is_sign = IsSign();
+
+		Abs();
+
+		uint c = UInt<value_size>::Div(ss2.divisor, remainder);
+
+		if( ss1_is_sign != ss2.is_sign )
+			SetSign();
+
+		if( ss1_is_sign && remainder )
+			remainder->SetSign();
+
+	return c;
+	}
+	
+	uint Div(const IntDivisor<value_size> & ss2, Int<value_size> & remainder)
+	{
+		return Div(ss2, &remainder);
+	}
+
+
 
 private:
 
@@ -534,6 +621,24 @@ public:
 	}
 
 
+	/*!
+		square root
+		this = floor( sqrt(this) ), e.g. Sqrt(10) = 3
+
+		it returns 1 if this is negative (the value is not changed then)
+		(look at UInt::Sqrt())
+	*/
+	uint Sqrt()
+	{
+		if( IsSign() )
+			return 1;
+
+		UInt<value_size>::Sqrt();
+
+	return 0;
+	}
+
+
 	/*!
 	*
 	*	convertion methods
@@ -1314,6 +1419,67 @@ public:
 
 };
 
+
+
+/*!
+	\brief IntDivisor is a divisor prepared for many divisions by the same value
+
+	it keeps the absolute value of the divisor (as UIntDivisor) and its sign,
+	look at Int::Div(const IntDivisor<value_size> &)
+*/
+template<uint value_size>
+class IntDivisor
+{
+public:
+
+	/*!
+		the absolute value of the divisor
+	*/
+	UIntDivisor<value_size> divisor;
+
+	/*!
+		true if the divisor is negative
+	*/
+	bool is_sign;
+
+
+	/*!
+		the default constructor - the divisor is zero
+	*/
+	IntDivisor()
+	{
+		is_sign = false;
+	}
+
+
+	/*!
+		a constructor for converting Int into this class
+	*/
+	explicit IntDivisor(const Int<value_size> & d)
+	{
+		Set(d);
+	}
+
+
+	/*!
+		it prepares the divisor
+
+		it returns 1 if the divisor is zero
+	*/
+	uint Set(const Int<value_size> & d)
+	{
+	Int<value_size> temp(d);
+
+		is_sign = temp.IsSign();
+
+		// the same as in Int::Div() - we don't have to test the carry from Abs()
+		temp.Abs();
+
+	return divisor.Set(temp);
+	}
+};
+
+
 } // namespace
 
 #endif
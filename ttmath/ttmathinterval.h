@@ -0,0 +1,1323 @@
+/*
+ * This file is a part of TTMath Bignum Library
+ * and is distributed under the (new) BSD licence.
+ * Author: Tomasz Sowa <t.sowa@slimaczek.pl>
+ */
+
+/*
+ * Copyright (c) 2006-2009, Tomasz Sowa
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ *  * Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ *  * Neither the name Tomasz Sowa nor the names of contributors to this
+ *    project may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#ifndef headerfilettmathinterval
+#define headerfilettmathinterval
+
+/*!
+	\file ttmathinterval.h
+    \brief class Interval - a range [lower, upper] of Big values which certainly contains the result
+*/
+
+#include "ttmath.h"
+
+
+namespace ttmath
+{
+
+
+/*!
+	\brief Interval implements the interval arithmetic on Big values
+
+	the object keeps two values: 'lower' and 'upper' and the real result
+	of a calculation is always somewhere between them (inclusive), the lower
+	bound is rounded toward minus infinity and the upper one toward plus infinity
+	(look at RoundingMode) so the bits which are cut off are never lost
+
+	this allows to make calculations with a small mantissa and to check
+	afterwards how many digits are certain -- if the interval is too wide
+	the calculation can be repeated with a greater mantissa
+
+	e.g.
+		Interval<1,2> x("0.1"), y;
+		Big<1,2> width;
+
+		y = x * x + x;
+		y.Width(width);
+
+		std::cout << y << " width: " << width << std::endl;
+
+	the mathematical functions: Exp(), Ln(), Sqrt(), Sin(), Cos() and Pow()
+	are defined for the intervals too (at the end of this file)
+
+	if an operation cannot be calculated (an overflow, a division by an interval
+	which contains zero etc.) both values are set to NaN
+*/
+template<uint exp, uint man>
+class Interval
+{
+public:
+
+Big<exp, man> lower;
+Big<exp, man> upper;
+
+
+
+	/*!
+		a default constructor
+		both values are NaN (as in Big)
+	*/
+	Interval()
+	{
+	}
+
+
+	/*!
+		a constructor for converting a Big value into an interval [value, value]
+	*/
+	Interval(const Big<exp, man> & value) : lower(value), upper(value)
+	{
+	}
+
+
+	/*!
+		a constructor for setting both values
+	*/
+	Interval(const Big<exp, man> & l, const Big<exp, man> & u) : lower(l), upper(u)
+	{
+	}
+
+
+	/*!
+		a constructor for converting a string into an interval
+		(the lower value is rounded down and the upper up)
+	*/
+	Interval(const char * string)
+	{
+		FromString(string);
+	}
+
+
+	/*!
+		a constructor for converting a string into an interval
+	*/
+	Interval(const std::string & string)
+	{
+		FromString(string.c_str());
+	}
+
+
+	/*!
+		this method sets the interval [value, value]
+	*/
+	void Set(const Big<exp, man> & value)
+	{
+		lower = value;
+		upper = value;
+	}
+
+
+	/*!
+		this method sets the interval [l, u]
+	*/
+	void Set(const Big<exp, man> & l, const Big<exp, man> & u)
+	{
+		lower = l;
+		upper = u;
+	}
+
+
+	/*!
+		this method sets NaN on both values
+	*/
+	void SetNan()
+	{
+		lower.SetNan();
+		upper.SetNan();
+	}
+
+
+	/*!
+		this method returns true if one of the values is NaN
+	*/
+	bool IsNan() const
+	{
+		return lower.IsNan() || upper.IsNan();
+	}
+
+
+	/*!
+		this method returns true if the interval has only one value (lower == upper)
+	*/
+	bool IsPoint() const
+	{
+		return !IsNan() && lower == upper;
+	}
+
+
+	/*!
+		this method returns true if 'value' is inside the interval
+	*/
+	bool Contains(const Big<exp, man> & value) const
+	{
+		if( IsNan() || value.IsNan() )
+			return false;
+
+	return lower <= value && value <= upper;
+	}
+
+
+	/*!
+		this method returns true if zero is inside the interval
+	*/
+	bool ContainsZero() const
+	{
+		if( IsNan() )
+			return false;
+
+	return (lower.IsSign() || lower.IsZero()) && !upper.IsSign();
+	}
+
+
+	/*!
+		this method calculates the width of the interval: result = upper - lower
+		(rounded up)
+
+		it returns a carry if the width is too big
+	*/
+	uint Width(Big<exp, man> & result) const
+	{
+		if( IsNan() )
+		{
+			result.SetNan();
+			return 1;
+		}
+
+		result = upper;
+
+	return result.Sub(lower, round_up);
+	}
+
+
+	/*!
+		this method calculates the middle of the interval: result = (lower + upper) / 2
+		(the value is not rounded in any special way, it only should be somewhere inside)
+
+		it returns a carry if the value is too big
+	*/
+	uint Middle(Big<exp, man> & result) const
+	{
+	Big<exp+1, man> sum, temp;
+	uint c = 0;
+
+		if( IsNan() )
+		{
+			result.SetNan();
+			return 1;
+		}
+
+		// the exponent has one word more so the sum cannot be too big
+		c += sum.FromBig(lower);
+		c += temp.FromBig(upper);
+		c += sum.Add(temp);
+
+		if( !sum.IsZero() )
+			c += sum.exponent.SubOne();
+
+		c += result.FromBig(sum);
+
+		// 'result' can be a little out of the interval because of the truncation
+		if( result < lower )
+			result = lower;
+		else
+		if( result > upper )
+			result = upper;
+
+	return c;
+	}
+
+
+	/*!
+		this method changes the sign: [lower, upper] -> [-upper, -lower]
+	*/
+	void ChangeSign()
+	{
+	Big<exp, man> temp(lower);
+
+		lower = upper;
+		upper = temp;
+		lower.ChangeSign();
+		upper.ChangeSign();
+	}
+
+
+	/*!
+		this method sets the absolute value
+	*/
+	void Abs()
+	{
+		if( IsNan() )
+			return;
+
+		if( !lower.IsSign() )
+			return;
+
+		if( upper.IsSign() )
+		{
+			ChangeSign();
+			return;
+		}
+
+		// the interval contains zero
+		lower.ChangeSign();
+
+		if( lower > upper )
+			upper = lower;
+
+		lower.SetZero();
+	}
+
+
+
+	/*!
+	*
+	*	basic mathematic functions
+	*
+	*/
+
+
+	/*!
+		addition: this = this + ss2
+		it returns a carry (in such a case both values are NaN)
+	*/
+	uint Add(const Interval<exp, man> & ss2)
+	{
+	uint c = 0;
+
+		c += lower.Add(ss2.lower, round_down);
+		c += upper.Add(ss2.upper, round_up);
+
+	return CheckCarry(c);
+	}
+
+
+	/*!
+		subtraction: this = this - ss2
+		it returns a carry (in such a case both values are NaN)
+
+		ss2 can be the same object as 'this' (the result is [lower-upper, upper-lower])
+	*/
+	uint Sub(const Interval<exp, man> & ss2)
+	{
+	Big<exp, man> l(lower), u(upper);
+	uint c = 0;
+
+		c += l.Sub(ss2.upper, round_down);
+		c += u.Sub(ss2.lower, round_up);
+
+		lower = l;
+		upper = u;
+
+	return CheckCarry(c);
+	}
+
+
+	/*!
+		multiplication: this = this * ss2
+		it returns a carry (in such a case both values are NaN)
+
+		depending on the signs of the bounds only two products are calculated
+		(four when both intervals contain zero)
+	*/
+	uint Mul(const Interval<exp, man> & ss2)
+	{
+	const Big<exp, man> * l1, * l2, * u1, * u2;
+	Big<exp, man> l, u;
+	uint c = 0;
+
+		if( IsNan() || ss2.IsNan() )
+			return CheckCarry(1);
+
+		int s1 = SignOfInterval();
+		int s2 = ss2.SignOfInterval();
+
+		if( s1 > 0 )
+		{
+			if( s2 > 0 )       { l1 = &lower; l2 = &ss2.lower; u1 = &upper; u2 = &ss2.upper; }
+			else if( s2 < 0 )  { l1 = &upper; l2 = &ss2.lower; u1 = &lower; u2 = &ss2.upper; }
+			else               { l1 = &upper; l2 = &ss2.lower; u1 = &upper; u2 = &ss2.upper; }
+		}
+		else
+		if( s1 < 0 )
+		{
+			if( s2 > 0 )       { l1 = &lower; l2 = &ss2.upper; u1 = &upper; u2 = &ss2.lower; }
+			else if( s2 < 0 )  { l1 = &upper; l2 = &ss2.upper; u1 = &lower; u2 = &ss2.lower; }
+			else               { l1 = &lower; l2 = &ss2.upper; u1 = &lower; u2 = &ss2.lower; }
+		}
+		else
+		{
+			if( s2 > 0 )       { l1 = &lower; l2 = &ss2.upper; u1 = &upper; u2 = &ss2.upper; }
+			else if( s2 < 0 )  { l1 = &upper; l2 = &ss2.lower; u1 = &lower; u2 = &ss2.lower; }
+			else
+			{
+				// both intervals contain zero
+				Big<exp, man> l_other, u_other;
+
+				l = lower;  c += l.Mul(ss2.upper, round_down);
+				l_other = upper; c += l_other.Mul(ss2.lower, round_down);
+				u = lower;  c += u.Mul(ss2.lower, round_up);
+				u_other = upper; c += u_other.Mul(ss2.upper, round_up);
+
+				lower = (l_other < l) ? l_other : l;
+				upper = (u_other > u) ? u_other : u;
+
+			return CheckCarry(c);
+			}
+		}
+
+		l = *l1;
+		u = *u1;
+		c += l.Mul(*l2, round_down);
+		c += u.Mul(*u2, round_up);
+
+		lower = l;
+		upper = u;
+
+	return CheckCarry(c);
+	}
+
+
+	/*!
+		division: this = this / ss2
+		it returns a carry (in such a case both values are NaN),
+		if ss2 contains zero the result is NaN and the method returns 1
+	*/
+	uint Div(const Interval<exp, man> & ss2)
+	{
+	const Big<exp, man> * l1, * l2, * u1, * u2;
+	Big<exp, man> l, u;
+	uint c = 0;
+
+		if( IsNan() || ss2.IsNan() )
+			return CheckCarry(1);
+
+		int s1 = SignOfInterval();
+		int s2 = ss2.SignOfInterval();
+
+		if( s2 == 0 || ss2.lower.IsZero() || ss2.upper.IsZero() )
+			return CheckCarry(1);
+
+		if( s2 > 0 )
+		{
+			if( s1 > 0 )       { l1 = &lower; l2 = &ss2.upper; u1 = &upper; u2 = &ss2.lower; }
+			else if( s1 < 0 )  { l1 = &lower; l2 = &ss2.lower; u1 = &upper; u2 = &ss2.upper; }
+			else               { l1 = &lower; l2 = &ss2.lower; u1 = &upper; u2 = &ss2.lower; }
+		}
+		else
+		{
+			if( s1 > 0 )       { l1 = &upper; l2 = &ss2.upper; u1 = &lower; u2 = &ss2.lower; }
+			else if( s1 < 0 )  { l1 = &upper; l2 = &ss2.lower; u1 = &lower; u2 = &ss2.upper; }
+			else               { l1 = &upper; l2 = &ss2.upper; u1 = &lower; u2 = &ss2.upper; }
+		}
+
+		l = *l1;
+		u = *u1;
+		c += l.Div(*l2, round_down);
+		c += u.Div(*u2, round_up);
+
+		lower = l;
+		upper = u;
+
+	return CheckCarry(c);
+	}
+
+
+private:
+
+
+	/*!
+		this method sets NaN if there was a carry (and returns 1 in such a case)
+	*/
+	uint CheckCarry(uint c)
+	{
+		if( c != 0 )
+		{
+			SetNan();
+			return 1;
+		}
+
+	return 0;
+	}
+
+
+	/*!
+		it returns:
+			 1 - if the interval is greater than or equal to zero
+			-1 - if the interval is less than or equal to zero (and not [0,0])
+			 0 - if the interval contains zero inside (lower < 0 < upper)
+	*/
+	int SignOfInterval() const
+	{
+		if( !lower.IsSign() )
+			return 1;
+
+		if( upper.IsSign() || upper.IsZero() )
+			return -1;
+
+	return 0;
+	}
+
+
+public:
+
+
+	/*!
+		a method for converting a string into an interval
+
+		the value is read twice: the lower bound is rounded down and the upper up
+		(a value such as "0.1" cannot be kept exactly in a Big)
+
+		it returns a carry if the value is too big or the string is incorrect
+	*/
+	uint FromString(const char * source, uint base = 10, const char ** after_source = 0, bool * value_read = 0)
+	{
+	uint c = 0;
+
+		c += lower.FromString(source, round_down, base);
+		c += upper.FromString(source, round_up, base, after_source, value_read);
+
+	return CheckCarry(c);
+	}
+
+
+	/*!
+		a method for converting a string into an interval
+	*/
+	uint FromString(const std::string & string, uint base = 10)
+	{
+		return FromString(string.c_str(), base);
+	}
+
+
+	/*!
+		this method converts the interval into a string in the form "[lower, upper]"
+	*/
+	uint ToString(std::string & result, uint base = 10) const
+	{
+	std::string temp;
+	uint c = 0;
+
+		result = "[";
+		c += lower.ToString(temp, base);
+		result += temp;
+		result += ", ";
+		c += upper.ToString(temp, base);
+		result += temp;
+		result += "]";
+
+	return c;
+	}
+
+
+	/*!
+		an operator= for converting a Big value into an interval [value, value]
+	*/
+	Interval<exp, man> & operator=(const Big<exp, man> & value)
+	{
+		Set(value);
+
+	return *this;
+	}
+
+
+	/*!
+		an operator= for converting a string into an interval
+	*/
+	Interval<exp, man> & operator=(const char * string)
+	{
+		FromString(string);
+
+	return *this;
+	}
+
+
+	/*!
+		an operator= for converting a string into an interval
+	*/
+	Interval<exp, man> & operator=(const std::string & string)
+	{
+		FromString(string.c_str());
+
+	return *this;
+	}
+
+
+	/*!
+	*
+	*	standard mathematical operators 
+	*
+	*/
+
+
+	bool operator==(const Interval<exp, man> & ss2) const
+	{
+		return lower == ss2.lower && upper == ss2.upper;
+	}
+
+
+	bool operator!=(const Interval<exp, man> & ss2) const
+	{
+		return !operator==(ss2);
+	}
+
+
+	Interval<exp, man> operator-() const
+	{
+	Interval<exp, man> temp(*this);
+
+		temp.ChangeSign();
+
+	return temp;
+	}
+
+
+	Interval<exp, man> operator-(const Interval<exp, man> & ss2) const
+	{
+	Interval<exp, man> temp(*this);
+
+		temp.Sub(ss2);
+
+	return temp;
+	}
+
+
+	Interval<exp, man> & operator-=(const Interval<exp, man> & ss2)
+	{
+		Sub(ss2);
+
+	return *this;
+	}
+
+
+	Interval<exp, man> operator+(const Interval<exp, man> & ss2) const
+	{
+	Interval<exp, man> temp(*this);
+
+		temp.Add(ss2);
+
+	return temp;
+	}
+
+
+	Interval<exp, man> & operator+=(const Interval<exp, man> & ss2)
+	{
+		Add(ss2);
+
+	return *this;
+	}
+
+
+	Interval<exp, man> operator*(const Interval<exp, man> & ss2) const
+	{
+	Interval<exp, man> temp(*this);
+
+		temp.Mul(ss2);
+
+	return temp;
+	}
+
+
+	Interval<exp, man> & operator*=(const Interval<exp, man> & ss2)
+	{
+		Mul(ss2);
+
+	return *this;
+	}
+
+
+	Interval<exp, man> operator/(const Interval<exp, man> & ss2) const
+	{
+	Interval<exp, man> temp(*this);
+
+		temp.Div(ss2);
+
+	return temp;
+	}
+
+
+	Interval<exp, man> & operator/=(const Interval<exp, man> & ss2)
+	{
+		Div(ss2);
+
+	return *this;
+	}
+
+
+	/*!
+		an output operator for standard streams ("[lower, upper]")
+	*/
+	friend std::ostream & operator<<(std::ostream & s, const Interval<exp, man> & l)
+	{
+	std::string ss;
+
+		l.ToString(ss);
+		s << ss;
+
+	return s;
+	}
+
+};
+
+
+
+
+	/*
+	 *
+	 *  the mathematical functions for intervals
+	 *
+	 *  each bound is calculated by a function from ttmath.h with one word of the mantissa
+	 *  more (Big<exp, man+1>) and then it's moved outward by |scale| * 2^(-man*TTMATH_BITS_PER_UINT)
+	 *  (the scale is chosen for each function) and rounded down or up to Big<exp, man>,
+	 *  so the result is certain as long as the function is accurate to man*TTMATH_BITS_PER_UINT bits
+	 *  when it's calculated with one word more -- the last word is only for the error
+	 *
+	 */
+
+
+	namespace auxiliaryfunctions
+	{
+
+	/*!
+		this function calculates one bound of an interval: value - margin (rounded down)
+		or value + margin (rounded up) where margin = |scale| * 2^(-man*TTMATH_BITS_PER_UINT)
+
+		it returns a carry
+	*/
+	template<uint exp, uint man>
+	uint IntervalBound(	const Big<exp, man+1> & value, const Big<exp, man+1> & scale,
+						bool upper_bound, Big<exp, man> & result)
+	{
+	Big<exp, man+1> margin(scale), temp(value);
+	uint c = 0;
+
+		margin.Abs();
+
+		if( !margin.IsZero() )
+			c += margin.exponent.SubInt(man * TTMATH_BITS_PER_UINT);
+
+		if( upper_bound )
+		{
+			c += temp.Add(margin, round_up);
+			c += result.FromBig(temp, round_up);
+		}
+		else
+		{
+			c += temp.Sub(margin, round_down);
+			c += result.FromBig(temp, round_down);
+		}
+
+		if( c )
+			result.SetNan();
+
+	return c;
+	}
+
+
+	/*!
+		this function calculates both bounds of an increasing function 'fun'
+		(Exp, Ln, Sqrt) and returns the error code
+
+		scale_plus_one - if true the scale of the margin is |fun(x)| + 1 (it's used
+		for Ln() where the result can be close to zero when x is close to one),
+		otherwise the scale is |fun(x)|
+	*/
+	template<uint exp, uint man>
+	ErrorCode IntervalIncreasing(	const Interval<exp, man> & x, Interval<exp, man> & result,
+									ErrorCode (*fun)(const Big<exp, man+1> &, Big<exp, man+1> &),
+									bool scale_plus_one)
+	{
+	Big<exp, man+1> value, scale;
+	Interval<exp, man> temp;
+	uint c = 0;
+	ErrorCode err;
+
+		value.FromBig(x.lower);
+		err = fun(value, value);
+
+		if( err == err_ok )
+		{
+			scale = value;
+
+			if( scale_plus_one )
+			{
+				scale.Abs();
+				c += scale.Add( Big<exp, man+1>(1) );
+			}
+
+			c += IntervalBound(value, scale, false, temp.lower);
+
+			value.FromBig(x.upper);
+			err = fun(value, value);
+		}
+
+		if( err == err_ok )
+		{
+			scale = value;
+
+			if( scale_plus_one )
+			{
+				scale.Abs();
+				c += scale.Add( Big<exp, man+1>(1) );
+			}
+
+			c += IntervalBound(value, scale, true, temp.upper);
+		}
+
+		if( err == err_ok && c )
+			err = err_overflow;
+
+		if( err != err_ok )
+		{
+			result.SetNan();
+			return err;
+		}
+
+		result = temp;
+
+	return err_ok;
+	}
+
+
+	/*!
+		this function returns true if there can be such an integer n that
+		lower <= offset + 2*pi*n <= upper
+
+		it's calculated with one word of the mantissa more and the test
+		is extended by the same margin as the bounds so when 'offset + 2*pi*n' is
+		very close to 'lower' or 'upper' the function returns true
+		(then the interval will be only a little wider than needed)
+	*/
+	template<uint exp, uint man>
+	bool IntervalContainsPeriodicPoint(	const Big<exp, man+1> & lower, const Big<exp, man+1> & upper,
+										const Big<exp, man+1> & offset)
+	{
+	Big<exp, man+1> a(lower), b(upper), two_pi, margin, temp;
+	uint c = 0;
+
+		two_pi.Set2Pi();
+
+		// a = (lower - offset) / (2*pi), b = (upper - offset) / (2*pi)
+		c += a.Sub(offset);
+		c += a.Div(two_pi);
+		c += b.Sub(offset);
+		c += b.Div(two_pi);
+
+		// margin = (1 + |a| + |b|) * 2^(-man*TTMATH_BITS_PER_UINT)
+		margin.SetOne();
+		temp = a;
+		temp.Abs();
+		c += margin.Add(temp);
+		temp = b;
+		temp.Abs();
+		c += margin.Add(temp);
+		c += margin.exponent.SubInt(man * TTMATH_BITS_PER_UINT);
+
+		c += a.Sub(margin);
+		c += b.Add(margin);
+
+		if( c )
+			// we don't know, the caller will take the whole range
+			return true;
+
+		// is there an integer in [a, b]
+		a = Ceil(a);
+		b = Floor(b);
+
+	return a <= b;
+	}
+
+
+	/*!
+		this function calculates Sin() (if 'cosine' is false) or Cos() for an interval
+
+		the bounds are calculated from the values at the ends of the interval
+		and then they're extended to 1 or -1 if the interval contains
+		a maximum or a minimum of the function
+	*/
+	template<uint exp, uint man>
+	ErrorCode IntervalSinCos(const Interval<exp, man> & x, Interval<exp, man> & result, bool cosine)
+	{
+	Big<exp, man+1> lower, upper, fun_lower, fun_upper, scale, offset, half_pi, one;
+	Interval<exp, man> temp, bound;
+	ErrorCode err;
+	uint c = 0;
+
+		if( x.IsNan() )
+		{
+			result.SetNan();
+			return err_improper_argument;
+		}
+
+		lower.FromBig(x.lower);
+		upper.FromBig(x.upper);
+		one.SetOne();
+
+		if( cosine )
+		{
+			err = Cos(lower, fun_lower);
+			if( err == err_ok )
+				err = Cos(upper, fun_upper);
+		}
+		else
+		{
+			err = Sin(lower, fun_lower);
+			if( err == err_ok )
+				err = Sin(upper, fun_upper);
+		}
+
+		if( err != err_ok )
+		{
+			result.SetNan();
+			return err;
+		}
+
+		// the error of Sin() and Cos() depends on how big x is (the reduction to [0, 2pi))
+		scale = lower;
+		scale.Abs();
+		c += scale.Add(one);
+		c += IntervalBound(fun_lower, scale, false, temp.lower);
+		c += IntervalBound(fun_lower, scale, true,  temp.upper);
+
+		scale = upper;
+		scale.Abs();
+		c += scale.Add(one);
+		c += IntervalBound(fun_upper, scale, false, bound.lower);
+		c += IntervalBound(fun_upper, scale, true,  bound.upper);
+
+		if( c )
+		{
+			result.SetNan();
+			return err_overflow;
+		}
+
+		if( bound.lower < temp.lower )
+			temp.lower = bound.lower;
+
+		if( bound.upper > temp.upper )
+			temp.upper = bound.upper;
+
+		// the maximum: sin at pi/2 + 2*pi*n, cos at 2*pi*n
+		// the minimum: sin at -pi/2 + 2*pi*n, cos at pi + 2*pi*n
+		half_pi.Set05Pi();
+
+		if( cosine )
+			offset.SetZero();
+		else
+			offset = half_pi;
+
+		if( IntervalContainsPeriodicPoint<exp, man>(lower, upper, offset) )
+			temp.upper.SetOne();
+
+		if( cosine )
+			offset.SetPi();
+		else
+			offset.ChangeSign();
+
+		if( IntervalContainsPeriodicPoint<exp, man>(lower, upper, offset) )
+		{
+			temp.lower.SetOne();
+			temp.lower.ChangeSign();
+		}
+
+		// the margin could move the bounds out of [-1, 1]
+		if( temp.upper > Big<exp, man>(1) )
+			temp.upper.SetOne();
+
+		if( temp.lower < Big<exp, man>(-1) )
+		{
+			temp.lower.SetOne();
+			temp.lower.ChangeSign();
+		}
+
+		result = temp;
+
+	return err_ok;
+	}
+
+	} // namespace auxiliaryfunctions
+
+
+
+	/*!
+		the natural exponent function for an interval
+	*/
+	template<uint exp, uint man>
+	ErrorCode Exp(const Interval<exp, man> & x, Interval<exp, man> & result)
+	{
+		if( x.IsNan() )
+		{
+			result.SetNan();
+			return err_improper_argument;
+		}
+
+	return auxiliaryfunctions::IntervalIncreasing<exp, man>(x, result, Exp, false);
+	}
+
+
+	/*!
+		the natural exponent function for an interval
+	*/
+	template<uint exp, uint man>
+	Interval<exp, man> Exp(const Interval<exp, man> & x, ErrorCode * err = 0)
+	{
+	Interval<exp, man> result;
+
+		ErrorCode e = Exp(x, result);
+
+		if( err )
+			*err = e;
+
+	return result;
+	}
+
+
+	/*!
+		the natural logarithm for an interval
+		(the whole interval must be greater than zero)
+	*/
+	template<uint exp, uint man>
+	ErrorCode Ln(const Interval<exp, man> & x, Interval<exp, man> & result)
+	{
+		if( x.IsNan() || x.lower.IsSign() || x.lower.IsZero() )
+		{
+			result.SetNan();
+			return err_improper_argument;
+		}
+
+	return auxiliaryfunctions::IntervalIncreasing<exp, man>(x, result, Ln, true);
+	}
+
+
+	/*!
+		the natural logarithm for an interval
+	*/
+	template<uint exp, uint man>
+	Interval<exp, man> Ln(const Interval<exp, man> & x, ErrorCode * err = 0)
+	{
+	Interval<exp, man> result;
+
+		ErrorCode e = Ln(x, result);
+
+		if( err )
+			*err = e;
+
+	return result;
+	}
+
+
+	/*!
+		the square root for an interval
+		(the whole interval must be greater than or equal to zero)
+	*/
+	template<uint exp, uint man>
+	ErrorCode Sqrt(const Interval<exp, man> & x, Interval<exp, man> & result)
+	{
+		if( x.IsNan() || x.lower.IsSign() )
+		{
+			result.SetNan();
+			return err_improper_argument;
+		}
+
+		ErrorCode err = auxiliaryfunctions::IntervalIncreasing<exp, man>(x, result, Sqrt, false);
+
+		// the lower bound can be a little less than zero because of the margin
+		if( err == err_ok && result.lower.IsSign() )
+			result.lower.SetZero();
+
+	return err;
+	}
+
+
+	/*!
+		the square root for an interval
+	*/
+	template<uint exp, uint man>
+	Interval<exp, man> Sqrt(const Interval<exp, man> & x, ErrorCode * err = 0)
+	{
+	Interval<exp, man> result;
+
+		ErrorCode e = Sqrt(x, result);
+
+		if( err )
+			*err = e;
+
+	return result;
+	}
+
+
+	/*!
+		the sine for an interval
+	*/
+	template<uint exp, uint man>
+	ErrorCode Sin(const Interval<exp, man> & x, Interval<exp, man> & result)
+	{
+		return auxiliaryfunctions::IntervalSinCos(x, result, false);
+	}
+
+
+	/*!
+		the sine for an interval
+	*/
+	template<uint exp, uint man>
+	Interval<exp, man> Sin(const Interval<exp, man> & x, ErrorCode * err = 0)
+	{
+	Interval<exp, man> result;
+
+		ErrorCode e = Sin(x, result);
+
+		if( err )
+			*err = e;
+
+	return result;
+	}
+
+
+	/*!
+		the cosine for an interval
+	*/
+	template<uint exp, uint man>
+	ErrorCode Cos(const Interval<exp, man> & x, Interval<exp, man> & result)
+	{
+		return auxiliaryfunctions::IntervalSinCos(x, result, true);
+	}
+
+
+	/*!
+		the cosine for an interval
+	*/
+	template<uint exp, uint man>
+	Interval<exp, man> Cos(const Interval<exp, man> & x, ErrorCode * err = 0)
+	{
+	Interval<exp, man> result;
+
+		ErrorCode e = Cos(x, result);
+
+		if( err )
+			*err = e;
+
+	return result;
+	}
+
+
+	/*!
+		the power for intervals: result = x ^ y = Exp(y * Ln(x))
+		(the whole interval x must be greater than zero)
+	*/
+	template<uint exp, uint man>
+	ErrorCode Pow(const Interval<exp, man> & x, const Interval<exp, man> & y, Interval<exp, man> & result)
+	{
+	Interval<exp, man> temp;
+
+		ErrorCode err = Ln(x, temp);
+
+		if( err == err_ok && temp.Mul(y) )
+			err = err_overflow;
+
+		if( err == err_ok )
+			err = Exp(temp, result);
+		else
+			result.SetNan();
+
+	return err;
+	}
+
+
+	/*!
+		the power for intervals: x ^ y
+	*/
+	template<uint exp, uint man>
+	Interval<exp, man> Pow(const Interval<exp, man> & x, const Interval<exp, man> & y, ErrorCode * err = 0)
+	{
+	Interval<exp, man> result;
+
+		ErrorCode e = Pow(x, y, result);
+
+		if( err )
+			*err = e;
+
+	return result;
+	}
+
+
+
+
+
+	/*
+	 *
+	 *  the adaptive precision
+	 *
+	 */
+
+
+	namespace auxiliaryfunctions
+	{
+
+	/*!
+		this function calculates 'fun' with Interval<exp, work_man> and sets 'result'
+		to the middle of the interval
+
+		it returns true if the calculation is finished: either there was an error
+		or the width of the interval is not greater than |middle| * 2^(-bits)
+	*/
+	template<uint exp, uint work_man, class Function, uint man>
+	bool AdaptiveTry(const Function & fun, Big<exp, man> & result, uint bits, uint * used_man, ErrorCode & err)
+	{
+	Interval<exp, work_man> value;
+	Big<exp, work_man> middle, width, limit;
+
+		err = fun(value);
+
+		if( used_man )
+			*used_man = work_man;
+
+		if( err == err_ok && (value.Middle(middle) || value.Width(width)) )
+			err = err_overflow;
+
+		if( err != err_ok )
+		{
+			result.SetNan();
+			return true;
+		}
+
+		result.FromBig(middle, round_nearest_even);
+
+		limit = middle;
+		limit.Abs();
+
+		if( !limit.IsZero() && limit.exponent.SubInt(bits) )
+			// |middle| * 2^(-bits) is too small to be represented
+			limit.SetZero();
+
+	return width <= limit;
+	}
+
+
+	/*!
+		an auxiliary class for AdaptiveCalculate()
+
+		it calculates 'fun' with Interval<exp, work_man>, then with
+		Interval<exp, work_man*2> and so on (till max_man)
+	*/
+	template<uint exp, uint work_man, uint max_man, bool last = (work_man*2 > max_man)>
+	struct AdaptiveStep
+	{
+		template<class Function, uint man>
+		static ErrorCode Calculate(const Function & fun, Big<exp, man> & result, uint bits, uint * used_man)
+		{
+		ErrorCode err;
+
+			if( AdaptiveTry<exp, work_man>(fun, result, bits, used_man, err) )
+				return err;
+
+		return AdaptiveStep<exp, work_man*2, max_man>::Calculate(fun, result, bits, used_man);
+		}
+	};
+
+
+	/*!
+		the last step (work_man is the greatest mantissa which can be used)
+	*/
+	template<uint exp, uint work_man, uint max_man>
+	struct AdaptiveStep<exp, work_man, max_man, true>
+	{
+		template<class Function, uint man>
+		static ErrorCode Calculate(const Function & fun, Big<exp, man> & result, uint bits, uint * used_man)
+		{
+		ErrorCode err;
+
+			if( AdaptiveTry<exp, work_man>(fun, result, bits, used_man, err) )
+				return err;
+
+		return err_precision_not_reached;
+		}
+	};
+
+	} // namespace auxiliaryfunctions
+
+
+	/*!
+		the adaptive precision: it calculates 'fun' with the smallest mantissa
+		which gives 'bits' correct bits of the result
+
+		the calculation is made on intervals: at the beginning with Interval<exp, start_man>
+		and if the interval is too wide (its width is greater than |middle| * 2^(-bits))
+		it's repeated with Interval<exp, start_man*2>, Interval<exp, start_man*4> ...
+		up to Interval<exp, max_man>, the result is the middle of the last interval
+		rounded to the nearest Big<exp, man>
+
+		'fun' is an object with a template operator() which calculates the value
+		and returns an error code (it's instantiated for each mantissa):
+			struct Fun
+			{
+				template<uint exp, uint man>
+				ErrorCode operator()(Interval<exp, man> & result) const
+				{
+					Interval<exp, man> x("1.1");
+					return Sin(Exp(x), result);
+				}
+			};
+
+			Big<3,64> result;
+			ErrorCode err = AdaptiveCalculate<1, 64>(Fun(), result, 200);
+
+		'bits' - how many bits of the result should be correct, zero means all bits
+		         of the mantissa of 'result' (man * TTMATH_BITS_PER_UINT)
+		'used_man' - if given it's set to the mantissa used by the last calculation
+
+		it returns:
+			err_ok                    - the result has 'bits' correct bits
+			err_precision_not_reached - even with max_man the interval was too wide
+			                            (the result is set to the middle of it),
+			                            this is the case when the result is zero
+			                            and the interval is not [0, 0]
+			other codes               - the error from 'fun' (the result is NaN)
+	*/
+	template<uint start_man, uint max_man, class Function, uint exp, uint man>
+	ErrorCode AdaptiveCalculate(const Function & fun, Big<exp, man> & result, uint bits = 0, uint * used_man = 0)
+	{
+		if( bits == 0 )
+			bits = man * TTMATH_BITS_PER_UINT;
+
+	return auxiliaryfunctions::AdaptiveStep<exp, start_man, max_man>::Calculate(fun, result, bits, used_man);
+	}
+
+
+} // namespace
+
+#endif
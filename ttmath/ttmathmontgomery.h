@@ -0,0 +1,653 @@
+/*
+ * This file is a part of TTMath Bignum Library
+ * and is distributed under the (new) BSD licence.
+ * Author: Tomasz Sowa <t.sowa@slimaczek.pl>
+ */
+
+/*
+ * Copyright (c) 2006-2009, Tomasz Sowa
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ *  * Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ *  * Neither the name Tomasz Sowa nor the names of contributors to this
+ *    project may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#ifndef headerfilettmathmontgomery
+#define headerfilettmathmontgomery
+
+/*!
+	\file ttmathmontgomery.h
+    \brief template class UIntMontgomery<uint> - modular arithmetic with the Montgomery reduction
+*/
+
+#include "ttmathuint.h"
+
+
+namespace ttmath
+{
+
+
+/*!
+	\brief UIntMontgomery is a context for the modular arithmetic with an odd modulus
+
+	the values are kept in the Montgomery form: x' = x*R mod modulus
+	where R = 2^(size*TTMATH_BITS_PER_UINT) and 'size' is the number of words of the modulus,
+	in this form the multiplication doesn't need any division:
+		MulMod(a', b') = a'*b'/R mod modulus = (a*b)' (the Montgomery reduction - Redc())
+
+	e.g.
+		UIntMontgomery<8> mont(modulus);
+		mont.PowMod(x, pow, result); // result = x^pow mod modulus
+
+	or if there are a lot of multiplications:
+		mont.ToMontgomery(a, a2);
+		mont.ToMontgomery(b, b2);
+		mont.MulMod(a2, b2, c2);
+		mont.FromMontgomery(c2, c); // c = a*b mod modulus
+
+	all temporary values are on the stack (there is no heap allocation)
+*/
+template<uint value_size>
+class UIntMontgomery
+{
+public:
+
+	/*!
+		the modulus (it must be odd)
+	*/
+	UInt<value_size> modulus;
+
+	/*!
+		how many words the modulus has (zero if the context is not prepared)
+	*/
+	uint size;
+
+	/*!
+		-modulus^(-1) mod 2^TTMATH_BITS_PER_UINT
+	*/
+	uint inverse;
+
+	/*!
+		R mod modulus (one in the Montgomery form)
+	*/
+	UInt<value_size> one;
+
+	/*!
+		R^2 mod modulus (it's used when converting into the Montgomery form)
+	*/
+	UInt<value_size> r2;
+
+	/*!
+		the modulus prepared for the division (used when reducing values)
+	*/
+	UIntDivisor<value_size> divisor;
+
+
+	/*!
+		the default constructor - the context is not prepared
+	*/
+	UIntMontgomery()
+	{
+		modulus.SetZero();
+		one.SetZero();
+		r2.SetZero();
+		size    = 0;
+		inverse = 0;
+	}
+
+
+	/*!
+		a constructor for converting the modulus into this class
+	*/
+	explicit UIntMontgomery(const UInt<value_size> & m)
+	{
+		Set(m);
+	}
+
+
+	/*!
+		it prepares the context
+
+		it returns 1 if the modulus is zero or even (the Montgomery
+		reduction can't be used then and the context is not prepared)
+	*/
+	uint Set(const UInt<value_size> & m)
+	{
+	uint i, x, m0;
+
+		modulus = m;
+		inverse = 0;
+		one.SetZero();
+		r2.SetZero();
+
+		for(size=value_size ; size>0 && m.table[size-1]==0 ; --size);
+
+		if( size == 0 || (m.table[0] & 1) == 0 )
+		{
+			size = 0;
+			return 1;
+		}
+
+		divisor.Set(m);
+
+		// the Newton's iteration x = x*(2 - m0*x) (mod 2^bits), each step doubles
+		// the number of correct bits (x=1 is correct for the lowest bit)
+		m0 = m.table[0];
+		x  = 1;
+
+		for(i=1 ; i<TTMATH_BITS_PER_UINT ; i*=2)
+			x *= 2 - m0 * x;
+
+		inverse = 0 - x;
+
+		// one = R mod m
+		// if size==value_size then R is 2^(value_size*TTMATH_BITS_PER_UINT)
+		// and we're taking (R - m) which is equal modulo m
+		UInt<value_size> temp;
+		temp.SetZero();
+
+		if( size < value_size )
+			temp.table[size] = 1;
+		else
+			temp.Sub(m);
+
+		temp.Div(divisor, one);
+
+		// r2 = R^2 mod m
+		// 'one' is the Montgomery form of 1, after doubling it 'size' times
+		// we have the Montgomery form of 2^size, and squaring it log2(TTMATH_BITS_PER_UINT)
+		// times gives the Montgomery form of 2^(size*TTMATH_BITS_PER_UINT) = R which is R*R mod m
+		r2 = one;
+
+		for(i=0 ; i<size ; ++i)
+			AddMod(r2, r2, r2);
+
+		for(i=1 ; i<TTMATH_BITS_PER_UINT ; i*=2)
+			SqrMod(r2, r2);
+
+	return 0;
+	}
+
+
+	/*!
+		result = x mod modulus
+
+		if the context is not prepared (the modulus is zero) the result is zero
+	*/
+	void Reduce(const UInt<value_size> & x, UInt<value_size> & result) const
+	{
+	UInt<value_size> temp(x);
+
+		if( temp.Div(divisor, result) )
+			// division by zero, the remainder is not set
+			result.SetZero();
+	}
+
+
+	/*!
+		converting x into the Montgomery form: result = x*R mod modulus
+
+		x can be any value (it is reduced first)
+	*/
+	void ToMontgomery(const UInt<value_size> & x, UInt<value_size> & result) const
+	{
+		Reduce(x, result);
+		MulMod(result, r2, result);
+	}
+
+
+	/*!
+		converting x from the Montgomery form: result = x/R mod modulus
+	*/
+	void FromMontgomery(const UInt<value_size> & x, UInt<value_size> & result) const
+	{
+	UInt<value_size*2> temp;
+
+		temp = x;
+		Redc(temp, result);
+	}
+
+
+	/*!
+		the Montgomery reduction: result = t/R mod modulus
+
+		t must be smaller than modulus*R, it is destroyed
+	*/
+	void Redc(UInt<value_size*2> & t, UInt<value_size> & result) const
+	{
+	uint i, u, x, c = 0;
+
+		TTMATH_ASSERT( size > 0 )
+
+		for(i=0 ; i<size ; ++i)
+		{
+			// after adding u*modulus the word t[i] will be zero
+			u = t.table[i] * inverse;
+			x = UInt<value_size>::MulAddVector(modulus.table, u, size, t.table + i);
+
+			// the carry from t[i+size] is not propagated now
+			// but it is added to the next word in the next step
+			x += c;
+			c  = UInt<value_size>::ConstantTime_Smaller(x, c);
+			t.table[i+size] += x;
+			c += UInt<value_size>::ConstantTime_Smaller(t.table[i+size], x);
+		}
+
+		// now t / R is in t[size..2*size-1] and in the carry c, and it's smaller than 2*modulus
+		for(i=0 ; i<size ; ++i)
+			result.table[i] = t.table[i+size];
+
+		for( ; i<value_size ; ++i)
+			result.table[i] = 0;
+
+		if( size < value_size )
+		{
+			result.table[size] = c;
+			c = 0;
+		}
+
+		SubModulus(result, c);
+
+		TTMATH_LOG("UIntMontgomery::Redc")
+	}
+
+
+	/*!
+		result = a + b mod modulus
+
+		a and b must be smaller than modulus
+		(it doesn't matter whether they are in the Montgomery form or not)
+	*/
+	void AddMod(const UInt<value_size> & a, const UInt<value_size> & b, UInt<value_size> & result) const
+	{
+	UInt<value_size> temp(a);
+
+		uint c = temp.Add(b);
+		SubModulus(temp, c);
+
+		result = temp;
+	}
+
+
+	/*!
+		the Montgomery multiplication: result = a*b/R mod modulus
+
+		a and b must be smaller than modulus
+		(for values in the Montgomery form the result is in the Montgomery form too)
+	*/
+	void MulMod(const UInt<value_size> & a, const UInt<value_size> & b, UInt<value_size> & result) const
+	{
+		if( &a == &b )
+			return SqrMod(a, result);
+
+	UInt<value_size*2> product;
+
+		if( size < TTMATH_MONTGOMERY_MULBIG_FROM_SIZE )
+		{
+			MulMod_Rows(a, b, product);
+		}
+		else
+		{
+			UInt<value_size> temp(a);
+			temp.MulBig(b, product);
+		}
+
+		Redc(product, result);
+	}
+
+
+	/*!
+		the Montgomery squaring: result = a*a/R mod modulus
+
+		a must be smaller than modulus
+	*/
+	void SqrMod(const UInt<value_size> & a, UInt<value_size> & result) const
+	{
+	UInt<value_size*2> product;
+
+		if( size < TTMATH_MONTGOMERY_MULBIG_FROM_SIZE )
+		{
+			SqrMod_Rows(a, product);
+		}
+		else
+		{
+			UInt<value_size> temp(a);
+			temp.SqrBig(product);
+		}
+
+		Redc(product, result);
+	}
+
+
+	/*!
+		the modular exponentiation: result = x^pow mod modulus
+
+		x and result are in the normal form (not in the Montgomery form),
+		the sliding window method is used (with odd powers of x in the window),
+		in the constant-time mode the fixed window is used (PowMod_FixedWindow())
+
+		it returns 1 if the context is not prepared (the modulus is even or zero)
+	*/
+	template<uint pow_size>
+	uint PowMod(const UInt<value_size> & x, const UInt<pow_size> & pow, UInt<value_size> & result) const
+	{
+		if( size == 0 )
+			return 1;
+
+	#ifdef TTMATH_CONSTANT_TIME
+
+		return PowMod_FixedWindow(x, pow, result);
+
+	#else
+
+		return PowMod_SlidingWindow(x, pow, result);
+
+	#endif
+	}
+
+
+private:
+
+
+#ifndef TTMATH_CONSTANT_TIME
+
+	/*!
+		the modular exponentiation with the sliding window (x^pow mod modulus)
+
+		the number of multiplications and which powers of x are taken
+		depend on the bits of 'pow' so it's not used in the constant-time mode
+	*/
+	template<uint pow_size>
+	uint PowMod_SlidingWindow(const UInt<value_size> & x, const UInt<pow_size> & pow, UInt<value_size> & result) const
+	{
+	UInt<value_size> powers[1 << (TTMATH_MONTGOMERY_MAX_WINDOW-1)];
+	UInt<value_size> acc;
+	uint table_id, index, window, i, j, k, value;
+	bool first = true;
+
+		if( !pow.FindLeadingBit(table_id, index) )
+		{
+			// x^0 = 1 (or zero if the modulus is one)
+			FromMontgomery(one, result);
+			return 0;
+		}
+
+		i      = table_id * TTMATH_BITS_PER_UINT + index; // the highest bit
+		window = PowMod_Window(i + 1);
+
+		// powers[k] = x^(2k+1) (in the Montgomery form)
+		ToMontgomery(x, powers[0]);
+
+		if( window > 1 )
+		{
+			SqrMod(powers[0], acc);
+
+			for(k=1 ; k < (uint(1) << (window-1)) ; ++k)
+				MulMod(powers[k-1], acc, powers[k]);
+		}
+
+		while( true )
+		{
+			if( PowMod_GetBit(pow, i) == 0 )
+			{
+				SqrMod(acc, acc);
+			}
+			else
+			{
+				// the window [i..j] has at most 'window' bits and its lowest bit is one
+				j = (i + 1 > window) ? i + 1 - window : 0;
+
+				while( PowMod_GetBit(pow, j) == 0 )
+					++j;
+
+				for(value=0, k=i+1 ; k-- > j ; )
+					value = (value << 1) | PowMod_GetBit(pow, k);
+
+				if( first )
+				{
+					acc   = powers[value >> 1];
+					first = false;
+				}
+				else
+				{
+					for(k=j ; k<=i ; ++k)
+						SqrMod(acc, acc);
+
+					MulMod(acc, powers[value >> 1], acc);
+				}
+
+				i = j;
+			}
+
+			if( i == 0 )
+				break;
+
+			--i;
+		}
+
+		FromMontgomery(acc, result);
+
+		TTMATH_LOG("UIntMontgomery::PowMod_SlidingWindow")
+
+	return 0;
+	}
+
+#endif
+
+
+	/*!
+		x = x - modulus if c is one or if x is greater than or equal to modulus
+		(c is the carry from the highest word, x is smaller than 2*modulus)
+
+		in the constant-time mode the subtraction is always made
+		and the result is selected by a mask
+	*/
+	void SubModulus(UInt<value_size> & x, uint c) const
+	{
+	#ifdef TTMATH_CONSTANT_TIME
+
+		UInt<value_size> temp(x);
+		uint borrow = temp.Sub(modulus);
+
+		x.ConstantTime_Select(temp, x, UInt<value_size>::ConstantTime_Mask(c | (borrow ^ 1)));
+
+	#else
+
+		if( c || x >= modulus )
+			x.Sub(modulus);
+
+	#endif
+	}
+
+
+	/*!
+		the schoolbook multiplication: product = a * b
+		(only 'size' words of a and b are taken into account)
+
+		each row is calculated by MulAddVector() which has a fast path
+		in the assembler code
+	*/
+	void MulMod_Rows(const UInt<value_size> & a, const UInt<value_size> & b, UInt<value_size*2> & product) const
+	{
+	uint i;
+
+		for(i=0 ; i<size ; ++i)
+			product.table[i] = 0;
+
+		for(i=0 ; i<size ; ++i)
+			product.table[i+size] = UInt<value_size>::MulAddVector(a.table, b.table[i], size, product.table + i);
+
+		for(i=size*2 ; i<value_size*2 ; ++i)
+			product.table[i] = 0;
+	}
+
+
+	/*!
+		the schoolbook squaring: product = a * a
+
+		the products a[i]*a[j] (i<j) are calculated only once and doubled,
+		then the squares a[i]*a[i] are added
+	*/
+	void SqrMod_Rows(const UInt<value_size> & a, UInt<value_size*2> & product) const
+	{
+	uint i, c, c2, high, low;
+
+		for(i=0 ; i<value_size*2 ; ++i)
+			product.table[i] = 0;
+
+		for(i=0 ; i+1<size ; ++i)
+			product.table[i+size] = UInt<value_size>::MulAddVector(a.table + i + 1, a.table[i], size - i - 1, product.table + i*2 + 1);
+
+		product.Rcl(1);
+
+		for(i=0, c=0 ; i<size ; ++i)
+		{
+			UInt<value_size>::MulTwoWords(a.table[i], a.table[i], &high, &low);
+
+			low  += c;
+			high += UInt<value_size>::ConstantTime_Smaller(low, c); // high is at most 0xff...fe
+
+			product.table[i*2] += low;
+			c2 = UInt<value_size>::ConstantTime_Smaller(product.table[i*2], low);
+
+			high += c2; // no carry here because of the same reason
+			product.table[i*2+1] += high;
+			c = UInt<value_size>::ConstantTime_Smaller(product.table[i*2+1], high);
+		}
+	}
+
+
+	/*!
+		the modular exponentiation with a fixed window (used in the constant-time mode)
+
+		all bits of 'pow' are taken (also the leading zeros), for each window the same
+		number of squarings and one multiplication are made, and the power of x
+		is taken from the table by reading all its items (ConstantTime_Select())
+		so the time doesn't depend on the exponent
+
+		(the conversion of x into the Montgomery form uses the division
+		so it is not made in a constant time)
+	*/
+	template<uint pow_size>
+	uint PowMod_FixedWindow(const UInt<value_size> & x, const UInt<pow_size> & pow, UInt<value_size> & result) const
+	{
+	UInt<value_size> powers[1 << (TTMATH_MONTGOMERY_MAX_WINDOW-1)];
+	UInt<value_size> acc, temp;
+	uint bits, window, count, i, k, w, value;
+
+		bits   = pow_size * TTMATH_BITS_PER_UINT;
+		window = PowMod_Window(bits) - 1;
+
+		if( window == 0 )
+			window = 1;
+
+		// powers[k] = x^k (in the Montgomery form)
+		count     = uint(1) << window;
+		powers[0] = one;
+		ToMontgomery(x, powers[1]);
+
+		for(k=2 ; k<count ; ++k)
+			MulMod(powers[k-1], powers[1], powers[k]);
+
+		acc = one;
+
+		// the first window can be shorter (when 'bits' is not divisible by 'window')
+		for(i=bits ; i>0 ; i-=w)
+		{
+			w = i % window;
+
+			if( w == 0 )
+				w = window;
+
+			for(value=0, k=i ; k-- > i-w ; )
+				value = (value << 1) | PowMod_GetBit(pow, k);
+
+			for(k=0 ; k<w ; ++k)
+				SqrMod(acc, acc);
+
+			temp.SetZero();
+
+			for(k=0 ; k<count ; ++k)
+				temp.ConstantTime_Select(powers[k], temp,
+					UInt<value_size>::ConstantTime_Mask(UInt<value_size>::ConstantTime_IsZero(k ^ value)));
+
+			MulMod(acc, temp, acc);
+		}
+
+		FromMontgomery(acc, result);
+
+		TTMATH_LOG("UIntMontgomery::PowMod_FixedWindow")
+
+	return 0;
+	}
+
+
+	/*!
+		the size of the window for an exponent with 'bits' bits
+		(the table of powers has 2^(window-1) items)
+	*/
+	static uint PowMod_Window(uint bits)
+	{
+	uint window;
+
+		if( bits <= 8 )
+			window = 1;
+		else
+		if( bits <= 24 )
+			window = 2;
+		else
+		if( bits <= 80 )
+			window = 3;
+		else
+		if( bits <= 240 )
+			window = 4;
+		else
+		if( bits <= 672 )
+			window = 5;
+		else
+			window = 6;
+
+		if( window > TTMATH_MONTGOMERY_MAX_WINDOW )
+			window = TTMATH_MONTGOMERY_MAX_WINDOW;
+
+	return window;
+	}
+
+
+	template<uint pow_size>
+	static uint PowMod_GetBit(const UInt<pow_size> & pow, uint bit)
+	{
+		return (pow.table[bit / TTMATH_BITS_PER_UINT] >> (bit % TTMATH_BITS_PER_UINT)) & 1;
+	}
+
+};
+
+
+} // namespace
+
+#endif
@@ -708,8 +708,7 @@ void Sin(int sindex, int amount_of_args, ValueType & result)
 	if( amount_of_args != 1 )
 		Error( err_improper_amount_of_arguments );
 
-	ErrorCode err;
-	result = ttmath::Sin( ConvertAngleToRad(stack[sindex].value), &err );
+	ErrorCode err = ttmath::Sin(ConvertAngleToRad(stack[sindex].value), result);
 
 	if(err != err_ok)
 		Error( err );
@@ -720,8 +719,7 @@ void Cos(int sindex, int amount_of_args, ValueType & result)
 	if( amount_of_args != 1 )
 		Error( err_improper_amount_of_arguments );
 
-	ErrorCode err;
-	result = ttmath::Cos( ConvertAngleToRad(stack[sindex].value), &err );
+	ErrorCode err = ttmath::Cos(ConvertAngleToRad(stack[sindex].value), result);
 
 	if(err != err_ok)
 		Error( err );
@@ -732,8 +730,7 @@ void Tan(int sindex, int amount_of_args, ValueType & result)
 	if( amount_of_args != 1 )
 		Error( err_improper_amount_of_arguments );
 
-	ErrorCode err;
-	result = ttmath::Tan(ConvertAngleToRad(stack[sindex].value), &err);
+	ErrorCode err = ttmath::Tan(ConvertAngleToRad(stack[sindex].value), result);
 
 	if(err != err_ok)
 		Error( err );
@@ -744,8 +741,7 @@ void Cot(int sindex, int amount_of_args, ValueType & result)
 	if( amount_of_args != 1 )
 		Error( err_improper_amount_of_arguments );
 
-	ErrorCode err;
-	result = ttmath::Cot(ConvertAngleToRad(stack[sindex].value), &err);
+	ErrorCode err = ttmath::Cot(ConvertAngleToRad(stack[sindex].value), result);
 
 	if(err != err_ok)
 		Error( err );
@@ -777,8 +773,7 @@ void Ln(int sindex, int amount_of_args, ValueType & result)
 	if( amount_of_args != 1 )
 		Error( err_improper_amount_of_arguments );
 
-	ErrorCode err;
-	result = ttmath::Ln(stack[sindex].value, &err);
+	ErrorCode err = ttmath::Ln(stack[sindex].value, result);
 
 	if(err != err_ok)
 		Error( err );
@@ -789,8 +784,7 @@ void Log(int sindex, int amount_of_args, ValueType & result)
 	if( amount_of_args != 2 )
 		Error( err_improper_amount_of_arguments );
 
-	ErrorCode err;
-	result = ttmath::Log(stack[sindex].value, stack[sindex+2].value, &err);
+	ErrorCode err = ttmath::Log(stack[sindex].value, stack[sindex+2].value, result);
 
 	if(err != err_ok)
 		Error( err );
@@ -801,8 +795,7 @@ void Exp(int sindex, int amount_of_args, ValueType & result)
 	if( amount_of_args != 1 )
 		Error( err_improper_amount_of_arguments );
 
-	ErrorCode err;
-	result = ttmath::Exp(stack[sindex].value, &err);
+	ErrorCode err = ttmath::Exp(stack[sindex].value, result);
 
 	if(err != err_ok)
 		Error( err );
@@ -1128,8 +1121,7 @@ void Sqrt(int sindex, int amount_of_args, ValueType & result)
 	if( amount_of_args != 1 )
 		Error( err_improper_amount_of_arguments );
 
-	ErrorCode err;
-	result = ttmath::Sqrt(stack[sindex].value, &err);
+	ErrorCode err = ttmath::Sqrt(stack[sindex].value, result);
 
 	if( err != err_ok )
 		Error( err );
@@ -1141,8 +1133,7 @@ void Sinh(int sindex, int amount_of_args, ValueType & result)
 	if( amount_of_args != 1 )
 		Error( err_improper_amount_of_arguments );
 
-	ErrorCode err;
-	result = ttmath::Sinh(stack[sindex].value, &err);
+	ErrorCode err = ttmath::Sinh(stack[sindex].value, result);
 
 	if( err != err_ok )
 		Error( err );
@@ -1154,8 +1145,7 @@ void Cosh(int sindex, int amount_of_args, ValueType & result)
 	if( amount_of_args != 1 )
 		Error( err_improper_amount_of_arguments );
 
-	ErrorCode err;
-	result = ttmath::Cosh(stack[sindex].value, &err);
+	ErrorCode err = ttmath::Cosh(stack[sindex].value, result);
 
 	if( err != err_ok )
 		Error( err );
@@ -1167,8 +1157,7 @@ void Tanh(int sindex, int amount_of_args, ValueType & result)
 	if( amount_of_args != 1 )
 		Error( err_improper_amount_of_arguments );
 
-	ErrorCode err;
-	result = ttmath::Tanh(stack[sindex].value, &err);
+	ErrorCode err = ttmath::Tanh(stack[sindex].value, result);
 
 	if( err != err_ok )
 		Error( err );
@@ -1180,8 +1169,7 @@ void Coth(int sindex, int amount_of_args, ValueType & result)
 	if( amount_of_args != 1 )
 		Error( err_improper_amount_of_arguments );
 
-	ErrorCode err;
-	result = ttmath::Coth(stack[sindex].value, &err);
+	ErrorCode err = ttmath::Coth(stack[sindex].value, result);
 
 	if( err != err_ok )
 		Error( err );
@@ -0,0 +1,242 @@
+/*
+ * This file is a part of TTMath Bignum Library
+ * and is distributed under the (new) BSD licence.
+ * Author: Tomasz Sowa <t.sowa@slimaczek.pl>
+ */
+
+/*
+ * Copyright (c) 2006-2009, Tomasz Sowa
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *  * Redistributions of source code must retain the above copyright notice,
+ *    this list of conditions and the following disclaimer.
+ *
+ *  * Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ *  * Neither the name Tomasz Sowa nor the names of contributors to this
+ *    project may be used to endorse or promote products derived
+ *    from this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF
+ * THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+
+#ifndef headerfilettmaththreads
+#define headerfilettmaththreads
+
+/*!
+	\file ttmaththreads.h
+    \brief a lock for the static data used by the library (the cache of constants)
+
+	the lock is used only if TTMATH_MULTITHREADS is defined before including
+	the library, e.g.
+		#define TTMATH_MULTITHREADS
+		#include <ttmath/ttmath.h>
+	on Windows the Win32 API is used, on Unix systems the POSIX threads
+	(then you have to link with -lpthread)
+
+	without TTMATH_MULTITHREADS (or on other systems) ThreadLock::Lock() returns false
+	and the static data is not used at all: the constants which don't fit into the
+	built-in tables (Big::SetPi(), SetE(), SetLn2(), SetLn10() for mantissas greater than
+	TTMATH_BUILTIN_VARIABLES_SIZE, SetSqrt2() and others) are calculated each time,
+	so the library can be used from many threads but it's slower with big mantissas,
+	define TTMATH_MULTITHREADS to have them calculated only once
+*/
+
+#ifdef TTMATH_MULTITHREADS
+
+	#ifdef _WIN32
+		#define TTMATH_WIN32_THREADS
+		#include <windows.h>
+		#include <cstdio>
+	#elif defined(unix) || defined(__unix__) || defined(__unix) || (defined(__APPLE__) && defined(__MACH__))
+		#define TTMATH_POSIX_THREADS
+		#include <pthread.h>
+	#endif
+
+#endif
+
+
+
+namespace ttmath
+{
+
+
+#ifdef TTMATH_WIN32_THREADS
+
+/*!
+	an auxiliary function for ThreadMutex() (Win32)
+
+	we're using a named mutex (the name has the process id)
+	so there is nothing to initialize before main()
+*/
+inline HANDLE ThreadMutexCreate()
+{
+char buffer[50];
+
+	sprintf(buffer, "TTMATH_LOCK_%lu", (unsigned long)GetCurrentProcessId());
+
+return CreateMutexA(0, false, buffer);
+}
+
+
+/*!
+	the mutex for the whole library (Win32)
+
+	it's created only once (the first time the function is called) and it's
+	never closed, if two threads created it at the same time they would get
+	the same mutex anyway (it has a name)
+*/
+inline HANDLE ThreadMutex()
+{
+	static HANDLE mutex_handle = ThreadMutexCreate();
+
+return mutex_handle;
+}
+
+
+/*!
+	\brief a lock for the whole library (Win32)
+
+	usage:
+		{
+		ThreadLock lock;
+
+			if( lock.Lock() )
+			{
+				// ... the static data can be used here
+			}
+		} // the mutex is released in the destructor
+*/
+class ThreadLock
+{
+	bool locked;
+
+public:
+
+	ThreadLock()
+	{
+		locked = false;
+	}
+
+
+	~ThreadLock()
+	{
+		if( locked )
+			ReleaseMutex(ThreadMutex());
+	}
+
+
+	bool Lock()
+	{
+		HANDLE mutex_handle = ThreadMutex();
+
+		if( !mutex_handle )
+			return false;
+
+		DWORD result = WaitForSingleObject(mutex_handle, INFINITE);
+
+		// the mutex is released in the destructor only if it is owned
+		locked = (result == WAIT_OBJECT_0 || result == WAIT_ABANDONED);
+
+	return locked;
+	}
+};
+
+#endif
+
+
+
+#ifdef TTMATH_POSIX_THREADS
+
+/*!
+	the mutex for the whole library
+
+	it's initialized statically (PTHREAD_MUTEX_INITIALIZER) so it's ready
+	before any constructor is called, and there is only one such object
+	in the program (inline function)
+*/
+inline pthread_mutex_t * ThreadMutex()
+{
+	static pthread_mutex_t mutex = PTHREAD_MUTEX_INITIALIZER;
+
+return &mutex;
+}
+
+
+/*!
+	\brief a lock for the whole library (POSIX threads)
+
+	usage as for the Win32 version
+*/
+class ThreadLock
+{
+	bool locked;
+
+public:
+
+	ThreadLock()
+	{
+		locked = false;
+	}
+
+
+	~ThreadLock()
+	{
+		if( locked )
+			pthread_mutex_unlock(ThreadMutex());
+	}
+
+
+	bool Lock()
+	{
+		locked = (pthread_mutex_lock(ThreadMutex()) == 0);
+
+	return locked;
+	}
+};
+
+#endif
+
+
+
+#if !defined(TTMATH_WIN32_THREADS) && !defined(TTMATH_POSIX_THREADS)
+
+/*!
+	\brief a lock which cannot be locked (TTMATH_MULTITHREADS is not defined)
+
+	Lock() returns false so the static data is never used (it would not be
+	protected if the library were used from many threads)
+*/
+class ThreadLock
+{
+public:
+
+	bool Lock()
+	{
+		return false;
+	}
+};
+
+#endif
+
+
+} // namespace
+
+#endif
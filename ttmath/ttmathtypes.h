@@ -63,9 +63,9 @@
 	if zero that means this is the release version of the library
 */
 #define TTMATH_MAJOR_VER		0
-#define TTMATH_MINOR_VER		8
-#define TTMATH_REVISION_VER		6
-#define TTMATH_PRERELEASE_VER	0
+#define TTMATH_MINOR_VER		9
+#define TTMATH_REVISION_VER		0
+#define TTMATH_PRERELEASE_VER	1
 
 
 /*!
@@ -90,6 +90,26 @@
 #endif
 
 
+/*!
+	TTMATH_CONSTANT_TIME
+	if you define this macro (e.g. -DTTMATH_CONSTANT_TIME) then some methods
+	work in a time which doesn't depend on the values of their arguments
+	(only on value_size), this is useful for cryptographic code, these are:
+		UInt::Add(), UInt::Sub(), AddVector(), SubVector(), MulAddVector()
+		UInt::Mul2Big(), UInt::Mul() and MulBig() (the schoolbook algorithm is always used),
+		UInt::Sqr() and SqrBig()
+		UInt::Rcl(), UInt::Rcr() (the time depends only on the number of bits to move)
+		UInt::IsZero() and the comparison methods and operators
+		UInt::Add_Partial(), Sub_Partial() and Cmp_Partial() (they work on all words then)
+		UIntMontgomery::MulMod(), SqrMod(), AddMod(), Redc() and PowMod()
+		(a fixed window is used instead of the sliding one)
+
+	the division, AddInt(), SubInt(), conversions and the Big<> and Int<> classes
+	are not affected, MulTwoWords() and DivTwoWords() still use the processor's
+	instructions (mul/div) on the assembler backends
+*/
+
+
 
 namespace ttmath
 {
@@ -226,7 +246,7 @@ namespace ttmath
 	during some kind of calculating when we're making any long formulas
 	(for example Taylor series)
 
-	it's used in ExpSurrounding0(...), LnSurrounding1(...), Sin0pi05(...), etc.
+	it's used in ExpSurrounding0(...), LnSurrounding1(...), SinCos0pi025(...), etc.
 
 	note! there'll not be so many iterations, iterations are stopped when
 	there is no sense to continue calculating (for example when the result
@@ -236,19 +256,125 @@ namespace ttmath
 #define TTMATH_ARITHMETIC_MAX_LOOP 10000
 
 
+/*!
+	the maximum exponent of the argument of Sin(), Cos(), Tan() and Cot()
+	(the value is x = mantissa * 2^exponent)
+
+	the argument is reduced by the period on integers (Payne-Hanek) and we need
+	about exponent + 3*(mantissa bits) bits of 2/pi, for bigger arguments
+	err_overflow is returned
+*/
+#define TTMATH_REDUCTION_MAX_EXPONENT 100000
+
+
 
 /*!
 	this is a limit when calculating Karatsuba multiplication
 	if the size of a vector is smaller than TTMATH_USE_KARATSUBA_MULTIPLICATION_FROM_SIZE
 	the Karatsuba algorithm will use standard schoolbook multiplication
+	(the schoolbook multiplication is made by rows with UInt::MulAddVector()
+	which is quite fast so the limit is relatively big)
 */
 #ifdef __GNUC__
-#define TTMATH_USE_KARATSUBA_MULTIPLICATION_FROM_SIZE 3
+#define TTMATH_USE_KARATSUBA_MULTIPLICATION_FROM_SIZE 40
 #else
-#define TTMATH_USE_KARATSUBA_MULTIPLICATION_FROM_SIZE 5
+#define TTMATH_USE_KARATSUBA_MULTIPLICATION_FROM_SIZE 32
 #endif
 
 
+/*!
+	this is a limit when calculating Toom-3 multiplication
+	if the size of a vector is smaller than TTMATH_USE_TOOM3_MULTIPLICATION_FROM_SIZE
+	the Toom-3 algorithm will use Karatsuba multiplication
+	(this value must be greater than or equal to 5)
+*/
+#define TTMATH_USE_TOOM3_MULTIPLICATION_FROM_SIZE 80
+
+
+/*!
+	this is a limit when calculating Toom-4 multiplication
+	if the size of a vector is smaller than TTMATH_USE_TOOM4_MULTIPLICATION_FROM_SIZE
+	the Toom-4 algorithm will use Toom-3 multiplication
+	(this value must be greater than or equal to 10)
+*/
+#define TTMATH_USE_TOOM4_MULTIPLICATION_FROM_SIZE 300
+
+
+/*!
+	this is a limit when the multiplication by using the number-theoretic transform
+	is used in UInt::MulFastestBig(), if the size of a vector is smaller than
+	TTMATH_USE_NTT_MULTIPLICATION_FROM_SIZE the Toom-Cook multiplication is used
+*/
+#define TTMATH_USE_NTT_MULTIPLICATION_FROM_SIZE 3000
+
+
+/*!
+	this is a limit when the division by using the Newton's reciprocal (Div4)
+	is used in UInt::DivFastest(), both the divisor and the quotient should
+	have at least TTMATH_USE_NEWTON_DIVISION_FROM_SIZE words
+	(for smaller values the Knuth's algorithm D (Div3) is used)
+*/
+#define TTMATH_USE_NEWTON_DIVISION_FROM_SIZE 1500
+
+
+/*!
+	this is a limit when Big::Ln() uses the arithmetic-geometric mean (AGM)
+	instead of the series from LnSurrounding1(), the value is the size
+	of the mantissa (in words)
+*/
+#define TTMATH_USE_AGM_LOGARITHM_FROM_SIZE 10
+
+
+/*!
+	this is a limit when Big::Exp() uses the Newton's method (with the logarithm
+	calculated by AGM) instead of the series from ExpSurrounding0(),
+	the value is the size of the mantissa (in words)
+*/
+#define TTMATH_USE_NEWTON_EXP_FROM_SIZE 16
+
+
+/*!
+	the maximum index of Root() calculated by the Newton's method,
+	for a bigger index the method converges slowly (and the power y^(index-1)
+	is calculated in each step) so Root() uses Pow(1/index) - Ln() and Exp()
+*/
+#define TTMATH_ROOT_NEWTON_MAX_INDEX 32
+
+
+/*!
+	the limit of Big::FromString() with a rounding mode, when the number of significant
+	digits plus the magnitude of the exponent (in the base of the string) is not greater
+	than this value the string is converted exactly (on DynInt) and then correctly rounded,
+	for bigger strings the value is read with one word of the mantissa more and then
+	moved by one unit in the last place (in the direction of the rounding)
+*/
+#define TTMATH_FROMSTRING_EXACT_MAX_DIGITS 10000
+
+
+/*!
+	the maximum size of the window used in UIntMontgomery::PowMod()
+	(the sliding window exponentiation), the table of precalculated powers
+	has 2^(TTMATH_MONTGOMERY_MAX_WINDOW-1) values and it's allocated on the stack
+	(this value must be between 1 and 6)
+*/
+#define TTMATH_MONTGOMERY_MAX_WINDOW 5
+
+
+/*!
+	this is a limit when UIntMontgomery uses UInt::MulBig() and UInt::SqrBig()
+	(Karatsuba and others), for smaller moduli the schoolbook multiplication
+	by rows (UInt::MulAddVector()) is faster
+*/
+#define TTMATH_MONTGOMERY_MULBIG_FROM_SIZE 32
+
+
+/*!
+	how many words DynInt keeps inside the object (without allocating memory),
+	bigger values are allocated on the heap
+*/
+#define TTMATH_DYNINT_INLINE_SIZE 2
+
+
 namespace ttmath
 {
 
@@ -283,7 +409,31 @@ namespace ttmath
 		err_unknown_object,
 		err_still_calculating,
 		err_too_big_factorial,
-		err_in_short_form_used_function
+		err_in_short_form_used_function,
+		err_precision_not_reached
+	};
+
+
+	/*!
+		rounding modes used by Big (Add(), Sub(), Mul(), Div(), FromBig() and FromString())
+
+		round_truncate     - the bits which don't fit into the mantissa are simply cut off
+		                     (this is the default and it's the fastest mode, but in Sub()
+		                     the smaller value is cut before the subtraction so the result
+		                     can be one unit greater than with round_toward_zero)
+		round_toward_zero  - toward zero
+		round_nearest_even - to the nearest value, if both are equally near then
+		                     to the one with the lowest bit of the mantissa equal zero
+		round_up           - toward plus infinity
+		round_down         - toward minus infinity
+	*/
+	enum RoundingMode
+	{
+		round_truncate = 0,
+		round_toward_zero,
+		round_nearest_even,
+		round_up,
+		round_down
 	};
 
 
@@ -348,8 +498,8 @@ namespace ttmath
 		Some kind of methods use a reference as their argument to another object,
 		and the another object not always can be the same which is calling, e.g.
 			Big<1,2> foo(10);
-			foo.Mul(foo); // this is incorrect
-		above method Mul is making something more with 'this' object and 
+			foo.Div(foo); // this is incorrect
+		above method Div is making something more with 'this' object and 
 		'this' cannot be passed as the argument because the result will be undefined
 
 		macro TTMATH_REFERENCE_ASSERT helps us to solve the above problem
@@ -48,6 +48,7 @@
 
 #include <iostream>
 #include <iomanip>
+#include <vector>
 
 
 #include "ttmathtypes.h"
@@ -60,6 +61,10 @@
 namespace ttmath
 {
 
+template<uint value_size>
+class UIntDivisor;
+
+
 /*! 
 	\brief UInt implements a big integer value without a sign
 
@@ -71,6 +76,8 @@ namespace ttmath
 template<uint value_size>
 class UInt
 {
+	template<uint> friend class UIntDivisor;
+
 public:
 
 	/*!
@@ -387,7 +394,34 @@ private:
 
 		TTMATH_LOG("UInt::RclMoveAllWords")
 	}
-	
+
+
+	/*!
+		this method moves all bits into the left hand side
+		return value <- this <- c
+
+		the lowest *bits* will be held the 'c' and
+		the state of one additional bit (on the left hand side)
+		will be returned
+
+		for example:
+		let this is 001010000
+		after Rcl2(3, 1) there'll be 010000111 and Rcl2 returns 1
+	*/
+	uint Rcl2(uint bits, uint c)
+	{
+		TTMATH_ASSERT( bits>0 && bits<TTMATH_BITS_PER_UINT )
+
+		uint moved = ShiftLeftVector(table, value_size, bits, table);
+
+		if( c != 0 )
+			table[0] |= TTMATH_UINT_MAX_VALUE >> (TTMATH_BITS_PER_UINT - bits);
+
+		TTMATH_LOG("UInt::Rcl2")
+
+	return moved & 1;
+	}
+
 public:
 
 	/*!
@@ -483,6 +517,33 @@ private:
 		TTMATH_LOG("UInt::RcrMoveAllWords")
 	}
 
+
+	/*!
+		this method moves all bits into the right hand side
+		C -> this -> return value
+
+		the highest *bits* will be held the 'c' and
+		the state of one additional bit (on the right hand side)
+		will be returned
+
+		for example:
+		let this is 000000010
+		after Rcr2(2, 1) there'll be 110000000 and Rcr2 returns 1
+	*/
+	uint Rcr2(uint bits, uint c)
+	{
+		TTMATH_ASSERT( bits>0 && bits<TTMATH_BITS_PER_UINT )
+
+		uint moved = ShiftRightVector(table, value_size, bits, table);
+
+		if( c != 0 )
+			table[value_size-1] |= TTMATH_UINT_MAX_VALUE << (TTMATH_BITS_PER_UINT - bits);
+
+		TTMATH_LOG("UInt::Rcr2")
+
+	return (moved & TTMATH_UINT_HIGHEST_BIT) ? 1 : 0;
+	}
+
 public:
 
 	/*!
@@ -745,50 +806,409 @@ public:
 
 	/*!
 	 *
-	 * Multiplication
+	 * Vectors
 	 *
 	 *
 	*/
 
-public:
+	/*
+		the following static methods work on vectors of words (the lowest word first)
+		and not on 'table' so they can be used with your own buffers too
+		(e.g. an array of words from a file) without copying them into UInt objects
+
+		the basic ones are defined in ttmathuint_x86.h, ttmathuint_x86_64.h
+		and ttmathuint_noasm.h (look at the end of this class):
+			AddVector()        - result = ss1 + ss2
+			SubVector()        - result = ss1 - ss2
+			MulVector()        - result = ss1 * word
+			MulAddVector()     - result = result + ss1 * word
+			MulSubVector()     - result = result - ss1 * word
+			ShiftLeftVector()  - result = ss1 << bits
+			ShiftRightVector() - result = ss1 >> bits
+
+		and the methods below are built on them
+	*/
+
 
 	/*!
-		multiplication: this = this * ss2
+		this static method compares two vectors with the same size
 
-		it returns a carry if it has been
+		it returns -1 if ss1 is smaller than ss2, 0 if they are equal
+		and 1 if ss1 is bigger than ss2
 	*/
-	uint MulInt(uint ss2)
+	static sint CmpVector(const uint * ss1, const uint * ss2, uint size)
 	{
-	uint r2,r1;
+		for(uint i=size ; i-- > 0 ; )
+		{
+			if( ss1[i] != ss2[i] )
+				return (ss1[i] < ss2[i]) ? -1 : 1;
+		}
 
-		UInt<value_size> u( *this );
-		SetZero();
+	return 0;
+	}
+
+
+	/*!
+		this static method divides the vector ss1 by one word
+		(result = ss1 / divisor)
 
-		for(uint x1=0 ; x1<value_size ; ++x1)
+		ss1 and result have 'size' words (result can point to ss1),
+		the divisor must be different from zero,
+		the method returns the remainder
+	*/
+	static uint DivIntVector(const uint * ss1, uint size, uint divisor, uint * result)
+	{
+	uint r = 0;
+
+		TTMATH_ASSERT( divisor != 0 )
+
+		for(uint i=size ; i-- > 0 ; )
+			DivTwoWords(r, ss1[i], divisor, &result[i], &r);
+
+	return r;
+	}
+
+
+	/*!
+		this static method multiplies two vectors (the schoolbook multiplication by rows)
+		(result = ss1 * ss2)
+
+		result has ss1_size+ss2_size words and it cannot point to ss1 or ss2
+	*/
+	static void MulBigVector(const uint * ss1, uint ss1_size, const uint * ss2, uint ss2_size, uint * result)
+	{
+		if( ss1_size==0 || ss2_size==0 )
 		{
-			MulTwoWords(u.table[x1], ss2, &r2, &r1 );
-			
-			if( value_size>1 && x1<=value_size-2  )
+			for(uint i=0 ; i<ss1_size+ss2_size ; ++i)
+				result[i] = 0;
+
+		return;
+		}
+
+		result[ss1_size] = MulVector(ss1, ss2[0], ss1_size, result);
+
+		for(uint x2=1 ; x2<ss2_size ; ++x2)
+			result[x2+ss1_size] = MulAddVector(ss1, ss2[x2], ss1_size, result+x2);
+	}
+
+
+	/*!
+		this static method calculates the square of a vector (the schoolbook squaring)
+		(result = ss * ss)
+
+		result has size*2 words and it cannot point to ss
+
+		x^2 = sum(x[i]*x[i]*B^(2i)) + 2*sum(x[i]*x[j]*B^(i+j)) where i<j
+		so firstly we're calculating the products x[i]*x[j] (i<j), then
+		we're multiplying them by two (one bit shift) and at the end
+		the squares of words are added
+	*/
+	static void SqrBigVector(const uint * ss, uint size, uint * result)
+	{
+	uint r2, r1, c, x1;
+
+		for(x1=0 ; x1<size*2 ; ++x1)
+			result[x1] = 0;
+
+		if( size == 0 )
+			return;
+
+		// the products x[x1]*x[x2] (x1<x2) by rows
+		for(x1=0 ; x1+1<size ; ++x1)
+			result[x1+size] = MulAddVector(ss+x1+1, ss[x1], size-x1-1, result+x1*2+1);
+
+		// the highest bit is zero (the sum is smaller than B^(2*size-1))
+		ShiftLeftVector(result, size*2, 1, result);
+
+		for(x1=0, c=0 ; x1<size ; ++x1)
+		{
+			MulTwoWords(ss[x1], ss[x1], &r2, &r1);
+
+			// r2 is at most 0xff...fe so adding the carries can't overflow
+			r1 += c;
+			r2 += ConstantTime_Smaller(r1, c);
+
+			result[x1*2] += r1;
+			r2 += ConstantTime_Smaller(result[x1*2], r1);
+
+			result[x1*2+1] += r2;
+			c = ConstantTime_Smaller(result[x1*2+1], r2);
+		}
+	}
+
+
+
+	/*!
+	 *
+	 * Partial methods
+	 *
+	 *
+	*/
+
+	/*
+		the following methods work only on the lowest 'size' words
+		(the rest of the words must be zero) so they are faster when
+		the values are much smaller than value_size (e.g. UInt<64> with two
+		or three words used), UsedSize() returns how many words are used
+	*/
+
+
+	/*!
+		this method returns how many words are used
+		(the index of the highest non zero word plus one, or zero if the value is zero)
+	*/
+	uint UsedSize() const
+	{
+	uint size;
+
+		for(size=value_size ; size>0 && table[size-1]==0 ; --size);
+
+	return size;
+	}
+
+
+	/*!
+		addition: this = this + ss2 + c
+
+		only the lowest 'size' words of ss2 are taken (the rest of them must be zero),
+		the carry is propagated only as far as it's needed,
+		it returns the carry as Add() does
+	*/
+	uint Add_Partial(const UInt<value_size> & ss2, uint size, uint c = 0)
+	{
+		TTMATH_ASSERT( size <= value_size )
+
+	#ifdef TTMATH_CONSTANT_TIME
+		// AddInt() has a branch depending on the carry
+		return Add(ss2, c);
+	#else
+
+		if( c )
+			c = AddInt(1, 0);
+
+		if( size > 0 && AddVector(table, ss2.table, size, size, table) )
+			// if c was set then 'this' is zero now and there is no carry here
+			c = (size < value_size) ? AddInt(1, size) : 1;
+
+		TTMATH_LOG("UInt::Add_Partial")
+
+	return c;
+
+	#endif
+	}
+
+
+	/*!
+		subtraction: this = this - ss2 - c
+
+		only the lowest 'size' words of ss2 are taken (the rest of them must be zero),
+		the borrow is propagated only as far as it's needed,
+		it returns the carry as Sub() does
+	*/
+	uint Sub_Partial(const UInt<value_size> & ss2, uint size, uint c = 0)
+	{
+		TTMATH_ASSERT( size <= value_size )
+
+	#ifdef TTMATH_CONSTANT_TIME
+		// SubInt() has a branch depending on the carry
+		return Sub(ss2, c);
+	#else
+
+		if( c )
+			c = SubInt(1, 0);
+
+		if( size > 0 && SubVector(table, ss2.table, size, size, table) )
+			// if c was set then 'this' is 0xff...ff now and there is no carry here
+			c = (size < value_size) ? SubInt(1, size) : 1;
+
+		TTMATH_LOG("UInt::Sub_Partial")
+
+	return c;
+
+	#endif
+	}
+
+
+	/*!
+		moving all bits into the left side 'bits' times (this = this << bits)
+
+		'this' has only the lowest 'size' words used (the rest of them must be zero),
+		it returns the last moved bit as Rcl(bits) does
+	*/
+	uint Rcl_Partial(uint bits, uint size)
+	{
+		TTMATH_ASSERT( size <= value_size )
+
+		uint words = bits / TTMATH_BITS_PER_UINT;
+		uint rest  = bits % TTMATH_BITS_PER_UINT;
+
+		if( size == 0 )
+			return 0;
+
+		if( size + words + ((rest != 0) ? 1 : 0) > value_size )
+			// some bits go out of the table
+			return Rcl(bits);
+
+		if( words > 0 )
+		{
+			for(uint i=size ; i-- > 0 ; )
+				table[i + words] = table[i];
+
+			for(uint i=0 ; i<words ; ++i)
+				table[i] = 0;
+		}
+
+		if( rest > 0 )
+			// the word above the used ones is zero (size + words is smaller than value_size here)
+			// so it gets the bits moved out from the highest used word
+			ShiftLeftVector(table + words, size + 1, rest, table + words);
+
+		TTMATH_LOG("UInt::Rcl_Partial")
+
+	return 0;
+	}
+
+
+	/*!
+		moving all bits into the right side 'bits' times (this = this >> bits)
+
+		'this' has only the lowest 'size' words used (the rest of them must be zero),
+		it returns the last moved bit as Rcr(bits) does
+	*/
+	uint Rcr_Partial(uint bits, uint size)
+	{
+		TTMATH_ASSERT( size <= value_size )
+
+		uint words = bits / TTMATH_BITS_PER_UINT;
+		uint rest  = bits % TTMATH_BITS_PER_UINT;
+		uint last_c = 0;
+
+		if( bits == 0 )
+			return 0;
+
+		if( bits - 1 < size * TTMATH_BITS_PER_UINT )
+			last_c = GetBit(bits - 1);
+
+		if( words >= size )
+		{
+			for(uint i=0 ; i<size ; ++i)
+				table[i] = 0;
+		}
+		else
+		{
+			if( rest > 0 )
 			{
-				if( AddTwoInts(r2,r1,x1) )
-					return 1;
+				ShiftRightVector(table + words, size - words, rest, table);
 			}
 			else
 			{
-				// last iteration:
-				// x1 = value_size - 1;
-
-				if( r2 )
-					return 1;
-
-				if( AddInt(r1, x1) )
-					return 1;
+				for(uint i=0 ; i<size-words ; ++i)
+					table[i] = table[i + words];
 			}
+
+			for(uint i=size-words ; i<size ; ++i)
+				table[i] = 0;
 		}
 
+		TTMATH_LOG("UInt::Rcr_Partial")
+
+	return last_c;
+	}
+
+
+	/*!
+		this method performs a bitwise operation AND on the lowest 'size' words
+		(the rest of the words of ss2 must be zero or 'this' must be zero there)
+	*/
+	void BitAnd_Partial(const UInt<value_size> & ss2, uint size)
+	{
+		TTMATH_ASSERT( size <= value_size )
+
+		for(uint x=0 ; x<size ; ++x)
+			table[x] &= ss2.table[x];
+
+		TTMATH_LOG("UInt::BitAnd_Partial")
+	}
+
+
+	/*!
+		this method performs a bitwise operation OR on the lowest 'size' words
+		(the rest of the words of ss2 must be zero)
+	*/
+	void BitOr_Partial(const UInt<value_size> & ss2, uint size)
+	{
+		TTMATH_ASSERT( size <= value_size )
+
+		for(uint x=0 ; x<size ; ++x)
+			table[x] |= ss2.table[x];
+
+		TTMATH_LOG("UInt::BitOr_Partial")
+	}
+
+
+	/*!
+		this method performs a bitwise operation XOR on the lowest 'size' words
+		(the rest of the words of ss2 must be zero)
+	*/
+	void BitXor_Partial(const UInt<value_size> & ss2, uint size)
+	{
+		TTMATH_ASSERT( size <= value_size )
+
+		for(uint x=0 ; x<size ; ++x)
+			table[x] ^= ss2.table[x];
+
+		TTMATH_LOG("UInt::BitXor_Partial")
+	}
+
+
+	/*!
+		this method compares the lowest 'size' words of both values
+		(the rest of the words must be zero in both of them)
+
+		it returns -1 if 'this' is smaller than ss2, 0 if they are equal
+		and 1 if 'this' is bigger
+	*/
+	sint Cmp_Partial(const UInt<value_size> & ss2, uint size) const
+	{
+		TTMATH_ASSERT( size <= value_size )
+
+	#ifdef TTMATH_CONSTANT_TIME
+
+		uint smaller, bigger;
+		ConstantTime_Cmp(ss2, -1, smaller, bigger);
+
+		return sint(bigger) - sint(smaller);
+
+	#else
+
+		return CmpVector(table, ss2.table, size);
+
+	#endif
+	}
+
+
+
+	/*!
+	 *
+	 * Multiplication
+	 *
+	 *
+	*/
+
+public:
+
+	/*!
+		multiplication: this = this * ss2
+
+		it returns a carry if it has been
+	*/
+	uint MulInt(uint ss2)
+	{
+		uint c = MulVector(table, ss2, value_size, table);
+
 		TTMATH_LOG("UInt::MulInt(uint)")
 
-	return 0;
+	return (c != 0) ? 1 : 0;
 	}
 
 	/*!
@@ -800,7 +1220,6 @@ public:
 	template<uint result_size>
 	uint MulInt(uint ss2, UInt<result_size> & result)
 	{
-	uint r2,r1;
 	uint x1size=value_size;
 	uint x1start=0;
 
@@ -825,12 +1244,8 @@ public:
 			for(x1start=0 ; x1start<x1size && table[x1start]==0 ; ++x1start);
 		}
 
-		for(uint x1=x1start ; x1<x1size ; ++x1)
-		{
-			MulTwoWords(table[x1], ss2, &r2, &r1 );
-			result.AddTwoInts(r2,r1,x1);
-		}
-
+		// x1size is smaller than result_size
+		result.table[x1size] = MulVector(table+x1start, ss2, x1size-x1start, result.table+x1start);
 
 		TTMATH_LOG("UInt::MulInt(uint, UInt<>)")
 
@@ -857,6 +1272,15 @@ public:
 		case 3:
 			return Mul3(ss2);
 
+		case 4:
+			return Mul4(ss2);
+
+		case 5:
+			return Mul5(ss2);
+
+		case 6:
+			return Mul6(ss2);
+
 		case 100:
 		default:
 			return MulFastest(ss2);
@@ -887,6 +1311,15 @@ public:
 		case 3:
 			return Mul3Big(ss2, result);
 
+		case 4:
+			return Mul4Big(ss2, result);
+
+		case 5:
+			return Mul5Big(ss2, result);
+
+		case 6:
+			return Mul6Big(ss2, result);
+
 		case 100:
 		default:
 			return MulFastestBig(ss2, result);
@@ -894,13 +1327,69 @@ public:
 	}
 
 
-
 	/*!
-		the first version of the multiplication algorithm
+		multiplication and addition: this = this + ss1 * ss2
+
+		the product is calculated in a twice bigger table (MulBig) and
+		only then added so there is only one carry test at the end,
+		it returns a carry if the result is too big (then only the lowest
+		value_size words of the result are stored)
 	*/
+	uint MulAdd(const UInt<value_size> & ss1, const UInt<value_size> & ss2, uint algorithm = 100)
+	{
+	UInt<value_size*2> product;
+	UInt<value_size> temp(ss1);
 
-	/*!
-		multiplication: this = this * ss2
+		if( &ss1 == &ss2 )
+			temp.SqrBig(product, algorithm);
+		else
+			temp.MulBig(ss2, product, algorithm);
+
+		uint c = AddVector(table, product.table, value_size, value_size, table);
+
+		for(uint i=value_size ; i<value_size*2 ; ++i)
+			c |= (product.table[i] != 0) ? 1 : 0;
+
+		TTMATH_LOG("UInt::MulAdd")
+
+	return c;
+	}
+
+
+	/*!
+		multiplication and subtraction: this = this - ss1 * ss2
+
+		it returns a carry if the product is greater than 'this'
+		(then only the lowest value_size words of the result are stored)
+	*/
+	uint MulSub(const UInt<value_size> & ss1, const UInt<value_size> & ss2, uint algorithm = 100)
+	{
+	UInt<value_size*2> product;
+	UInt<value_size> temp(ss1);
+
+		if( &ss1 == &ss2 )
+			temp.SqrBig(product, algorithm);
+		else
+			temp.MulBig(ss2, product, algorithm);
+
+		uint c = SubVector(table, product.table, value_size, value_size, table);
+
+		for(uint i=value_size ; i<value_size*2 ; ++i)
+			c |= (product.table[i] != 0) ? 1 : 0;
+
+		TTMATH_LOG("UInt::MulSub")
+
+	return c;
+	}
+
+
+
+	/*!
+		the first version of the multiplication algorithm
+	*/
+
+	/*!
+		multiplication: this = this * ss2
 
 		it returns carry if it has been
 	*/
@@ -989,13 +1478,11 @@ public:
 		for(i=0 ; i<value_size ; ++i)
 			table[i] = result.table[i];
 
-		// testing carry
+		// testing carry (all words are tested, there is no early exit)
 		for( ; i<value_size*2 ; ++i)
-			if( result.table[i] != 0 )
-			{
-				c = 1;
-				break;
-			}
+			c |= result.table[i];
+
+		c = (c != 0) ? 1 : 0;
 
 		TTMATH_LOG("UInt::Mul2")
 
@@ -1032,6 +1519,8 @@ private:
 	uint x1size  = ss_size, x2size  = ss_size;
 	uint x1start = 0,       x2start = 0;
 
+	#ifndef TTMATH_CONSTANT_TIME
+
 		if( ss_size > 2 )
 		{	
 			// if the ss_size is smaller than or equal to 2
@@ -1044,6 +1533,8 @@ private:
 			for(x2start=0 ; x2start<x2size && ss2[x2start]==0 ; ++x2start);
 		}
 
+	#endif
+
 		Mul2Big3<ss_size>(ss1, ss2, result, x1start, x1size, x2start, x2size);
 	}
 
@@ -1051,26 +1542,30 @@ private:
 
 	/*!
 		an auxiliary method for calculating the multiplication 
+
+		the product is calculated by rows (MulBigVector()): ss1 * ss2[x2] is added
+		by MulAddVector() and its highest word is the next word of the result (there is
+		no carry propagation so the time doesn't depend on the values)
 	*/
 	template<uint ss_size>
 	void Mul2Big3(const uint * ss1, const uint * ss2, UInt<ss_size*2> & result, uint x1start, uint x1size, uint x2start, uint x2size)
 	{
-	uint r2, r1;
-
-		result.SetZero();
+	uint i;
 
 		if( x1size==0 || x2size==0 )
-			return;
-
-		for(uint x1=x1start ; x1<x1size ; ++x1)
 		{
-			for(uint x2=x2start ; x2<x2size ; ++x2)
-			{
-				MulTwoWords(ss1[x1], ss2[x2], &r2, &r1);
-				result.AddTwoInts(r2, r1, x2+x1);
-				// here will never be a carry
-			}
+			result.SetZero();
+			return;
 		}
+
+		// the words below x1start+x2start and above x1size+x2size-1 are zero
+		for(i=0 ; i<x1start+x2start ; ++i)
+			result.table[i] = 0;
+
+		for(i=x1size+x2size ; i<ss_size*2 ; ++i)
+			result.table[i] = 0;
+
+		MulBigVector(ss1+x1start, x1size-x1start, ss2+x2start, x2size-x2start, result.table+x1start+x2start);
 	}
 
 
@@ -1322,15 +1817,41 @@ public:
 
 
 	/*!
-		multiplication this = this * ss2
+		multiplication: this = this * ss2
+
+		This is Toom-Cook 3-way multiplication (Toom-3), we're using it when value_size is greater than
+		or equal to TTMATH_USE_TOOM3_MULTIPLICATION_FROM_SIZE macro (defined in ttmathtypes.h).
+		If value_size is smaller then we're using the Karatsuba multiplication instead.
+
+		Toom-3 multiplication:
+		Assume we have:
+			this = x = x2*B^(2m) + x1*B^m + x0
+			ss2  = y = y2*B^(2m) + y1*B^m + y0
+		we can treat x and y as two polynomials of the second degree:
+			p(t) = x2*t^2 + x1*t + x0
+			q(t) = y2*t^2 + y1*t + y0
+		their product r(t) = p(t)*q(t) = r4*t^4 + r3*t^3 + r2*t^2 + r1*t + r0
+		is a polynomial of the fourth degree and x*y = r(B^m)
+
+		The five coefficients r0..r4 can be calculated from the values of r(t) in five points,
+		we're using: 0, 1, -1, -2 and the infinity
+			r(0)   = p(0)*q(0)     = x0*y0
+			r(1)   = p(1)*q(1)     = (x2 + x1 + x0)*(y2 + y1 + y0)
+			r(-1)  = p(-1)*q(-1)   = (x2 - x1 + x0)*(y2 - y1 + y0)
+			r(-2)  = p(-2)*q(-2)   = (4*x2 - 2*x1 + x0)*(4*y2 - 2*y1 + y0)
+			r(inf) = x2*y2
+		so we need only five multiplications of numbers which are about three times
+		smaller (the schoolbook algorithm needs nine such multiplications)
+
+		Toom-3 multiplication has O( n^(ln(5)/ln(3)) ) that is about O(n^1.465)
 	*/
-	uint MulFastest(const UInt<value_size> & ss2)
+	uint Mul4(const UInt<value_size> & ss2)
 	{
 	UInt<value_size*2> result;
 	uint i, c = 0;
 
-		MulFastestBig(ss2, result);
-	
+		Mul4Big(ss2, result);
+
 		// copying result
 		for(i=0 ; i<value_size ; ++i)
 			table[i] = result.table[i];
@@ -1343,233 +1864,1854 @@ public:
 				break;
 			}
 
-		TTMATH_LOG("UInt::MulFastest")
+		TTMATH_LOG("UInt::Mul4")
 
 	return c;
 	}
 
 
+
 	/*!
-		multiplication result = this * ss2
+		multiplication: result = this * ss2
 
-		this method is trying to select the fastest algorithm
-		(in the future this method can be improved)
+		result is twice bigger than this and ss2,
+		this method never returns carry,
+		(Toom-3 multiplication)
 	*/
-	void MulFastestBig(const UInt<value_size> & ss2, UInt<value_size*2> & result)
+	void Mul4Big(const UInt<value_size> & ss2, UInt<value_size*2> & result)
 	{
-		if( value_size < TTMATH_USE_KARATSUBA_MULTIPLICATION_FROM_SIZE )
-			return Mul2Big(ss2, result);
+		Mul4Big2<value_size>(table, ss2.table, result.table);
 
-		uint x1size  = value_size, x2size  = value_size;
-		uint x1start = 0,          x2start = 0;
+		TTMATH_LOG("UInt::Mul4Big")
+	}
 
-		for(x1size=value_size ; x1size>0 && table[x1size-1]==0 ; --x1size);
-		for(x2size=value_size ; x2size>0 && ss2.table[x2size-1]==0 ; --x2size);
 
-		if( x1size==0 || x2size==0 )
-		{
-			// either 'this' or 'ss2' is equal zero - the result is zero too
-			result.SetZero();
-			return;
-		}
 
-		for(x1start=0 ; x1start<x1size && table[x1start]==0 ; ++x1start);
-		for(x2start=0 ; x2start<x2size && ss2.table[x2start]==0 ; ++x2start);
+	/*!
+		multiplication: this = this * ss2
 
-		uint distancex1 = x1size - x1start;
-		uint distancex2 = x2size - x2start;
+		This is Toom-Cook 4-way multiplication (Toom-4), we're using it when value_size is greater than
+		or equal to TTMATH_USE_TOOM4_MULTIPLICATION_FROM_SIZE macro (defined in ttmathtypes.h).
+		If value_size is smaller then we're using the Toom-3 multiplication instead.
 
-		if( distancex1 < 3 || distancex2 < 3 )
-			// either 'this' or 'ss2' have only 2 (or 1) item different from zero (side by side)
-			// (this condition in the future can be improved)
-			return Mul2Big3<value_size>(table, ss2.table, result, x1start, x1size, x2start, x2size);
+		It's the same idea as in Toom-3 but x and y are divided into four parts:
+			this = x = x3*B^(3m) + x2*B^(2m) + x1*B^m + x0
+			ss2  = y = y3*B^(3m) + y2*B^(2m) + y1*B^m + y0
+		the product r(t) = p(t)*q(t) is a polynomial of the sixth degree and its seven
+		coefficients are calculated from the values in points: 0, 1, -1, 2, -2, 1/2 and the infinity
+		(the value in 1/2 is multiplied by 2^6 so we're working only with integers)
+
+		Toom-4 multiplication has O( n^(ln(7)/ln(4)) ) that is about O(n^1.404)
+	*/
+	uint Mul5(const UInt<value_size> & ss2)
+	{
+	UInt<value_size*2> result;
+	uint i, c = 0;
 
+		Mul5Big(ss2, result);
 
-		// Karatsuba multiplication
-		Mul3Big(ss2, result);
+		// copying result
+		for(i=0 ; i<value_size ; ++i)
+			table[i] = result.table[i];
 
-		TTMATH_LOG("UInt::MulFastestBig")
-	}
+		// testing carry
+		for( ; i<value_size*2 ; ++i)
+			if( result.table[i] != 0 )
+			{
+				c = 1;
+				break;
+			}
 
+		TTMATH_LOG("UInt::Mul5")
+
+	return c;
+	}
 
-	/*!
-	 *
-	 * Division
-	 *
-	 *
-	*/
-	
-public:
 
 
 	/*!
-		division by one unsigned word
+		multiplication: result = this * ss2
 
-		returns 1 when divisor is zero
+		result is twice bigger than this and ss2,
+		this method never returns carry,
+		(Toom-4 multiplication)
 	*/
-	uint DivInt(uint divisor, uint * remainder = 0)
+	void Mul5Big(const UInt<value_size> & ss2, UInt<value_size*2> & result)
 	{
-		if( divisor == 0 )
-		{
-			if( remainder )
-				*remainder = 0; // this is for convenience, without it the compiler can report that 'remainder' is uninitialized
-
-			TTMATH_LOG("UInt::DivInt")
-
-		return 1;
-		}
-
-		if( divisor == 1 )
-		{
-			if( remainder )
-				*remainder = 0;
+		Mul5Big2<value_size>(table, ss2.table, result.table);
 
-			TTMATH_LOG("UInt::DivInt")
-
-		return 0;
-		}
-
-		UInt<value_size> dividend(*this);
-		SetZero();
-		
-		sint i;  // i must be with a sign
-		uint r = 0;
+		TTMATH_LOG("UInt::Mul5Big")
+	}
 
-		// we're looking for the last word in ss1
-		for(i=value_size-1 ; i>0 && dividend.table[i]==0 ; --i);
 
-		for( ; i>=0 ; --i)
-			DivTwoWords(r, dividend.table[i], divisor, &table[i], &r);
 
-		if( remainder )
-			*remainder = r;
+private:
 
-		TTMATH_LOG("UInt::DivInt")
 
-	return 0;
-	}
+	/*!
+		an auxiliary method for the Toom-Cook multiplication
 
-	uint DivInt(uint divisor, uint & remainder)
+		it changes the sign of 'v' (v is treated as a number in two's complement form)
+	*/
+	template<uint size>
+	static void MulToom_ChangeSign(UInt<size> & v)
 	{
-		return DivInt(divisor, &remainder);
+		v.BitNot();
+		v.AddOne();
 	}
 
 
-
 	/*!
-		division this = this / ss2
-		
-		return values:
-			 0 - ok
-			 1 - division by zero
-			'this' will be the quotient
-			'remainder' - remainder
+		an auxiliary method for the Toom-Cook multiplication
+
+		it divides 'v' (in two's complement form) by a small divisor,
+		'v' must be divisible by the divisor (there cannot be any remainder)
 	*/
-	uint Div(	const UInt<value_size> & divisor,
-				UInt<value_size> * remainder = 0,
-				uint algorithm = 3)
+	template<uint size>
+	static void MulToom_DivInt(UInt<size> & v, uint divisor)
 	{
-		switch( algorithm )
-		{
-		case 1:
-			return Div1(divisor, remainder);
+	uint r;
+	bool sign = v.IsTheHighestBitSet();
 
-		case 2:
-			return Div2(divisor, remainder);
+		if( sign )
+			MulToom_ChangeSign(v);
 
-		case 3:
-		default:
-			return Div3(divisor, remainder);
-		}
+		v.DivInt(divisor, &r);
+		TTMATH_ASSERT( r == 0 )
+
+		if( sign )
+			MulToom_ChangeSign(v);
 	}
 
-	uint Div(const UInt<value_size> & divisor, UInt<value_size> & remainder, uint algorithm = 3)
+
+	/*!
+		an auxiliary method for the Toom-Cook multiplication
+
+		it divides 'v' (in two's complement form) by 2^bits,
+		'v' must be divisible by 2^bits
+	*/
+	template<uint size>
+	static void MulToom_Rcr(UInt<size> & v, uint bits)
 	{
-		return Div(divisor, &remainder, algorithm);
+		v.Rcr(bits, v.IsTheHighestBitSet() ? 1 : 0);
 	}
 
 
+	/*!
+		an auxiliary method for the Toom-3 multiplication
 
-private:
+		it calculates the values of p(t) = x2*t^2 + x1*t + x0 in points 1, -1 and -2
+		(x0 and x1 have first_size words, x2 has second_size words)
 
-	/*!
-		return values:
-		0 - none has to be done
-		1 - division by zero
-		2 - division should be made
+		the values in the negative points are returned as the absolute values
+		and their signs (pm1_sign and pm2_sign)
 	*/
-	uint Div_StandardTest(	const UInt<value_size> & v,
-							uint & m, uint & n,
-							UInt<value_size> * remainder = 0)
+	template<uint first_size, uint second_size>
+	static void Mul4_Evaluate(const uint * x, UInt<first_size+1> & p1, UInt<first_size+1> & pm1,
+							  UInt<first_size+1> & pm2, bool & pm1_sign, bool & pm2_sign)
 	{
-		switch( Div_CalculatingSize(v, m, n) )
-		{
-		case 4: // 'this' is equal v
-			if( remainder )
-				remainder->SetZero();
+	const uint * x0 = x;
+	const uint * x1 = x + first_size;
+	const uint * x2 = x + first_size*2;
+	UInt<first_size+1> temp;
+	uint i, c;
 
-			SetOne();
-			TTMATH_LOG("UInt::Div_StandardTest")
-			return 0;
+		// temp = x0 + x2
+		temp.table[first_size] = AddVector(x0, x2, first_size, second_size, temp.table);
 
-		case 3: // 'this' is smaller than v
-			if( remainder )
-				*remainder = *this;
+		// p(1) = x0 + x2 + x1
+		c = AddVector(temp.table, x1, first_size+1, first_size, p1.table);
+		TTMATH_ASSERT( c==0 )
 
-			SetZero();
-			TTMATH_LOG("UInt::Div_StandardTest")
-			return 0;
+		// p(-1) = x0 + x2 - x1
+		pm1_sign = SubVector(temp.table, x1, first_size+1, first_size, pm1.table) != 0;
 
-		case 2: // 'this' is zero
-			if( remainder )
-				remainder->SetZero();
+		if( pm1_sign )
+			MulToom_ChangeSign(pm1);
 
-			SetZero();
-			TTMATH_LOG("UInt::Div_StandardTest")
-			return 0;
+		// temp = x0 + 4*x2
+		for(i=0 ; i<second_size ; ++i)
+			temp.table[i] = x2[i];
 
-		case 1: // v is zero
-			TTMATH_LOG("UInt::Div_StandardTest")
-			return 1;
-		}
+		for( ; i<first_size+1 ; ++i)
+			temp.table[i] = 0;
 
-		TTMATH_LOG("UInt::Div_StandardTest")
+		temp.Rcl(2);
+		c = AddVector(temp.table, x0, first_size+1, first_size, temp.table);
+		TTMATH_ASSERT( c==0 )
 
-	return 2;
-	}
+		// pm2 = 2*x1
+		for(i=0 ; i<first_size ; ++i)
+			pm2.table[i] = x1[i];
 
+		pm2.table[first_size] = 0;
+		pm2.Rcl(1);
+
+		// p(-2) = x0 + 4*x2 - 2*x1
+		pm2_sign = SubVector(temp.table, pm2.table, first_size+1, first_size+1, pm2.table) != 0;
+
+		if( pm2_sign )
+			MulToom_ChangeSign(pm2);
+	}
 
 
 	/*!
-		return values:
-		0 - ok 
-			'm' - is the index (from 0) of last non-zero word in table ('this')
-			'n' - is the index (from 0) of last non-zero word in v.table
-		1 - v is zero 
-		2 - 'this' is zero
-		3 - 'this' is smaller than v
-		4 - 'this' is equal v
+		an auxiliary method for calculating the Toom-3 multiplication
 
-		if the return value is different than zero the 'm' and 'n' are undefined
+		result_size is equal ss_size*2
 	*/
-	uint Div_CalculatingSize(const UInt<value_size> & v, uint & m, uint & n)
+	template<uint ss_size>
+	void Mul4Big2(const uint * ss1, const uint * ss2, uint * result)
 	{
-		for(n = value_size-1 ; n!=0 && v.table[n]==0 ; --n);
+		if( ss_size < TTMATH_USE_TOOM3_MULTIPLICATION_FROM_SIZE )
+			return Mul3Big2<ss_size>(ss1, ss2, result);
 
-		if( n==0 && v.table[n]==0 )
-			return 1;
+		// the compiler creates Mul4Big3<> even for a small ss_size (for which
+		// we never reach this place) so for such sizes we're giving it other
+		// parameters which stop the recurrence
+		const uint size = (ss_size < TTMATH_USE_TOOM3_MULTIPLICATION_FROM_SIZE) ? 5 : ss_size;
 
-		for(m = value_size-1 ; m!=0 && table[m]==0 ; --m);
+		// x0 and x1 have (size+2)/3 words, x2 has the rest (at least one word)
+		Mul4Big3<(size+2)/3, size - (size+2)/3*2>(ss1, ss2, result);
+	}
 
-		if( m==0 && table[m]==0 )
-			return 2;
 
-		if( m < n )
-			return 3;
-		else
-		if( m == n )
-		{
-			uint i;
+
+#ifdef _MSC_VER
+#pragma warning (disable : 4717)
+//warning C4717: recursive on all control paths, function will cause runtime stack overflow
+//we have the stop point in Mul4Big2() method
+#endif
+
+
+	/*!
+		an auxiliary method for calculating the Toom-3 multiplication
+
+			x = x2*B^(2m) + x1*B^m + x0
+			y = y2*B^(2m) + y1*B^m + y0
+
+			first_size  - is the size of vectors: x0, x1, y0 and y1
+			second_size - is the size of vectors: x2 and y2 (it's smaller than or equal to first_size)
+	*/
+	template<uint first_size, uint second_size>
+	void Mul4Big3(const uint * ss1, const uint * ss2, uint * result)
+	{
+	uint i;
+	bool xm1_sign, xm2_sign, ym1_sign, ym2_sign;
+
+		UInt<first_size+1> x1, xm1, xm2, y1, ym1, ym2;
+		UInt<first_size*2+2> r1, rm1, rm2;
+
+		// r0 = r(0) and r4 = r(inf) we store directly in the result
+		Mul4Big2<first_size>(ss1, ss2, result);
+		Mul4Big2<second_size>(ss1 + first_size*2, ss2 + first_size*2, result + first_size*4);
+
+		for(i=first_size*2 ; i<first_size*4 ; ++i)
+			result[i] = 0;
+
+		Mul4_Evaluate<first_size, second_size>(ss1, x1, xm1, xm2, xm1_sign, xm2_sign);
+		Mul4_Evaluate<first_size, second_size>(ss2, y1, ym1, ym2, ym1_sign, ym2_sign);
+
+		Mul4Big2<first_size+1>(x1.table,  y1.table,  r1.table);   // r(1)
+		Mul4Big2<first_size+1>(xm1.table, ym1.table, rm1.table);  // |r(-1)|
+		Mul4Big2<first_size+1>(xm2.table, ym2.table, rm2.table);  // |r(-2)|
+
+		if( xm1_sign != ym1_sign )
+			MulToom_ChangeSign(rm1);
+
+		if( xm2_sign != ym2_sign )
+			MulToom_ChangeSign(rm2);
+
+		Mul4_Interpolate<first_size, second_size>(r1, rm1, rm2, result);
+	}
+
+
+	/*!
+		an auxiliary method for the Toom-3 multiplication (and squaring)
+
+		r1, rm1 and rm2 are r(1), r(-1) and r(-2) (in two's complement form),
+		r(0) and r(inf) are already in the result (and the rest of the result is cleared)
+
+		the coefficients r1, r2 and r3 are calculated from r(0), r(1), r(-1), r(-2) and r(inf)
+		in the way described by Marco Bodrato (all intermediate values are exact)
+			r3 = (r(-2) - r(1)) / 3
+			r1 = (r(1) - r(-1)) / 2
+			r2 = r(-1) - r(0)
+			r3 = (r2 - r3) / 2 + 2*r(inf)
+			r2 = r2 + r1 - r(inf)
+			r1 = r1 - r3
+		intermediate values can be negative, they're kept in two's complement form
+	*/
+	template<uint first_size, uint second_size>
+	static void Mul4_Interpolate(UInt<first_size*2+2> & r1, UInt<first_size*2+2> & rm1,
+								 UInt<first_size*2+2> & rm2, uint * result)
+	{
+	const uint result_size = (first_size*2 + second_size) * 2;
+	const uint r_size      = first_size*2 + 2;
+	const uint r3_size     = (r_size < result_size - first_size*3) ? r_size : result_size - first_size*3;
+	uint i, c;
+
+		// rm2 = r3 = (r(-2) - r(1)) / 3
+		rm2.Sub(r1);
+		MulToom_DivInt(rm2, 3);
+
+		// r1 = (r(1) - r(-1)) / 2
+		r1.Sub(rm1);
+		MulToom_Rcr(r1, 1);
+
+		// rm1 = r2 = r(-1) - r(0)
+		SubVector(rm1.table, result, r_size, first_size*2, rm1.table);
+
+		// rm2 = r3 = (r2 - r3) / 2 + 2*r(inf)
+		SubVector(rm1.table, rm2.table, r_size, r_size, rm2.table);
+		MulToom_Rcr(rm2, 1);
+		AddVector(rm2.table, result + first_size*4, r_size, second_size*2, rm2.table);
+		AddVector(rm2.table, result + first_size*4, r_size, second_size*2, rm2.table);
+
+		// rm1 = r2 = r2 + r1 - r(inf)
+		rm1.Add(r1);
+		SubVector(rm1.table, result + first_size*4, r_size, second_size*2, rm1.table);
+
+		// r1 = r1 - r3
+		r1.Sub(rm2);
+
+		// now r1, rm1 and rm2 are the coefficients r1, r2 and r3 (they are not negative)
+		// and we're adding them to the result
+		c  = AddVector(result + first_size,   r1.table,  result_size - first_size,   r_size, result + first_size);
+		c += AddVector(result + first_size*2, rm1.table, result_size - first_size*2, r_size, result + first_size*2);
+
+		// r3 = x1*y2 + x2*y1 has at most first_size+second_size+1 words
+		for(i=r3_size ; i<r_size ; ++i)
+			TTMATH_ASSERT( rm2.table[i] == 0 )
+			;
+
+		c += AddVector(result + first_size*3, rm2.table, result_size - first_size*3, r3_size, result + first_size*3);
+		TTMATH_ASSERT( c==0 )
+	}
+
+
+#ifdef _MSC_VER
+#pragma warning (default : 4717)
+#endif
+
+
+	/*!
+		an auxiliary method for the Toom-4 multiplication
+
+		it calculates the values of p(t) = x3*t^3 + x2*t^2 + x1*t + x0 in points 1, -1, 2, -2
+		and 2^3 * p(1/2)
+		(x0, x1 and x2 have first_size words, x3 has second_size words)
+
+		the values in the negative points are returned as the absolute values
+		and their signs (pm1_sign and pm2_sign)
+	*/
+	template<uint first_size, uint second_size>
+	static void Mul5_Evaluate(const uint * x, UInt<first_size+1> & p1, UInt<first_size+1> & pm1,
+							  UInt<first_size+1> & p2, UInt<first_size+1> & pm2, UInt<first_size+1> & ph,
+							  bool & pm1_sign, bool & pm2_sign)
+	{
+	const uint * x0 = x;
+	const uint * x1 = x + first_size;
+	const uint * x2 = x + first_size*2;
+	const uint * x3 = x + first_size*3;
+	UInt<first_size+1> even, odd;
+	uint i, c;
+
+		// even = x0 + x2
+		// odd  = x1 + x3
+		even.table[first_size] = AddVector(x0, x2, first_size, first_size,  even.table);
+		odd.table[first_size]  = AddVector(x1, x3, first_size, second_size, odd.table);
+
+		// p(1) = even + odd
+		c = AddVector(even.table, odd.table, first_size+1, first_size+1, p1.table);
+		TTMATH_ASSERT( c==0 )
+
+		// p(-1) = even - odd
+		pm1_sign = SubVector(even.table, odd.table, first_size+1, first_size+1, pm1.table) != 0;
+
+		if( pm1_sign )
+			MulToom_ChangeSign(pm1);
+
+		// even = x0 + 4*x2
+		for(i=0 ; i<first_size ; ++i)
+			even.table[i] = x2[i];
+
+		even.table[first_size] = 0;
+		even.Rcl(2);
+		c = AddVector(even.table, x0, first_size+1, first_size, even.table);
+		TTMATH_ASSERT( c==0 )
+
+		// odd = 2*x1 + 8*x3
+		for(i=0 ; i<second_size ; ++i)
+			odd.table[i] = x3[i];
+
+		for( ; i<first_size+1 ; ++i)
+			odd.table[i] = 0;
+
+		odd.Rcl(2);
+		c = AddVector(odd.table, x1, first_size+1, first_size, odd.table);
+		TTMATH_ASSERT( c==0 )
+		odd.Rcl(1);
+
+		// p(2) = even + odd
+		c = AddVector(even.table, odd.table, first_size+1, first_size+1, p2.table);
+		TTMATH_ASSERT( c==0 )
+
+		// p(-2) = even - odd
+		pm2_sign = SubVector(even.table, odd.table, first_size+1, first_size+1, pm2.table) != 0;
+
+		if( pm2_sign )
+			MulToom_ChangeSign(pm2);
+
+		// ph = 8*x0 + 4*x1 + 2*x2 + x3 = ((2*x0 + x1)*2 + x2)*2 + x3
+		for(i=0 ; i<first_size ; ++i)
+			ph.table[i] = x0[i];
+
+		ph.table[first_size] = 0;
+		ph.Rcl(1);
+		AddVector(ph.table, x1, first_size+1, first_size, ph.table);
+		ph.Rcl(1);
+		AddVector(ph.table, x2, first_size+1, first_size, ph.table);
+		ph.Rcl(1);
+		c = AddVector(ph.table, x3, first_size+1, second_size, ph.table);
+		TTMATH_ASSERT( c==0 )
+	}
+
+
+	/*!
+		an auxiliary method for calculating the Toom-4 multiplication
+
+		result_size is equal ss_size*2
+	*/
+	template<uint ss_size>
+	void Mul5Big2(const uint * ss1, const uint * ss2, uint * result)
+	{
+		if( ss_size < TTMATH_USE_TOOM4_MULTIPLICATION_FROM_SIZE )
+			return Mul4Big2<ss_size>(ss1, ss2, result);
+
+		// the same as in Mul4Big2() - these parameters only stop the recurrence
+		const uint size = (ss_size < TTMATH_USE_TOOM4_MULTIPLICATION_FROM_SIZE) ? 10 : ss_size;
+
+		// x0, x1 and x2 have (size+3)/4 words, x3 has the rest (at least one word)
+		Mul5Big3<(size+3)/4, size - (size+3)/4*3>(ss1, ss2, result);
+	}
+
+
+
+#ifdef _MSC_VER
+#pragma warning (disable : 4717)
+//warning C4717: recursive on all control paths, function will cause runtime stack overflow
+//we have the stop point in Mul5Big2() method
+#endif
+
+
+	/*!
+		an auxiliary method for calculating the Toom-4 multiplication
+
+			x = x3*B^(3m) + x2*B^(2m) + x1*B^m + x0
+			y = y3*B^(3m) + y2*B^(2m) + y1*B^m + y0
+
+			first_size  - is the size of vectors: x0, x1, x2, y0, y1 and y2
+			second_size - is the size of vectors: x3 and y3 (it's smaller than or equal to first_size)
+	*/
+	template<uint first_size, uint second_size>
+	void Mul5Big3(const uint * ss1, const uint * ss2, uint * result)
+	{
+	uint i;
+	bool xm1_sign, xm2_sign, ym1_sign, ym2_sign;
+
+		UInt<first_size+1> x1, xm1, x2, xm2, xh, y1, ym1, y2, ym2, yh;
+		UInt<first_size*2+2> v1, vm1, v2, vm2, vh;
+
+		// r0 = r(0) and r6 = r(inf) we store directly in the result
+		Mul5Big2<first_size>(ss1, ss2, result);
+		Mul5Big2<second_size>(ss1 + first_size*3, ss2 + first_size*3, result + first_size*6);
+
+		for(i=first_size*2 ; i<first_size*6 ; ++i)
+			result[i] = 0;
+
+		Mul5_Evaluate<first_size, second_size>(ss1, x1, xm1, x2, xm2, xh, xm1_sign, xm2_sign);
+		Mul5_Evaluate<first_size, second_size>(ss2, y1, ym1, y2, ym2, yh, ym1_sign, ym2_sign);
+
+		Mul5Big2<first_size+1>(x1.table,  y1.table,  v1.table);   // r(1)
+		Mul5Big2<first_size+1>(xm1.table, ym1.table, vm1.table);  // |r(-1)|
+		Mul5Big2<first_size+1>(x2.table,  y2.table,  v2.table);   // r(2)
+		Mul5Big2<first_size+1>(xm2.table, ym2.table, vm2.table);  // |r(-2)|
+		Mul5Big2<first_size+1>(xh.table,  yh.table,  vh.table);   // 2^6 * r(1/2)
+
+		if( xm1_sign != ym1_sign )
+			MulToom_ChangeSign(vm1);
+
+		if( xm2_sign != ym2_sign )
+			MulToom_ChangeSign(vm2);
+
+		Mul5_Interpolate<first_size, second_size>(v1, vm1, v2, vm2, vh, result);
+	}
+
+
+	/*!
+		an auxiliary method for the Toom-4 multiplication (and squaring)
+
+		v1, vm1, v2, vm2 and vh are r(1), r(-1), r(2), r(-2) and 2^6 * r(1/2) (in two's complement form),
+		r(0) and r(inf) are already in the result (and the rest of the result is cleared)
+
+		the product r(t) = r6*t^6 + ... + r1*t + r0, where r0 = r(0) and r6 = r(inf), we have:
+			E1 = (r(1) + r(-1)) / 2              = r0 + r2 + r4 + r6
+			O1 = (r(1) - r(-1)) / 2              = r1 + r3 + r5
+			E2 = (r(2) + r(-2)) / 2              = r0 + 4*r2 + 16*r4 + 64*r6
+			O2 = (r(2) - r(-2)) / 4              = r1 + 4*r3 + 16*r5
+			rh = 2^6 * r(1/2)                    = 64*r0 + 32*r1 + 16*r2 + 8*r3 + 4*r4 + 2*r5 + r6
+		and then:
+			r4 = ((E2 - r0 - 64*r6)/4 - (E1 - r0 - r6)) / 3
+			r2 = E1 - r0 - r6 - r4
+			W  = (rh - 64*r0 - 16*r2 - 4*r4 - r6) / 2   = 16*r1 + 4*r3 + r5
+			D  = (W - O2) / 15                          = r1 - r5
+			S  = (2*(O2 - 4*O1) + 15*D) / 9             = r1 + r5
+			r1 = (S + D) / 2
+			r5 = (S - D) / 2
+			r3 = O1 - S
+		all divisions are exact, intermediate values can be negative
+		and they're kept in two's complement form
+	*/
+	template<uint first_size, uint second_size>
+	static void Mul5_Interpolate(UInt<first_size*2+2> & v1, UInt<first_size*2+2> & vm1, UInt<first_size*2+2> & v2,
+								 UInt<first_size*2+2> & vm2, UInt<first_size*2+2> & vh, uint * result)
+	{
+	const uint result_size = (first_size*3 + second_size) * 2;
+	const uint r_size      = first_size*2 + 2;
+	const uint r5_size     = (r_size < result_size - first_size*5) ? r_size : result_size - first_size*5;
+	const uint * r0        = result;
+	const uint * r6        = result + first_size*6;
+	uint i, c;
+
+		UInt<r_size> temp;
+
+		// vm1 = O1, v1 = E1
+		SubVector(v1.table, vm1.table, r_size, r_size, vm1.table);
+		v1.Rcl(1);
+		v1.Sub(vm1);
+		MulToom_Rcr(v1, 1);
+		MulToom_Rcr(vm1, 1);
+
+		// vm2 = O2, v2 = E2
+		SubVector(v2.table, vm2.table, r_size, r_size, vm2.table);
+		v2.Rcl(1);
+		v2.Sub(vm2);
+		MulToom_Rcr(v2, 1);
+		MulToom_Rcr(vm2, 2);
+
+		// v1 = E1 - r0 - r6
+		SubVector(v1.table, r0, r_size, first_size*2,  v1.table);
+		SubVector(v1.table, r6, r_size, second_size*2, v1.table);
+
+		// v2 = (E2 - r0 - 64*r6) / 4
+		SubVector(v2.table, r0, r_size, first_size*2, v2.table);
+		Mul5_CopyShifted(r6, second_size*2, temp, 6);
+		v2.Sub(temp);
+		MulToom_Rcr(v2, 2);
+
+		// v2 = r4
+		v2.Sub(v1);
+		MulToom_DivInt(v2, 3);
+
+		// v1 = r2
+		v1.Sub(v2);
+
+		// vh = W
+		Mul5_CopyShifted(r0, first_size*2, temp, 6);
+		vh.Sub(temp);
+		temp = v1;
+		temp.Rcl(4);
+		vh.Sub(temp);
+		temp = v2;
+		temp.Rcl(2);
+		vh.Sub(temp);
+		SubVector(vh.table, r6, r_size, second_size*2, vh.table);
+		MulToom_Rcr(vh, 1);
+
+		// vh = D
+		vh.Sub(vm2);
+		MulToom_DivInt(vh, 15);
+
+		// vm2 = S
+		temp = vm1;
+		temp.Rcl(2);
+		vm2.Sub(temp);
+		vm2.Rcl(1);
+		temp = vh;
+		temp.Rcl(4);
+		temp.Sub(vh);
+		vm2.Add(temp);
+		MulToom_DivInt(vm2, 9);
+
+		// vm1 = r3
+		vm1.Sub(vm2);
+
+		// temp = r1
+		temp = vm2;
+		temp.Add(vh);
+		MulToom_Rcr(temp, 1);
+
+		// vm2 = r5
+		vm2.Sub(vh);
+		MulToom_Rcr(vm2, 1);
+
+		// now we have all coefficients (they are not negative) and we're adding them to the result
+		c  = AddVector(result + first_size,   temp.table, result_size - first_size,   r_size, result + first_size);
+		c += AddVector(result + first_size*2, v1.table,   result_size - first_size*2, r_size, result + first_size*2);
+		c += AddVector(result + first_size*3, vm1.table,  result_size - first_size*3, r_size, result + first_size*3);
+		c += AddVector(result + first_size*4, v2.table,   result_size - first_size*4, r_size, result + first_size*4);
+
+		// r5 = x2*y3 + x3*y2 has at most first_size+second_size+1 words
+		for(i=r5_size ; i<r_size ; ++i)
+			TTMATH_ASSERT( vm2.table[i] == 0 )
+			;
+
+		c += AddVector(result + first_size*5, vm2.table, result_size - first_size*5, r5_size, result + first_size*5);
+		TTMATH_ASSERT( c==0 )
+	}
+
+
+#ifdef _MSC_VER
+#pragma warning (default : 4717)
+#endif
+
+
+	/*!
+		an auxiliary method for the Toom-4 multiplication
+
+		it copies 'size' words from 'source' to 'dest' and multiplies 'dest' by 2^bits
+		(the rest of 'dest' is cleared)
+	*/
+	template<uint dest_size>
+	static void Mul5_CopyShifted(const uint * source, uint size, UInt<dest_size> & dest, uint bits)
+	{
+	uint i;
+
+		for(i=0 ; i<size ; ++i)
+			dest.table[i] = source[i];
+
+		for( ; i<dest_size ; ++i)
+			dest.table[i] = 0;
+
+		dest.Rcl(bits);
+	}
+
+
+public:
+
+
+	/*!
+		multiplication: this = this * ss2
+
+		This is multiplication by using the number-theoretic transform (NTT), we're using it
+		when value_size is greater than or equal to TTMATH_USE_NTT_MULTIPLICATION_FROM_SIZE macro
+		(defined in ttmathtypes.h).
+
+		The words of 'this' and 'ss2' are treated as coefficients of two polynomials,
+		the product of the polynomials (a convolution) is calculated by using the fast
+		Fourier transform over a finite field Z/pZ (where p is a prime number):
+			x*y = InverseTransform( Transform(x) * Transform(y) )
+		where '*' in the brackets is the multiplication of the corresponding items only.
+
+		The coefficients of the product can be greater than p so the convolution is
+		calculated three times (with three different primes) and the real coefficients
+		are restored from the residues by using the Chinese remainder theorem.
+		At the end the coefficients are added together with carries.
+
+		NTT multiplication has O( n*log(n) )
+	*/
+	uint Mul6(const UInt<value_size> & ss2)
+	{
+	UInt<value_size*2> result;
+	uint i, c = 0;
+
+		Mul6Big(ss2, result);
+
+		// copying result
+		for(i=0 ; i<value_size ; ++i)
+			table[i] = result.table[i];
+
+		// testing carry
+		for( ; i<value_size*2 ; ++i)
+			if( result.table[i] != 0 )
+			{
+				c = 1;
+				break;
+			}
+
+		TTMATH_LOG("UInt::Mul6")
+
+	return c;
+	}
+
+
+
+	/*!
+		multiplication: result = this * ss2
+
+		result is twice bigger than this and ss2,
+		this method never returns carry,
+		(NTT multiplication)
+	*/
+	void Mul6Big(const UInt<value_size> & ss2, UInt<value_size*2> & result)
+	{
+		Mul6Big2<value_size>(table, ss2.table, result.table);
+
+		TTMATH_LOG("UInt::Mul6Big")
+	}
+
+
+
+private:
+
+
+	/*!
+		an auxiliary structure for the NTT multiplication
+
+		it describes a prime number p = k*2^n + 1 (with a big n) and its constants
+		for the Montgomery multiplication (R = 2^TTMATH_BITS_PER_UINT)
+	*/
+	struct Mul6_Prime
+	{
+		uint p;        // the prime number (smaller than R/4)
+		uint pinv;     // -p^(-1) mod R
+		uint one;      // R mod p       (the value 1 in the Montgomery form)
+		uint r2;       // R*R mod p     (for converting into the Montgomery form)
+		uint g;        // a generator of the multiplicative group of Z/pZ (in the Montgomery form)
+
+
+		/*!
+			it sets the prime with the given index (0, 1 or 2)
+		*/
+		void Set(uint index)
+		{
+		#ifdef TTMATH_PLATFORM32
+
+			// 45*2^24 + 1,  77*2^23 + 1,  119*2^23 + 1
+			static const uint primes[3]     = { 754974721u, 645922817u, 998244353u };
+			static const uint generators[3] = { 11, 3, 3 };
+
+		#else
+
+			// 29*2^57 + 1,  69*2^55 + 1,  163*2^54 + 1
+			static const uint primes[3]     = { 0x3a00000000000001ul, 0x2280000000000001ul, 0x28c0000000000001ul };
+			static const uint generators[3] = { 3, 5, 3 };
+
+		#endif
+
+		uint i, high, low;
+
+			p    = primes[index];
+			pinv = p;
+
+			// Newton's method: each step doubles the number of correct bits
+			// (p*p = 1 mod 8 so we start with three correct bits)
+			for(i=0 ; i<6 ; ++i)
+				pinv *= 2 - p * pinv;
+
+			pinv = 0 - pinv;
+
+			DivTwoWords(1, 0, p, &high, &one);
+			MulTwoWords(one, one, &high, &low);
+			DivTwoWords(high, low, p, &high, &r2);
+
+			g = MulMod(generators[index], r2);
+		}
+
+
+		/*!
+			the Montgomery multiplication: a*b/R mod p
+
+			a*b must be smaller than p*R (it's true when one of the arguments is smaller than p)
+			the result is smaller than p
+		*/
+		uint MulMod(uint a, uint b) const
+		{
+		uint high, low, mhigh, mlow;
+
+			MulTwoWords(a, b, &high, &low);
+			MulTwoWords(low * pinv, p, &mhigh, &mlow);
+
+			// low + mlow is either zero or R
+			high += mhigh + ((low != 0) ? 1 : 0);
+
+		return Reduce(high - p);
+		}
+
+
+		uint AddMod(uint a, uint b) const
+		{
+			return Reduce(a + b - p);
+		}
+
+
+		uint SubMod(uint a, uint b) const
+		{
+			return Reduce(a - b);
+		}
+
+
+		/*!
+			it returns 'a' if it's not negative or a+p in other case
+			(a is from range <-p, p) and it's treated as a number in two's complement form)
+
+			we're not using any 'if' statement here because the result is unpredictable
+			and a mispredicted branch costs more than the whole reduction
+		*/
+		uint Reduce(uint a) const
+		{
+			return a + (p & (0 - (a >> (TTMATH_BITS_PER_UINT - 1))));
+		}
+
+
+		/*!
+			a^pow (a and the result are in the Montgomery form)
+		*/
+		uint PowMod(uint a, uint pow) const
+		{
+		uint result = one;
+
+			while( pow != 0 )
+			{
+				if( (pow & 1) != 0 )
+					result = MulMod(result, a);
+
+				a     = MulMod(a, a);
+				pow >>= 1;
+			}
+
+		return result;
+		}
+	};
+
+
+	/*!
+		the forward transform (decimation in frequency)
+
+		root is the primitive size-th root of unity (in the Montgomery form),
+		size is a power of two and the result is in the bit-reversed order
+	*/
+	static void Mul6_Transform(uint * a, uint size, uint root, const Mul6_Prime & prime)
+	{
+	uint len, half, i, j, w, u, v;
+
+		for(len=size ; len>=2 ; len>>=1)
+		{
+			half = len >> 1;
+			w    = prime.one;
+
+			for(j=0 ; j<half ; ++j)
+			{
+				for(i=j ; i<size ; i+=len)
+				{
+					u = a[i];
+					v = a[i+half];
+
+					a[i]      = prime.AddMod(u, v);
+					a[i+half] = prime.MulMod(prime.SubMod(u, v), w);
+				}
+
+				w = prime.MulMod(w, root);
+			}
+
+			root = prime.MulMod(root, root);
+		}
+	}
+
+
+	/*!
+		the inverse transform (decimation in time) without dividing by 'size'
+
+		root is the inverse of the root given to Mul6_Transform(),
+		the input is in the bit-reversed order and the result is in the natural order
+	*/
+	static void Mul6_InverseTransform(uint * a, uint size, uint root, const Mul6_Prime & prime)
+	{
+	uint len, half, i, j, w, u, v;
+	uint roots[TTMATH_BITS_PER_UINT];
+
+		// roots[n] is the primitive 2^(n+1)-th root of unity
+		for(len=size, j=0 ; len>=2 ; len>>=1, ++j)
+		{
+			roots[j] = root;
+			root     = prime.MulMod(root, root);
+		}
+
+		for(len=2 ; len<=size ; len<<=1)
+		{
+			half = len >> 1;
+			w    = prime.one;
+			root = roots[--j];
+
+			for(i=0 ; i<half ; ++i)
+			{
+				for(u=i ; u<size ; u+=len)
+				{
+					v = prime.MulMod(a[u+half], w);
+
+					a[u+half] = prime.SubMod(a[u], v);
+					a[u]      = prime.AddMod(a[u], v);
+				}
+
+				w = prime.MulMod(w, root);
+			}
+		}
+	}
+
+
+	/*!
+		an auxiliary method for the NTT multiplication
+
+		it calculates the convolution of ss1 and ss2 modulo the given prime,
+		the result (size words) is in the normal form (not in the Montgomery form)
+		and fb is a temporary buffer (size words too)
+
+		if ss1 and ss2 point to the same table (squaring) only one forward
+		transform is made and fb is not used
+	*/
+	static void Mul6_Convolution(const uint * ss1, const uint * ss2, uint ss_size, uint size,
+								 const Mul6_Prime & prime, uint * result, uint * fb)
+	{
+	uint i, root;
+
+		// the Montgomery form of the coefficients (ss1[i] can be greater than p)
+		for(i=0 ; i<ss_size ; ++i)
+			result[i] = prime.MulMod(ss1[i], prime.r2);
+
+		for( ; i<size ; ++i)
+			result[i] = 0;
+
+		// the transform of 'size' items is possible only when 'size' divides p-1
+		TTMATH_ASSERT( (prime.p - 1) % size == 0 )
+
+		root = prime.PowMod(prime.g, (prime.p - 1) / size);
+		Mul6_Transform(result, size, root, prime);
+
+		if( ss1 == ss2 )
+		{
+			for(i=0 ; i<size ; ++i)
+				result[i] = prime.MulMod(result[i], result[i]);
+		}
+		else
+		{
+			for(i=0 ; i<ss_size ; ++i)
+				fb[i] = prime.MulMod(ss2[i], prime.r2);
+
+			for( ; i<size ; ++i)
+				fb[i] = 0;
+
+			Mul6_Transform(fb, size, root, prime);
+
+			for(i=0 ; i<size ; ++i)
+				result[i] = prime.MulMod(result[i], fb[i]);
+		}
+
+		root = prime.PowMod(root, size - 1);
+		Mul6_InverseTransform(result, size, root, prime);
+
+		// size divides p-1 so the inverse of size is: p - (p-1)/size
+		// and this multiplication gets the normal form too
+		root = prime.p - (prime.p - 1) / size;
+
+		for(i=0 ; i<size ; ++i)
+			result[i] = prime.MulMod(result[i], root);
+	}
+
+
+	/*!
+		an auxiliary method for the NTT multiplication
+
+		x = x + y + c
+		it returns the new carry
+	*/
+	static uint Mul6_AddWord(uint & x, uint y, uint c)
+	{
+	uint temp = x + y;
+	uint carry = (temp < y) ? 1 : 0;
+
+		x = temp + c;
+
+		if( x < temp )
+			carry = 1;
+
+	return carry;
+	}
+
+
+	/*!
+		an auxiliary method for calculating the NTT multiplication
+
+		result_size is equal ss_size*2
+	*/
+	template<uint ss_size>
+	void Mul6Big2(const uint * ss1, const uint * ss2, uint * result)
+	{
+	// size of the transform is the smallest power of two greater than or equal to ss_size*2
+	const uint s1   = ss_size*2 - 1;
+	const uint s2   = s1 | (s1 >> 1);
+	const uint s3   = s2 | (s2 >> 2);
+	const uint s4   = s3 | (s3 >> 4);
+	const uint s5   = s4 | (s4 >> 8);
+	const uint size = (s5 | (s5 >> 16)) + 1;
+
+	uint i, t1, t2, u, high, low, c;
+	uint x0, x1, x2;
+	Mul6_Prime prime[3];
+
+		// the NTT is used for big values (MulFastestBig() selects it from
+		// TTMATH_USE_NTT_MULTIPLICATION_FROM_SIZE words) so the four tables of 'size' words
+		// are allocated on the heap, they could not fit on the stack
+		std::vector<uint> buffer(size * 4);
+		uint * a0   = &buffer[0];
+		uint * a1   = a0 + size;
+		uint * a2   = a1 + size;
+		uint * temp = a2 + size;
+
+		for(i=0 ; i<3 ; ++i)
+			prime[i].Set(i);
+
+		Mul6_Convolution(ss1, ss2, ss_size, size, prime[0], a0, temp);
+		Mul6_Convolution(ss1, ss2, ss_size, size, prime[1], a1, temp);
+		Mul6_Convolution(ss1, ss2, ss_size, size, prime[2], a2, temp);
+
+		// the Chinese remainder theorem (Garner's algorithm):
+		// x = a0 + p0*t1 + p0*p1*t2
+		// t1 = (a1 - a0) / p0                   (mod p1)
+		// t2 = ((a2 - a0) / p0 - t1) / p1       (mod p2)
+		// and x is smaller than p0*p1*p2 (it has three words)
+		uint p0_inv1 = prime[1].PowMod(prime[1].MulMod(prime[0].p, prime[1].r2), prime[1].p - 2);
+		uint p0_inv2 = prime[2].PowMod(prime[2].MulMod(prime[0].p, prime[2].r2), prime[2].p - 2);
+		uint p1_inv2 = prime[2].PowMod(prime[2].MulMod(prime[1].p, prime[2].r2), prime[2].p - 2);
+
+		// the sum of the coefficients we're calculating in x0, x1 and x2
+		x0 = x1 = x2 = 0;
+
+		for(i=0 ; i<ss_size*2 ; ++i)
+		{
+			// MulMod(a, one) is 'a mod p'
+			t1 = prime[1].SubMod(a1[i], prime[1].MulMod(a0[i], prime[1].one));
+			t1 = prime[1].MulMod(t1, p0_inv1);
+
+			u  = prime[2].SubMod(a2[i], prime[2].MulMod(a0[i], prime[2].one));
+			u  = prime[2].MulMod(u, p0_inv2);
+			t2 = prime[2].SubMod(u, prime[2].MulMod(t1, prime[2].one));
+			t2 = prime[2].MulMod(t2, p1_inv2);
+
+			// (high, low) = t1 + p1*t2
+			MulTwoWords(prime[1].p, t2, &high, &low);
+			high += Mul6_AddWord(low, t1, 0);
+
+			// adding a0 + p0*(high, low) to x0..x2
+			c = Mul6_AddWord(x0, a0[i], 0);
+			c = Mul6_AddWord(x1, 0, c);
+			Mul6_AddWord(x2, 0, c);
+
+			MulTwoWords(prime[0].p, low, &t1, &u);
+			c = Mul6_AddWord(x0, u, 0);
+			c = Mul6_AddWord(x1, t1, c);
+			Mul6_AddWord(x2, 0, c);
+
+			MulTwoWords(prime[0].p, high, &t1, &u);
+			c = Mul6_AddWord(x1, u, 0);
+			Mul6_AddWord(x2, t1, c);
+
+			result[i] = x0;
+			x0 = x1;
+			x1 = x2;
+			x2 = 0;
+		}
+
+		TTMATH_ASSERT( x0 == 0 && x1 == 0 )
+	}
+
+
+public:
+
+
+	/*!
+		multiplication this = this * ss2
+	*/
+	uint MulFastest(const UInt<value_size> & ss2)
+	{
+	UInt<value_size*2> result;
+	uint i, c = 0;
+
+		MulFastestBig(ss2, result);
+	
+		// copying result
+		for(i=0 ; i<value_size ; ++i)
+			table[i] = result.table[i];
+
+		// testing carry (all words are tested, there is no early exit)
+		for( ; i<value_size*2 ; ++i)
+			c |= result.table[i];
+
+		c = (c != 0) ? 1 : 0;
+
+		TTMATH_LOG("UInt::MulFastest")
+
+	return c;
+	}
+
+
+	/*!
+		multiplication result = this * ss2
+
+		this method is trying to select the fastest algorithm
+		(in the future this method can be improved)
+	*/
+	void MulFastestBig(const UInt<value_size> & ss2, UInt<value_size*2> & result)
+	{
+		if( &ss2 == this )
+			// x.Mul(x) - the squaring is faster
+			return SqrFastestBig(result);
+
+	#ifdef TTMATH_CONSTANT_TIME
+		// the other algorithms check the sizes of the values and have
+		// branches depending on carries
+		return Mul2Big(ss2, result);
+	#else
+
+		if( value_size < TTMATH_USE_KARATSUBA_MULTIPLICATION_FROM_SIZE )
+			return Mul2Big(ss2, result);
+
+		uint x1size  = value_size, x2size  = value_size;
+		uint x1start = 0,          x2start = 0;
+
+		for(x1size=value_size ; x1size>0 && table[x1size-1]==0 ; --x1size);
+		for(x2size=value_size ; x2size>0 && ss2.table[x2size-1]==0 ; --x2size);
+
+		if( x1size==0 || x2size==0 )
+		{
+			// either 'this' or 'ss2' is equal zero - the result is zero too
+			result.SetZero();
+			return;
+		}
+
+		for(x1start=0 ; x1start<x1size && table[x1start]==0 ; ++x1start);
+		for(x2start=0 ; x2start<x2size && ss2.table[x2start]==0 ; ++x2start);
+
+		uint distancex1 = x1size - x1start;
+		uint distancex2 = x2size - x2start;
+
+		if( distancex1 < 3 || distancex2 < 3 )
+			// either 'this' or 'ss2' have only 2 (or 1) item different from zero (side by side)
+			// (this condition in the future can be improved)
+			return Mul2Big3<value_size>(table, ss2.table, result, x1start, x1size, x2start, x2size);
+
+
+		if( value_size >= TTMATH_USE_NTT_MULTIPLICATION_FROM_SIZE &&
+			distancex1 >= TTMATH_USE_NTT_MULTIPLICATION_FROM_SIZE &&
+			distancex2 >= TTMATH_USE_NTT_MULTIPLICATION_FROM_SIZE )
+			// multiplication by using the number-theoretic transform
+			Mul6Big(ss2, result);
+		else
+		if( value_size >= TTMATH_USE_TOOM4_MULTIPLICATION_FROM_SIZE &&
+			distancex1 >= TTMATH_USE_TOOM4_MULTIPLICATION_FROM_SIZE &&
+			distancex2 >= TTMATH_USE_TOOM4_MULTIPLICATION_FROM_SIZE )
+			// Toom-4 multiplication
+			Mul5Big(ss2, result);
+		else
+		if( value_size >= TTMATH_USE_TOOM3_MULTIPLICATION_FROM_SIZE &&
+			distancex1 >= TTMATH_USE_TOOM3_MULTIPLICATION_FROM_SIZE &&
+			distancex2 >= TTMATH_USE_TOOM3_MULTIPLICATION_FROM_SIZE )
+			// Toom-3 multiplication
+			Mul4Big(ss2, result);
+		else
+			// Karatsuba multiplication
+			Mul3Big(ss2, result);
+
+		TTMATH_LOG("UInt::MulFastestBig")
+
+	#endif
+	}
+
+
+	/*!
+	 *
+	 * Squaring
+	 *
+	 *
+	*/
+
+public:
+
+
+	/*!
+		squaring: this = this * this
+
+		it returns a carry if it has been
+
+		algorithm: the same numbers as in Mul() (1 - 6, 100 - the fastest)
+		but we're using the fact that both factors are equal, e.g. the schoolbook
+		algorithm makes only about half of the word multiplications and the
+		Karatsuba algorithm needs only squarings in the recurrence
+	*/
+	uint Sqr(uint algorithm = 100)
+	{
+	UInt<value_size*2> result;
+	uint i, c = 0;
+
+		SqrBig(result, algorithm);
+
+		// copying result
+		for(i=0 ; i<value_size ; ++i)
+			table[i] = result.table[i];
+
+		// testing carry (all words are tested, there is no early exit)
+		for( ; i<value_size*2 ; ++i)
+			c |= result.table[i];
+
+		c = (c != 0) ? 1 : 0;
+
+		TTMATH_LOG("UInt::Sqr")
+
+	return c;
+	}
+
+
+	/*!
+		squaring: result = this * this
+
+		result is twice bigger than 'this',
+		this method never returns a carry
+	*/
+	void SqrBig(UInt<value_size*2> & result, uint algorithm = 100)
+	{
+		switch( algorithm )
+		{
+		case 1:
+			Mul1Big(*this, result);
+			break;
+
+		case 2:
+			Sqr2Big2<value_size>(table, result);
+			break;
+
+		case 3:
+			Sqr3Big2<value_size>(table, result.table);
+			break;
+
+		case 4:
+			Sqr4Big2<value_size>(table, result.table);
+			break;
+
+		case 5:
+			Sqr5Big2<value_size>(table, result.table);
+			break;
+
+		case 6:
+			// Mul6_Convolution() makes only one forward transform if both pointers are equal
+			Mul6Big2<value_size>(table, table, result.table);
+			break;
+
+		case 100:
+		default:
+			SqrFastestBig(result);
+		}
+
+		TTMATH_LOG("UInt::SqrBig")
+	}
+
+
+private:
+
+
+	/*!
+		an auxiliary method for the schoolbook squaring
+	*/
+	template<uint ss_size>
+	void Sqr2Big2(const uint * ss, UInt<ss_size*2> & result)
+	{
+	uint xsize = ss_size, xstart = 0;
+
+	#ifndef TTMATH_CONSTANT_TIME
+
+		if( ss_size > 2 )
+		{
+			for(xsize=ss_size ; xsize>0 && ss[xsize-1]==0 ; --xsize);
+			for(xstart=0 ; xstart<xsize && ss[xstart]==0 ; ++xstart);
+		}
+
+	#endif
+
+		Sqr2Big3<ss_size>(ss, result, xstart, xsize);
+	}
+
+
+	/*!
+		an auxiliary method for the schoolbook squaring (SqrBigVector())
+	*/
+	template<uint ss_size>
+	void Sqr2Big3(const uint * ss, UInt<ss_size*2> & result, uint xstart, uint xsize)
+	{
+	uint i;
+
+		if( xsize == 0 )
+		{
+			result.SetZero();
+			return;
+		}
+
+		for(i=0 ; i<xstart*2 ; ++i)
+			result.table[i] = 0;
+
+		for(i=xsize*2 ; i<ss_size*2 ; ++i)
+			result.table[i] = 0;
+
+		SqrBigVector(ss+xstart, xsize-xstart, result.table+xstart*2);
+	}
+
+
+	/*!
+		an auxiliary method for the Karatsuba squaring
+
+		result_size is equal ss_size*2
+	*/
+	template<uint ss_size>
+	void Sqr3Big2(const uint * ss, uint * result)
+	{
+		if( ss_size>1 && ss_size<TTMATH_USE_KARATSUBA_MULTIPLICATION_FROM_SIZE )
+		{
+			UInt<ss_size*2> res;
+			Sqr2Big2<ss_size>(ss, res);
+
+			for(uint i=0 ; i<ss_size*2 ; ++i)
+				result[i] = res.table[i];
+
+		return;
+		}
+		else
+		if( ss_size == 1 )
+		{
+			return MulTwoWords(*ss, *ss, &result[1], &result[0]);
+		}
+
+		// the same division as in Mul3Big2()
+		if( (ss_size & 1) == 1 )
+			Sqr3Big3<ss_size/2 + 1, ss_size/2, ss_size*2>(ss + ss_size / 2 + 1, ss, result);
+		else
+			Sqr3Big3<ss_size/2, ss_size/2, ss_size*2>(ss + ss_size / 2, ss, result);
+	}
+
+
+
+#ifdef _MSC_VER
+#pragma warning (disable : 4717)
+//warning C4717: recursive on all control paths, function will cause runtime stack overflow
+//we have the stop point in Sqr3Big2() method
+#endif
+
+
+	/*!
+		an auxiliary method for calculating the Karatsuba squaring
+
+			x = x1*B^m + x0
+			x^2 = z2*B^(2m) + z1*B^m + z0
+		where
+			z0 = x0^2
+			z2 = x1^2
+			z1 = (x1 + x0)^2 - z2 - z0
+
+		first_size  - is the size of x0
+		second_size - is the size of x1 (equal first_size or smaller about one)
+	*/
+	template<uint first_size, uint second_size, uint result_size>
+	void Sqr3Big3(const uint * x1, const uint * x0, uint * result)
+	{
+	uint i, c, xc;
+
+		UInt<first_size>   temp;
+		UInt<first_size*3> z1;
+
+		// z0 and z2 we store directly in the result
+		Sqr3Big2<first_size>(x0, result);                  // z0
+		Sqr3Big2<second_size>(x1, result+first_size*2);    // z2
+
+		// (x0 + x1) = xc*B^m + temp
+		// (x0 + x1)^2 = temp^2 + 2*xc*temp*B^m + xc*B^(2m)
+		xc = AddVector(x0, x1, first_size, second_size, temp.table);
+
+		Sqr3Big2<first_size>(temp.table, z1.table);
+
+		// clearing the rest of z1
+		for(i=first_size*2 ; i<first_size*3 ; ++i)
+			z1.table[i] = 0;
+
+		if( xc )
+		{
+			c  = AddVector(z1.table+first_size, temp.table, first_size*3-first_size, first_size, z1.table+first_size);
+			c += AddVector(z1.table+first_size, temp.table, first_size*3-first_size, first_size, z1.table+first_size);
+			TTMATH_ASSERT( c==0 )
+
+			for( i=first_size*2 ; i<first_size*3 ; ++i )
+				if( ++z1.table[i] != 0 )
+					break;  // break if there was no carry
+		}
+
+		// z1 = z1 - z2
+		c = SubVector(z1.table, result+first_size*2, first_size*3, second_size*2, z1.table);
+		TTMATH_ASSERT(c==0)
+
+		// z1 = z1 - z0
+		c = SubVector(z1.table, result, first_size*3, first_size*2, z1.table);
+		TTMATH_ASSERT(c==0)
+
+		// adding z1 to the result (the same as in Mul3Big3())
+		if( first_size > second_size )
+		{
+			uint z1_size = result_size - first_size;
+			TTMATH_ASSERT( z1_size <= first_size*3 )
+
+			for(i=z1_size ; i<first_size*3 ; ++i)
+				TTMATH_ASSERT( z1.table[i] == 0 )
+				;
+
+			c = AddVector(result+first_size, z1.table, result_size-first_size, z1_size, result+first_size);
+			TTMATH_ASSERT(c==0)
+		}
+		else
+		{
+			c = AddVector(result+first_size, z1.table, result_size-first_size, first_size*3, result+first_size);
+			TTMATH_ASSERT(c==0)
+		}
+	}
+
+
+#ifdef _MSC_VER
+#pragma warning (default : 4717)
+#endif
+
+
+	/*!
+		an auxiliary method for calculating the Toom-3 squaring
+
+		result_size is equal ss_size*2
+	*/
+	template<uint ss_size>
+	void Sqr4Big2(const uint * ss, uint * result)
+	{
+		if( ss_size < TTMATH_USE_TOOM3_MULTIPLICATION_FROM_SIZE )
+			return Sqr3Big2<ss_size>(ss, result);
+
+		// the same as in Mul4Big2() - these parameters only stop the recurrence
+		const uint size = (ss_size < TTMATH_USE_TOOM3_MULTIPLICATION_FROM_SIZE) ? 5 : ss_size;
+
+		Sqr4Big3<(size+2)/3, size - (size+2)/3*2>(ss, result);
+	}
+
+
+
+#ifdef _MSC_VER
+#pragma warning (disable : 4717)
+//warning C4717: recursive on all control paths, function will cause runtime stack overflow
+//we have the stop point in Sqr4Big2() method
+#endif
+
+
+	/*!
+		an auxiliary method for calculating the Toom-3 squaring
+
+		the same as Mul4Big3() but the polynomial is evaluated only once
+		and the values in the negative points don't need their signs
+		(the squares are always positive)
+	*/
+	template<uint first_size, uint second_size>
+	void Sqr4Big3(const uint * ss, uint * result)
+	{
+	uint i;
+	bool xm1_sign, xm2_sign;
+
+		UInt<first_size+1> x1, xm1, xm2;
+		UInt<first_size*2+2> r1, rm1, rm2;
+
+		// r0 = r(0) and r4 = r(inf) we store directly in the result
+		Sqr4Big2<first_size>(ss, result);
+		Sqr4Big2<second_size>(ss + first_size*2, result + first_size*4);
+
+		for(i=first_size*2 ; i<first_size*4 ; ++i)
+			result[i] = 0;
+
+		Mul4_Evaluate<first_size, second_size>(ss, x1, xm1, xm2, xm1_sign, xm2_sign);
+
+		Sqr4Big2<first_size+1>(x1.table,  r1.table);   // r(1)
+		Sqr4Big2<first_size+1>(xm1.table, rm1.table);  // r(-1)
+		Sqr4Big2<first_size+1>(xm2.table, rm2.table);  // r(-2)
+
+		Mul4_Interpolate<first_size, second_size>(r1, rm1, rm2, result);
+	}
+
+
+#ifdef _MSC_VER
+#pragma warning (default : 4717)
+#endif
+
+
+	/*!
+		an auxiliary method for calculating the Toom-4 squaring
+
+		result_size is equal ss_size*2
+	*/
+	template<uint ss_size>
+	void Sqr5Big2(const uint * ss, uint * result)
+	{
+		if( ss_size < TTMATH_USE_TOOM4_MULTIPLICATION_FROM_SIZE )
+			return Sqr4Big2<ss_size>(ss, result);
+
+		// the same as in Mul5Big2() - these parameters only stop the recurrence
+		const uint size = (ss_size < TTMATH_USE_TOOM4_MULTIPLICATION_FROM_SIZE) ? 10 : ss_size;
+
+		Sqr5Big3<(size+3)/4, size - (size+3)/4*3>(ss, result);
+	}
+
+
+
+#ifdef _MSC_VER
+#pragma warning (disable : 4717)
+//warning C4717: recursive on all control paths, function will cause runtime stack overflow
+//we have the stop point in Sqr5Big2() method
+#endif
+
+
+	/*!
+		an auxiliary method for calculating the Toom-4 squaring
+
+		the same as Mul5Big3() but with one evaluation and five squarings
+	*/
+	template<uint first_size, uint second_size>
+	void Sqr5Big3(const uint * ss, uint * result)
+	{
+	uint i;
+	bool xm1_sign, xm2_sign;
+
+		UInt<first_size+1> x1, xm1, x2, xm2, xh;
+		UInt<first_size*2+2> v1, vm1, v2, vm2, vh;
+
+		// r0 = r(0) and r6 = r(inf) we store directly in the result
+		Sqr5Big2<first_size>(ss, result);
+		Sqr5Big2<second_size>(ss + first_size*3, result + first_size*6);
+
+		for(i=first_size*2 ; i<first_size*6 ; ++i)
+			result[i] = 0;
+
+		Mul5_Evaluate<first_size, second_size>(ss, x1, xm1, x2, xm2, xh, xm1_sign, xm2_sign);
+
+		Sqr5Big2<first_size+1>(x1.table,  v1.table);   // r(1)
+		Sqr5Big2<first_size+1>(xm1.table, vm1.table);  // r(-1)
+		Sqr5Big2<first_size+1>(x2.table,  v2.table);   // r(2)
+		Sqr5Big2<first_size+1>(xm2.table, vm2.table);  // r(-2)
+		Sqr5Big2<first_size+1>(xh.table,  vh.table);   // 2^6 * r(1/2)
+
+		Mul5_Interpolate<first_size, second_size>(v1, vm1, v2, vm2, vh, result);
+	}
+
+
+#ifdef _MSC_VER
+#pragma warning (default : 4717)
+#endif
+
+
+	/*!
+		squaring: result = this * this
+
+		this method is trying to select the fastest algorithm
+		(the same limits as in MulFastestBig() are used)
+	*/
+	void SqrFastestBig(UInt<value_size*2> & result)
+	{
+	#ifdef TTMATH_CONSTANT_TIME
+		return Sqr2Big2<value_size>(table, result);
+	#else
+
+		if( value_size < TTMATH_USE_KARATSUBA_MULTIPLICATION_FROM_SIZE )
+			return Sqr2Big2<value_size>(table, result);
+
+		uint xsize, xstart;
+
+		for(xsize=value_size ; xsize>0 && table[xsize-1]==0 ; --xsize);
+
+		if( xsize == 0 )
+		{
+			result.SetZero();
+			return;
+		}
+
+		for(xstart=0 ; xstart<xsize && table[xstart]==0 ; ++xstart);
+
+		uint distance = xsize - xstart;
+
+		if( distance < 3 )
+			return Sqr2Big3<value_size>(table, result, xstart, xsize);
+
+		if( value_size >= TTMATH_USE_NTT_MULTIPLICATION_FROM_SIZE &&
+			distance   >= TTMATH_USE_NTT_MULTIPLICATION_FROM_SIZE )
+			Mul6Big2<value_size>(table, table, result.table);
+		else
+		if( value_size >= TTMATH_USE_TOOM4_MULTIPLICATION_FROM_SIZE &&
+			distance   >= TTMATH_USE_TOOM4_MULTIPLICATION_FROM_SIZE )
+			Sqr5Big2<value_size>(table, result.table);
+		else
+		if( value_size >= TTMATH_USE_TOOM3_MULTIPLICATION_FROM_SIZE &&
+			distance   >= TTMATH_USE_TOOM3_MULTIPLICATION_FROM_SIZE )
+			Sqr4Big2<value_size>(table, result.table);
+		else
+			Sqr3Big2<value_size>(table, result.table);
+
+		TTMATH_LOG("UInt::SqrFastestBig")
+
+	#endif
+	}
+
+
+
+	/*!
+	 *
+	 * Division
+	 *
+	 *
+	*/
+	
+public:
+
+
+	/*!
+		division by one unsigned word
+
+		returns 1 when divisor is zero
+	*/
+	uint DivInt(uint divisor, uint * remainder = 0)
+	{
+		if( divisor == 0 )
+		{
+			if( remainder )
+				*remainder = 0; // this is for convenience, without it the compiler can report that 'remainder' is uninitialized
+
+			TTMATH_LOG("UInt::DivInt")
+
+		return 1;
+		}
+
+		if( divisor == 1 )
+		{
+			if( remainder )
+				*remainder = 0;
+
+			TTMATH_LOG("UInt::DivInt")
+
+		return 0;
+		}
+
+		uint size;
+
+		// we're looking for the last word in ss1
+		// (the higher words are zero and they will be zero in the quotient too)
+		for(size=value_size ; size>1 && table[size-1]==0 ; --size);
+
+		uint r = DivIntVector(table, size, divisor, table);
+
+		if( remainder )
+			*remainder = r;
+
+		TTMATH_LOG("UInt::DivInt")
+
+	return 0;
+	}
+
+	uint DivInt(uint divisor, uint & remainder)
+	{
+		return DivInt(divisor, &remainder);
+	}
+
+
+	/*!
+		division by one word: this = this / divisor
+		the divisor is prepared earlier (look at UIntDivisor)
+
+		(the definition is below the UIntDivisor class)
+	*/
+	uint DivInt(const UIntDivisor<1> & divisor, uint * remainder = 0);
+
+	uint DivInt(const UIntDivisor<1> & divisor, uint & remainder)
+	{
+		return DivInt(divisor, &remainder);
+	}
+
+
+
+	/*!
+		division this = this / ss2
+		
+		return values:
+			 0 - ok
+			 1 - division by zero
+			'this' will be the quotient
+			'remainder' - remainder
+
+		algorithm: 1 - 4 (Div1() - Div4()), 100 - means automatically choose the fastest algorithm
+	*/
+	uint Div(	const UInt<value_size> & divisor,
+				UInt<value_size> * remainder = 0,
+				uint algorithm = 100)
+	{
+		switch( algorithm )
+		{
+		case 1:
+			return Div1(divisor, remainder);
+
+		case 2:
+			return Div2(divisor, remainder);
+
+		case 3:
+			return Div3(divisor, remainder);
+
+		case 4:
+			return Div4(divisor, remainder);
+
+		case 100:
+		default:
+			return DivFastest(divisor, remainder);
+		}
+	}
+
+	uint Div(const UInt<value_size> & divisor, UInt<value_size> & remainder, uint algorithm = 100)
+	{
+		return Div(divisor, &remainder, algorithm);
+	}
+
+
+	/*!
+		division this = this / divisor
+
+		the divisor is prepared earlier (look at UIntDivisor) so
+		the normalization and the reciprocal are not calculated here
+		
+		return values:
+			 0 - ok
+			 1 - division by zero
+	*/
+	uint Div(const UIntDivisor<value_size> & divisor, UInt<value_size> * remainder = 0)
+	{
+	uint m, n, test;
+
+		test = Div_StandardTest(divisor.value, m, n, remainder);
+		if( test < 2 )
+			return test;
+
+		// for value_size == 1 the divisor has always one word
+		// (the rest is not instantiated for UInt<1>)
+		if( value_size < 2 || n == 0 )
+		{
+			uint r = Div_WordNormalized(divisor.normalized.table[0], divisor.bits, divisor.inverse);
+
+			if( remainder )
+			{
+				remainder->SetZero();
+				remainder->table[0] = r;
+			}
+		}
+		else
+		if( divisor.use_reciprocal && m - n >= TTMATH_USE_NEWTON_DIVISION_FROM_SIZE )
+		{
+			Div4_DivisionNormalized<(value_size+1)/2>(divisor.block, divisor.reciprocal, divisor.bits, n+1, remainder);
+		}
+		else
+		{
+			Div3_DivisionNormalized(divisor.normalized, remainder, m-n, n+1, divisor.bits, divisor.inverse);
+		}
+
+		TTMATH_LOG("UInt::Div(UIntDivisor)")
+
+	return 0;
+	}
+
+	uint Div(const UIntDivisor<value_size> & divisor, UInt<value_size> & remainder)
+	{
+		return Div(divisor, &remainder);
+	}
+
+
+
+private:
+
+	/*!
+		return values:
+		0 - none has to be done
+		1 - division by zero
+		2 - division should be made
+	*/
+	uint Div_StandardTest(	const UInt<value_size> & v,
+							uint & m, uint & n,
+							UInt<value_size> * remainder = 0)
+	{
+		switch( Div_CalculatingSize(v, m, n) )
+		{
+		case 4: // 'this' is equal v
+			if( remainder )
+				remainder->SetZero();
+
+			SetOne();
+			TTMATH_LOG("UInt::Div_StandardTest")
+			return 0;
+
+		case 3: // 'this' is smaller than v
+			if( remainder )
+				*remainder = *this;
+
+			SetZero();
+			TTMATH_LOG("UInt::Div_StandardTest")
+			return 0;
+
+		case 2: // 'this' is zero
+			if( remainder )
+				remainder->SetZero();
+
+			SetZero();
+			TTMATH_LOG("UInt::Div_StandardTest")
+			return 0;
+
+		case 1: // v is zero
+			TTMATH_LOG("UInt::Div_StandardTest")
+			return 1;
+		}
+
+		TTMATH_LOG("UInt::Div_StandardTest")
+
+	return 2;
+	}
+
+
+
+	/*!
+		return values:
+		0 - ok 
+			'm' - is the index (from 0) of last non-zero word in table ('this')
+			'n' - is the index (from 0) of last non-zero word in v.table
+		1 - v is zero 
+		2 - 'this' is zero
+		3 - 'this' is smaller than v
+		4 - 'this' is equal v
+
+		if the return value is different than zero the 'm' and 'n' are undefined
+	*/
+	uint Div_CalculatingSize(const UInt<value_size> & v, uint & m, uint & n)
+	{
+		for(n = value_size-1 ; n!=0 && v.table[n]==0 ; --n);
+
+		if( n==0 && v.table[n]==0 )
+			return 1;
+
+		for(m = value_size-1 ; m!=0 && table[m]==0 ; --m);
+
+		if( m==0 && table[m]==0 )
+			return 2;
+
+		if( m < n )
+			return 3;
+		else
+		if( m == n )
+		{
+			uint i;
 			for(i = n ; i!=0 && table[i]==v.table[i] ; --i);
 			
 			if( table[i] < v.table[i] )
@@ -1579,10 +3721,190 @@ private:
 				return 4;
 		}
 
-	return 0;
+	return 0;
+	}
+
+
+	/*!
+		it returns the reciprocal of a normalized word d (the highest bit is set)
+			floor((B^2 - 1) / d) - B
+
+		this reciprocal is used in the 2/1 and 3/2 division without the hardware division,
+		the algorithms are described in:
+			"Improved division by invariant integers"
+			Niels Moller, Torbjorn Granlund
+	*/
+	static uint Div_WordInverse(uint d)
+	{
+	uint v, rest;
+
+		TTMATH_ASSERT( (d >> (TTMATH_BITS_PER_UINT - 1)) == 1 )
+
+		// B^2 - 1 - d*B = (B - 1 - d)*B + (B - 1) and B - 1 - d is smaller than d
+		DivTwoWords(~d, TTMATH_UINT_MAX_VALUE, d, &v, &rest);
+
+	return v;
+	}
+
+
+	/*!
+		the 2/1 division: (u1,u0) / d
+		d is normalized, u1 is smaller than d and v is from Div_WordInverse(d)
+
+		it returns the quotient, the remainder is stored in 'rest'
+	*/
+	static uint Div_Word21(uint u1, uint u0, uint d, uint v, uint * rest)
+	{
+	uint q1, q0, r;
+
+		// (q1,q0) = v*u1 + (u1,u0)
+		MulTwoWords(v, u1, &q1, &q0);
+		q0 += u0;
+		q1 += u1 + 1 + ((q0 < u0) ? 1 : 0);
+
+		r = u0 - q1 * d;
+
+		if( r > q0 )
+		{
+			--q1;
+			r += d;
+		}
+
+		if( r >= d )
+		{
+			++q1;
+			r -= d;
+		}
+
+		*rest = r;
+
+	return q1;
+	}
+
+
+	/*!
+		it returns the reciprocal of the normalized two words (d1,d0)
+			floor((B^3 - 1) / (d1,d0)) - B
+		(the highest bit in d1 is set)
+	*/
+	static uint Div_Inverse32(uint d1, uint d0)
+	{
+	uint v, p, t1, t0;
+
+		v = Div_WordInverse(d1);
+		p = d1 * v + d0;
+
+		if( p < d0 )
+		{
+			--v;
+
+			if( p >= d1 )
+			{
+				--v;
+				p -= d1;
+			}
+
+			p -= d1;
+		}
+
+		MulTwoWords(v, d0, &t1, &t0);
+		p += t1;
+
+		if( p < t1 )
+		{
+			--v;
+
+			if( p > d1 || (p == d1 && t0 >= d0) )
+				--v;
+		}
+
+	return v;
+	}
+
+
+	/*!
+		the 3/2 division: (u2,u1,u0) / (d1,d0)
+		(d1,d0) is normalized, (u2,u1) is smaller than (d1,d0) and v is from Div_Inverse32()
+
+		it returns the quotient (one word), the remainder is stored in (r1,r0)
+	*/
+	static uint Div_Word32(uint u2, uint u1, uint u0, uint d1, uint d0, uint v, uint * r1, uint * r0)
+	{
+	uint q1, q0, t1, t0, c;
+
+		// (q1,q0) = v*u2 + (u2,u1)
+		MulTwoWords(v, u2, &q1, &q0);
+		q0 += u1;
+		q1 += u2 + ((q0 < u1) ? 1 : 0);
+
+		// (r1,r0) = (u1 - q1*d1, u0) - q1*d0 - (d1,d0)
+		*r1 = u1 - q1 * d1;
+		MulTwoWords(d0, q1, &t1, &t0);
+
+		c    = (u0 < t0) ? 1 : 0;
+		*r0  = u0 - t0;
+		*r1 -= t1 + c;
+
+		c    = (*r0 < d0) ? 1 : 0;
+		*r0 -= d0;
+		*r1 -= d1 + c;
+
+		++q1;
+
+		if( *r1 >= q0 )
+		{
+			--q1;
+			*r0 += d0;
+			*r1 += d1 + ((*r0 < d0) ? 1 : 0);
+		}
+
+		if( *r1 > d1 || (*r1 == d1 && *r0 >= d0) )
+		{
+			++q1;
+			c    = (*r0 < d0) ? 1 : 0;
+			*r0 -= d0;
+			*r1 -= d1 + c;
+		}
+
+	return q1;
+	}
+
+
+	/*!
+		division by one word: this = this / (d >> bits)
+		d is normalized (moved to the left by 'bits' bits) and inverse is from Div_WordInverse(d)
+
+		it returns the remainder
+	*/
+	uint Div_WordNormalized(uint d, uint bits, uint inverse)
+	{
+	sint i;
+	uint r = 0, u;
+
+		// we're looking for the last word
+		for(i=value_size-1 ; i>0 && table[i]==0 ; --i);
+
+		// we're dividing this*2^bits by d (the highest bits are the first remainder)
+		if( bits > 0 )
+			r = table[i] >> (TTMATH_BITS_PER_UINT - bits);
+
+		for( ; i>=0 ; --i)
+		{
+			u = table[i] << bits;
+
+			if( bits > 0 && i > 0 )
+				u |= table[i-1] >> (TTMATH_BITS_PER_UINT - bits);
+
+			table[i] = Div_Word21(r, u, d, inverse, &r);
+		}
+
+		TTMATH_LOG("UInt::Div_WordNormalized")
+
+	return r >> bits;
 	}
 
 
+
 public:
 
 	/*!
@@ -1681,7 +4003,7 @@ public:
 	{
 		TTMATH_REFERENCE_ASSERT( divisor )
 
-		uint bits_diff;
+		uint bits_diff = 0;
 		uint status = Div2_Calculate(divisor, remainder, bits_diff);
 		if( status < 2 )
 			return status;
@@ -1875,33 +4197,321 @@ private:
 			{
 				// divisor is equal 'this'
 
-				if( remainder )
-					remainder->SetZero();
+				if( remainder )
+					remainder->SetZero();
+
+				SetOne();
+
+				TTMATH_LOG("UInt::Div2_DivisorGreaterOrEqual")
+
+			return true;
+			}
+		}
+
+		TTMATH_LOG("UInt::Div2_DivisorGreaterOrEqual")
+
+	return false;
+	}
+
+
+public:
+
+	/*!
+		the third division algorithm
+
+		this algorithm is described in the following book:
+			"The art of computer programming 2" (4.3.1 page 272)
+			Donald E. Knuth 
+	*/
+	uint Div3(const UInt<value_size> & v, UInt<value_size> * remainder = 0)
+	{
+	TTMATH_REFERENCE_ASSERT( v )
+
+	uint m,n, test;
+
+		test = Div_StandardTest(v, m, n, remainder);
+		if( test < 2 )
+			return test;
+
+		// for value_size == 1 the divisor has always one word
+		// (the rest is not instantiated for UInt<1>)
+		if( value_size < 2 || n == 0 )
+		{
+			uint r;
+			DivInt( v.table[0], &r );
+
+			if( remainder )
+			{
+				remainder->SetZero();
+				remainder->table[0] = r;
+			}
+
+			TTMATH_LOG("UInt::Div3")
+
+		return 0;
+		}
+
+
+		// we can only use the third division algorithm when 
+		// the divisor is greater or equal 2^32 (has more than one 32-bit word)
+		++m;
+		++n;
+		m = m - n; 
+		Div3_Division(v, remainder, m, n);
+
+		TTMATH_LOG("UInt::Div3")
+
+	return 0;
+	}
+
+
+
+private:
+
+
+	void Div3_Division(UInt<value_size> v, UInt<value_size> * remainder, uint m, uint n)
+	{
+	TTMATH_ASSERT( n>=2 )
+
+	uint d, inverse;
+
+		d       = Div3_NormalizeDivisor(v, n);
+		inverse = Div_Inverse32(v.table[n-1], v.table[n-2]);
+
+		Div3_DivisionNormalized(v, remainder, m, n, d, inverse);
+
+		TTMATH_LOG("UInt::Div3_Division")
+	}
+
+
+	/*!
+		the main loop of the third division algorithm
+
+		v is already normalized (moved to the left by d bits) and
+		inverse is the reciprocal of its two highest words (from Div_Inverse32())
+	*/
+	void Div3_DivisionNormalized(const UInt<value_size> & v, UInt<value_size> * remainder,
+								 uint m, uint n, uint d, uint inverse)
+	{
+	TTMATH_ASSERT( n>=2 )
+
+	UInt<value_size+1> uu, vv;
+	UInt<value_size> q;
+	uint u_value_size, u0, u1, u2, v1, v0, j=m;	
+	
+		u_value_size = Div3_NormalizeDividend(d);
+
+		if( j+n == value_size )
+			u2 = u_value_size;
+		else
+			u2 = table[j+n];
+
+		Div3_MakeBiggerV(v, vv);
+
+		for(uint i = j+1 ; i<value_size ; ++i)
+			q.table[i] = 0;
+
+		while( true )
+		{
+			u1 = table[j+n-1];
+			u0 = table[j+n-2];
+			v1 = v.table[n-1];
+			v0 = v.table[n-2];
+
+			uint qp = Div3_Calculate(u2,u1,u0, v1,v0, inverse);
+
+			Div3_MakeNewU(uu, j, n, u2);
+			Div3_MultiplySubtract(uu, vv, qp, n);
+			Div3_CopyNewU(uu, j, n);
+
+			q.table[j] = qp;
+
+			// the next loop
+			if( j-- == 0 )
+				break;
+
+			u2 = table[j+n];
+		}
+
+		if( remainder )
+			Div3_Unnormalize(remainder, n, d);
+
+	*this = q;
+
+	TTMATH_LOG("UInt::Div3_DivisionNormalized")
+	}
+
+
+	void Div3_MakeNewU(UInt<value_size+1> & uu, uint j, uint n, uint u_max)
+	{
+	uint i;
+
+		for(i=0 ; i<n ; ++i, ++j)
+			uu.table[i] = table[j];
+
+		// 'n' is from <1..value_size> so and 'i' is from <0..value_size>
+		// then table[i] is always correct (look at the declaration of 'uu')
+		// (the rest of 'uu' is not used by Div3_MultiplySubtract())
+		uu.table[i] = u_max;
+
+		TTMATH_LOG("UInt::Div3_MakeNewU")
+	}
+
+
+	void Div3_CopyNewU(const UInt<value_size+1> & uu, uint j, uint n)
+	{
+	uint i;
+
+		for(i=0 ; i<n ; ++i)
+			table[i+j] = uu.table[i];
+
+		if( i+j < value_size )
+			table[i+j] = uu.table[i];
+
+		TTMATH_LOG("UInt::Div3_CopyNewU")
+	}
+
+
+	/*!
+		we're making the new 'vv' 
+		the value is actually the same but the 'table' is bigger (value_size+1)
+	*/
+	void Div3_MakeBiggerV(const UInt<value_size> & v, UInt<value_size+1> & vv)
+	{
+		for(uint i=0 ; i<value_size ; ++i)
+			vv.table[i] = v.table[i];
+
+		vv.table[value_size] = 0;
+
+		TTMATH_LOG("UInt::Div3_MakeBiggerV")
+	}
+	
+
+	/*!
+		we're moving all bits from 'v' into the left side of the n-1 word
+		(the highest bit at v.table[n-1] will be equal one)
+
+		it returns how many times we've moved
+	*/
+	static uint Div3_NormalizeDivisor(UInt<value_size> & v, uint n)
+	{
+		// v.table[n-1] is != 0
+
+		uint bit  = (uint)FindLeadingBitInWord(v.table[n-1]);
+		uint move = (TTMATH_BITS_PER_UINT - bit - 1);
+
+		if( move > 0 )
+			v.Rcl(move, 0);
+
+	return move;
+	}
+
+
+	/*!
+		the bits from 'this' we're moving the same times as the divisor (move)
+
+		it returns the next-left value from 'this' (that after table[value_size-1])
+	*/
+	uint Div3_NormalizeDividend(uint move)
+	{
+	uint res = 0;
+
+		if( move > 0 )
+		{
+			res = table[value_size-1] >> (TTMATH_BITS_PER_UINT - move);
+			Rcl(move, 0);
+		}
+
+		TTMATH_LOG("UInt::Div3_NormalizeDividend")
+
+	return res;
+	}
+
+
+	void Div3_Unnormalize(UInt<value_size> * remainder, uint n, uint d)
+	{
+		for(uint i=n ; i<value_size ; ++i)
+			table[i] = 0;
+
+		Rcr(d,0);
+
+		*remainder = *this;
+
+		TTMATH_LOG("UInt::Div3_Unnormalize")
+	}
+
+
+	/*!
+		it calculates the quotient of (u2,u1,u0) / (v1,v0) (the estimated digit from
+		the step D3 in the book) - but instead of the hardware division we're using
+		the reciprocal of (v1,v0) from Div_Inverse32()
+
+		(u2,u1) is not greater than (v1,v0), if it's equal the result is B-1
+	*/
+	static uint Div3_Calculate(uint u2, uint u1, uint u0, uint v1, uint v0, uint inverse)
+	{
+	uint r1, r0;
+
+		if( u2 == v1 && u1 == v0 )
+			return TTMATH_UINT_MAX_VALUE;
+
+	return Div_Word32(u2, u1, u0, v1, v0, inverse, &r1, &r0);
+	}
+
+
+
+	/*!
+		uu = uu - vv * qp
+
+		only the first n+1 words are used (vv has n words and uu has n+1 words)
+		so the cost of one step doesn't depend on value_size
+	*/
+	void Div3_MultiplySubtract(	UInt<value_size+1> & uu,
+								const UInt<value_size+1> & vv, uint & qp, uint n)
+	{
+		// D4 (in the book)
+
+		// here will never be a carry from the high words (qp*v < B^2 - B)
+		uint c      = MulSubVector(vv.table, qp, n, uu.table);
+		uint borrow = (uu.table[n] < c) ? 1 : 0;
+		uu.table[n] -= c;
 
-				SetOne();
+		if( borrow )
+		{
+			// there was a carry
+			
+			//
+			// !!! this part of code was not tested
+			//
 
-				TTMATH_LOG("UInt::Div2_DivisorGreaterOrEqual")
+			--qp;
+			AddVector(uu.table, vv.table, n+1, n+1, uu.table);
 
-			return true;
-			}
+			// can be a carry from this additions but it should be ignored 
+			// because it cancels with the borrow from MulSubVector()
 		}
 
-		TTMATH_LOG("UInt::Div2_DivisorGreaterOrEqual")
-
-	return false;
+		TTMATH_LOG("UInt::Div3_MultiplySubtract")
 	}
 
 
 public:
 
+
 	/*!
-		the third division algorithm
+		the fourth division algorithm
+
+		the divisor is normalized to a block of k words (k is value_size/2 or value_size),
+		its reciprocal is calculated by using the Newton's method (the precision is doubled
+		in each step) and then the dividend is divided by blocks of k words, each block
+		needs only two multiplications so this algorithm benefits from the fast
+		multiplication (Karatsuba, Toom-Cook, NTT)
 
 		this algorithm is described in the following book:
-			"The art of computer programming 2" (4.3.1 page 272)
-			Donald E. Knuth 
+			"Modern Computer Arithmetic" (2.5 and 3.4)
+			Richard Brent, Paul Zimmermann
 	*/
-	uint Div3(const UInt<value_size> & v, UInt<value_size> * remainder = 0)
+	uint Div4(const UInt<value_size> & v, UInt<value_size> * remainder = 0)
 	{
 	TTMATH_REFERENCE_ASSERT( v )
 
@@ -1922,22 +4532,48 @@ public:
 				remainder->table[0] = r;
 			}
 
-			TTMATH_LOG("UInt::Div3")
+			TTMATH_LOG("UInt::Div4")
 
 		return 0;
 		}
 
+		// n is the index of the last non-zero word in v
+		if( n < (value_size+1)/2 )
+			Div4_Division<(value_size+1)/2>(v, remainder, n+1);
+		else
+			Div4_Division<value_size>(v, remainder, n+1);
+
+		TTMATH_LOG("UInt::Div4")
 
-		// we can only use the third division algorithm when 
-		// the divisor is greater or equal 2^32 (has more than one 32-bit word)
+	return 0;
+	}
+
+
+	/*!
+		division this = this / divisor
+
+		this method is trying to select the fastest algorithm
+		(either Div3() or Div4())
+	*/
+	uint DivFastest(const UInt<value_size> & divisor, UInt<value_size> * remainder = 0)
+	{
+	uint m, n;
+
+		if( value_size < TTMATH_USE_NEWTON_DIVISION_FROM_SIZE*2 || Div_CalculatingSize(divisor, m, n) != 0 )
+			return Div3(divisor, remainder);
+
+		// m and n are the numbers of words in 'this' and the divisor,
+		// Div4() is used only when the divisor fits well in the half of value_size
+		// (the reciprocal is calculated for (value_size+1)/2 words)
+		// and the quotient is big enough too
 		++m;
 		++n;
-		m = m - n; 
-		Div3_Division(v, remainder, m, n);
 
-		TTMATH_LOG("UInt::Div3")
+		if( n >= TTMATH_USE_NEWTON_DIVISION_FROM_SIZE && m - n >= TTMATH_USE_NEWTON_DIVISION_FROM_SIZE &&
+			n <= (value_size+1)/2 && n*4 > value_size )
+			return Div4(divisor, remainder);
 
-	return 0;
+	return Div3(divisor, remainder);
 	}
 
 
@@ -1945,278 +4581,440 @@ public:
 private:
 
 
-	void Div3_Division(UInt<value_size> v, UInt<value_size> * remainder, uint m, uint n)
+	/*!
+		an auxiliary method for the fourth division algorithm
+
+		vsize is the number of words in v (at least two and not greater than k)
+	*/
+	template<uint k>
+	void Div4_Division(const UInt<value_size> & v, UInt<value_size> * remainder, uint vsize)
 	{
-	TTMATH_ASSERT( n>=2 )
+	UInt<k> d, x;
+	uint bits;
 
-	UInt<value_size+1> uu, vv;
-	UInt<value_size> q;
-	uint d, u_value_size, u0, u1, u2, v1, v0, j=m;	
-	
-		u_value_size = Div3_Normalize(v, n, d);
+		bits = Div4_Normalize<k>(v, vsize, d);
+		Div4_Reciprocal<k>(d.table, x.table);
+		Div4_DivisionNormalized<k>(d, x, bits, vsize, remainder);
+	}
 
-		if( j+n == value_size )
-			u2 = u_value_size;
-		else
-			u2 = table[j+n];
 
-		Div3_MakeBiggerV(v, vv);
+	/*!
+		an auxiliary method for the fourth division algorithm
 
-		for(uint i = j+1 ; i<value_size ; ++i)
-			q.table[i] = 0;
+		d = v * B^(k-vsize) * 2^bits - the highest bit in d is set,
+		it returns 'bits'
+	*/
+	template<uint k>
+	static uint Div4_Normalize(const UInt<value_size> & v, uint vsize, UInt<k> & d)
+	{
+	uint i, bits;
 
-		while( true )
-		{
-			u1 = table[j+n-1];
-			u0 = table[j+n-2];
-			v1 = v.table[n-1];
-			v0 = v.table[n-2];
+		TTMATH_ASSERT( vsize >= 2 && vsize <= k )
 
-			uint qp = Div3_Calculate(u2,u1,u0, v1,v0);
+		bits = TTMATH_BITS_PER_UINT - 1 - uint(FindLeadingBitInWord(v.table[vsize-1]));
 
-			Div3_MakeNewU(uu, j, n, u2);
-			Div3_MultiplySubtract(uu, vv, qp);
-			Div3_CopyNewU(uu, j, n);
+		for(i=0 ; i<k-vsize ; ++i)
+			d.table[i] = 0;
 
-			q.table[j] = qp;
+		for(i=0 ; i<vsize ; ++i)
+			d.table[i+k-vsize] = v.table[i];
 
-			// the next loop
-			if( j-- == 0 )
-				break;
+		d.Rcl(bits, 0);
 
-			u2 = table[j+n];
-		}
+	return bits;
+	}
 
-		if( remainder )
-			Div3_Unnormalize(remainder, n, d);
 
-	*this = q;
+	/*!
+		an auxiliary method for the fourth division algorithm
 
-	TTMATH_LOG("UInt::Div3_Division")
-	}
+		d is the normalized divisor (from Div4_Normalize()) and x is its reciprocal,
+		vsize is the number of words in the divisor before the normalization
+	*/
+	template<uint k>
+	void Div4_DivisionNormalized(const UInt<k> & d, const UInt<k> & x, uint bits, uint vsize, UInt<value_size> * remainder)
+	{
+	const uint a_size = (value_size/k + 2) * k;
+	UInt<k> q, r;
+	UInt<k*2> u;
+	uint a[a_size];
+	uint i, b;
 
+		// a = this * B^(k-vsize) * 2^bits - the quotient a/d is the same as this/v
+		for(i=0 ; i<a_size ; ++i)
+			a[i] = 0;
 
-	void Div3_MakeNewU(UInt<value_size+1> & uu, uint j, uint n, uint u_max)
-	{
-	uint i;
+		for(i=0 ; i<value_size ; ++i)
+			a[i+k-vsize] = table[i];
 
-		for(i=0 ; i<n ; ++i, ++j)
-			uu.table[i] = table[j];
+		if( bits > 0 )
+		{
+			for(i=a_size-1 ; i>0 ; --i)
+				a[i] = (a[i] << bits) | (a[i-1] >> (TTMATH_BITS_PER_UINT - bits));
 
-		// 'n' is from <1..value_size> so and 'i' is from <0..value_size>
-		// then table[i] is always correct (look at the declaration of 'uu')
-		uu.table[i] = u_max;
+			a[0] <<= bits;
+		}
 
-		for( ++i ; i<value_size+1 ; ++i)
-			uu.table[i] = 0;
+		// the schoolbook division where one digit has k words
+		// (r is always smaller than d)
+		r.SetZero();
 
-		TTMATH_LOG("UInt::Div3_MakeNewU")
-	}
+		for(b=a_size/k ; b-- > 0 ; )
+		{
+			for(i=0 ; i<k ; ++i)
+			{
+				u.table[i]   = a[b*k + i];
+				u.table[i+k] = r.table[i];
+			}
 
+			Div4_Block<k>(u, d, x, q, r);
 
-	void Div3_CopyNewU(const UInt<value_size+1> & uu, uint j, uint n)
-	{
-	uint i;
+			for(i=0 ; i<k ; ++i)
+			{
+				if( b*k + i < value_size )
+					table[b*k + i] = q.table[i];
+				else
+					TTMATH_ASSERT( q.table[i] == 0 )
+					;
+			}
+		}
 
-		for(i=0 ; i<n ; ++i)
-			table[i+j] = uu.table[i];
+		if( remainder )
+		{
+			r.Rcr(bits, 0);
 
-		if( i+j < value_size )
-			table[i+j] = uu.table[i];
+			for(i=0 ; i<vsize ; ++i)
+				remainder->table[i] = r.table[i+k-vsize];
 
-		TTMATH_LOG("UInt::Div3_CopyNewU")
+			for( ; i<value_size ; ++i)
+				remainder->table[i] = 0;
+		}
 	}
 
 
 	/*!
-		we're making the new 'vv' 
-		the value is actually the same but the 'table' is bigger (value_size+1)
+		an auxiliary method for the fourth division algorithm
+
+		it divides u by d (q - quotient, r - remainder)
+		d is normalized (the highest bit is set), x is its reciprocal (from Div4_Reciprocal())
+		and u is smaller than d*B^k (the quotient has k words)
 	*/
-	void Div3_MakeBiggerV(const UInt<value_size> & v, UInt<value_size+1> & vv)
+	template<uint k>
+	static void Div4_Block(const UInt<k*2> & u, const UInt<k> & d, const UInt<k> & x, UInt<k> & q, UInt<k> & r)
 	{
-		for(uint i=0 ; i<value_size ; ++i)
-			vv.table[i] = v.table[i];
+	UInt<k> uh;
+	UInt<k*2> p, dd;
+	uint i, c;
 
-		vv.table[value_size] = 0;
+		for(i=0 ; i<k ; ++i)
+			uh.table[i] = u.table[i+k];
 
-		TTMATH_LOG("UInt::Div3_MakeBiggerV")
+		if( uh.IsZero() )
+		{
+			// u is smaller than B^k and d is normalized so the quotient is 0 or 1
+			for(i=0 ; i<k ; ++i)
+				r.table[i] = u.table[i];
+
+			q.SetZero();
+
+			if( !r.CmpSmaller(d) )
+			{
+				r.Sub(d);
+				q.table[0] = 1;
+			}
+
+		return;
+		}
+
+		// q = uh + floor(uh*x / B^k) - it's not greater than the real quotient
+		uh.MulFastestBig(x, p);
+		c = AddVector(p.table+k, uh.table, k, k, q.table);
+		TTMATH_ASSERT( c==0 )
+
+		// p = u - q*d
+		q.MulFastestBig(d, dd);
+		c = SubVector(u.table, dd.table, k*2, k*2, p.table);
+		TTMATH_ASSERT( c==0 )
+
+		// the estimated quotient can be too small only by a few units
+		for(i=0 ; i<k ; ++i)
+		{
+			dd.table[i]   = d.table[i];
+			dd.table[i+k] = 0;
+		}
+
+		while( !p.CmpSmaller(dd, k) )
+		{
+			p.Sub(dd);
+			q.AddOne();
+		}
+
+		for(i=0 ; i<k ; ++i)
+			r.table[i] = p.table[i];
 	}
-	
+
+
+#ifdef _MSC_VER
+#pragma warning (disable : 4717)
+//warning C4717: recursive on all control paths, function will cause runtime stack overflow
+//we have the stop point (n <= 2) in Div4_Reciprocal() method
+#endif
+
 
 	/*!
-		we're moving all bits from 'v' into the left side of the n-1 word
-		(the highest bit at v.table[n-1] will be equal one,
-		the bits from 'this' we're moving the same times as 'v')
+		an auxiliary method for the fourth division algorithm
 
-		return values:
-		  d - how many times we've moved
-		  return - the next-left value from 'this' (that after table[value_size-1])
+		it calculates the reciprocal of a normalized value A (n words, the highest bit is set):
+			A * (B^n + x) < B^(2n) <= A * (B^n + x + 2)
+		x has n words (the leading B^n is not stored)
+
+		this is the ApproximateReciprocal algorithm from "Modern Computer Arithmetic" (3.5):
+		the reciprocal Xh of the highest h words of A is calculated recursively and
+		then one Newton's step is made: X = Xh*B^l + Xh*(B^(n+h) - A*Xh) / B^(2h)
 	*/
-	uint Div3_Normalize(UInt<value_size> & v, uint n, uint & d)
+	template<uint n>
+	static void Div4_Reciprocal(const uint * a, uint * x)
 	{
-		// v.table[n-1] is != 0
+	const uint l = (n - 1) / 2;
+	const uint h = n - l;
+	UInt<n> aa, xx;
+	UInt<n*2> t;
+	UInt<h+1> tm, xh;
+	UInt<h*2+2> uu;
+	uint i, c;
+
+		if( n <= 2 )
+		{
+			// x = ceil(B^(2n) / A) - 1 - B^n = floor((B^(2n) - 1) / A) - B^n
+			UInt<n*2> q, dd;
 
-		uint bit  = (uint)FindLeadingBitInWord(v.table[n-1]);
-		uint move = (TTMATH_BITS_PER_UINT - bit - 1);
-		uint res  = table[value_size-1];
-		d         = move;
+			q.SetMax();
 
-		if( move > 0 )
-		{
-			v.Rcl(move, 0);
-			Rcl(move, 0);
-			res = res >> (bit + 1);
+			for(i=0 ; i<n ; ++i)
+			{
+				dd.table[i]   = a[i];
+				dd.table[i+n] = 0;
+			}
+
+			q.Div3(dd);
+			TTMATH_ASSERT( q.table[n] == 1 )
+
+			for(i=0 ; i<n ; ++i)
+				x[i] = q.table[i];
+
+		return;
 		}
-		else
+
+		// Xh = B^h + xh
+		Div4_Reciprocal<h>(a + l, xh.table);
+		xh.table[h] = 1;
+
+		// t = A * Xh
+		for(i=0 ; i<n ; ++i)
+			aa.table[i] = a[i];
+
+		for(i=0 ; i<=h ; ++i)
+			xx.table[i] = xh.table[i];
+
+		for( ; i<n ; ++i)
+			xx.table[i] = 0;
+
+		aa.MulFastestBig(xx, t);
+
+		// while t >= B^(n+h) then Xh = Xh - 1 and t = t - A
+		while( !Div4_IsZero(t.table + n + h, n - h) )
 		{
-			res = 0;
+			xh.SubOne();
+			SubVector(t.table, aa.table, n*2, n, t.table);
 		}
 
-		TTMATH_LOG("UInt::Div3_Normalize")
+		// t = B^(n+h) - t  (t is smaller than 2A now)
+		for(i=0 ; i<n+h ; ++i)
+			t.table[i] = ~t.table[i];
 
-	return res;
+		for(i=0 ; i<n+h && ++t.table[i]==0 ; ++i);
+
+		// tm = floor(t / B^l), uu = tm * Xh
+		for(i=0 ; i<=h ; ++i)
+			tm.table[i] = t.table[i+l];
+
+		tm.MulFastestBig(xh, uu);
+
+		// x = xh * B^l + floor(uu / B^(2h-l))
+		for(i=0 ; i<l ; ++i)
+			x[i] = 0;
+
+		for(i=0 ; i<h ; ++i)
+			x[i+l] = xh.table[i];
+
+		c = AddVector(x, uu.table + h*2 - l, n, l+2, x);
+		TTMATH_ASSERT( c==0 )
 	}
 
 
-	void Div3_Unnormalize(UInt<value_size> * remainder, uint n, uint d)
-	{
-		for(uint i=n ; i<value_size ; ++i)
-			table[i] = 0;
+#ifdef _MSC_VER
+#pragma warning (default : 4717)
+#endif
 
-		Rcr(d,0);
 
-		*remainder = *this;
+	/*!
+		an auxiliary method for the fourth division algorithm
 
-		TTMATH_LOG("UInt::Div3_Unnormalize")
+		it returns true if all 'size' words are zero
+	*/
+	static bool Div4_IsZero(const uint * x, uint size)
+	{
+		for(uint i=0 ; i<size ; ++i)
+			if( x[i] != 0 )
+				return false;
+
+	return true;
 	}
 
 
-	uint Div3_Calculate(uint u2, uint u1, uint u0, uint v1, uint v0)
-	{	
-	UInt<2> u_temp;
-	uint rp;
-	bool next_test;
 
-		TTMATH_ASSERT( v1 != 0 )
 
-		u_temp.table[1] = u2;
-		u_temp.table[0] = u1;
-		u_temp.DivInt(v1, &rp);
 
-		TTMATH_ASSERT( u_temp.table[1]==0 || u_temp.table[1]==1 )
 
-		do
-		{
-			bool decrease = false;
 
-			if( u_temp.table[1] == 1 )
-				decrease = true;
-			else
-			{
-				UInt<2> temp1, temp2;
+public:
 
-				UInt<2>::MulTwoWords(u_temp.table[0], v0, temp1.table+1, temp1.table);
-				temp2.table[1] = rp;
-				temp2.table[0] = u0;
 
-				if( temp1 > temp2 )
-					decrease = true;
-			}
+	/*!
+		power this = this ^ pow
+		binary algorithm (r-to-l)
 
-			next_test = false;
+		return values:
+		0 - ok
+		1 - carry or
+		2 - incorrect argument (0^0)
+	*/
+	uint Pow(UInt<value_size> pow)
+	{
+		if(pow.IsZero() && IsZero())
+			// we don't define zero^zero
+			return 2;
 
-			if( decrease )
-			{
-				u_temp.SubOne();
+		UInt<value_size> start(*this);
+		UInt<value_size> result;
+		result.SetOne();
+		uint c = 0;
+		
+		while( !c )
+		{
+			if( pow.table[0] & 1 )
+				c += result.Mul(start);
 
-				rp += v1;
+			pow.Rcr2_one(0);
+			if( pow.IsZero() )
+				break;
 
-				if( rp >= v1 ) // it means that there wasn't a carry (r<b from the book)
-					next_test = true;
-			}
+			c += start.Sqr();
 		}
-		while( next_test );
 
-		TTMATH_LOG("UInt::Div3_Calculate")
+		*this = result;
+
+		TTMATH_LOG("UInt::Pow(UInt<>)")
 
-	return u_temp.table[0];
+	return (c==0)? 0 : 1;
 	}
 
 
+private:
+
 
-	void Div3_MultiplySubtract(	UInt<value_size+1> & uu,
-								const UInt<value_size+1> & vv, uint & qp)
+	/*!
+		an auxiliary method for Sqrt()
+
+		it returns floor( sqrt(x) ) for one word (the Newton's method
+		starting from a power of two which is greater than the root)
+	*/
+	static uint SqrtWord(uint x)
 	{
-		// D4 (in the book)
+	uint root, next;
 
-		UInt<value_size+1> vv_temp(vv);
-		vv_temp.MulInt(qp);
+		if( x < 2 )
+			return x;
 
-		if( uu.Sub(vv_temp) )  
+		// x has 'bit+1' bits so 2^((bit+2)/2) is greater than sqrt(x)
+		sint bit = FindLeadingBitInWord(x);
+		root     = uint(1) << ((bit+2) / 2);
+
+		while( true )
 		{
-			// there was a carry
-			
-			//
-			// !!! this part of code was not tested
-			//
+			next = (root + x / root) / 2;
 
-			--qp;
-			uu.Add(vv);
+			if( next >= root )
+				break;
 
-			// can be a carry from this additions but it should be ignored 
-			// because it cancels with the borrow from uu.Sub(vv_temp)
+			root = next;
 		}
 
-		TTMATH_LOG("UInt::Div3_MultiplySubtract")
+	return root;
 	}
 
 
+public:
 
 
+	/*!
+		square root
+		this = floor( sqrt(this) ), e.g. Sqrt(10) = 3
+
+		we're using the Newton's method:
+			x(k+1) = ( x(k) + this / x(k) ) / 2
+		the first value is calculated from the highest word (about TTMATH_BITS_PER_UINT/2
+		bits are correct and the value is greater than the root), the next values
+		are decreasing and we stop when the value doesn't go down,
+		each step doubles the number of correct bits
+	*/
+	void Sqrt()
+	{
+	uint table_id, index;
 
+		if( !FindLeadingBit(table_id, index) )
+		{
+			// sqrt(0) = 0
+			TTMATH_LOG("UInt::Sqrt")
+			return;
+		}
 
-public:
+		uint bits = table_id * TTMATH_BITS_PER_UINT + index + 1;
 
+		if( bits <= TTMATH_BITS_PER_UINT )
+		{
+			table[0] = SqrtWord(table[0]);
+			TTMATH_LOG("UInt::Sqrt")
+			return;
+		}
 
-	/*!
-		power this = this ^ pow
-		binary algorithm (r-to-l)
+		// 'shift' is even and the highest 'bits-shift' bits fit in one word,
+		// root = (sqrt(highest bits) + 1) * 2^(shift/2) is greater than sqrt(this)
+		uint shift = (bits - TTMATH_BITS_PER_UINT + 1) & ~uint(1);
+		UInt<value_size> root(*this), next;
 
-		return values:
-		0 - ok
-		1 - carry or
-		2 - incorrect argument (0^0)
-	*/
-	uint Pow(UInt<value_size> pow)
-	{
-		if(pow.IsZero() && IsZero())
-			// we don't define zero^zero
-			return 2;
+		root.Rcr(shift);
+		uint first = SqrtWord(root.table[0]) + 1;
+		root.SetZero();
+		root.table[0] = first;
+		root.Rcl(shift / 2);
 
-		UInt<value_size> start(*this), start_temp;
-		UInt<value_size> result;
-		result.SetOne();
-		uint c = 0;
-		
-		while( !c )
+		while( true )
 		{
-			if( pow.table[0] & 1 )
-				c += result.Mul(start);
+			next = *this;
+			next.Div(root);
+			uint c = next.Add(root);
+			next.Rcr(1, c);
 
-			pow.Rcr2_one(0);
-			if( pow.IsZero() )
+			if( next >= root )
 				break;
 
-			start_temp = start;
-			// in the second Mul algorithm we can use start.Mul(start) directly (there is no TTMATH_ASSERT_REFERENCE there)
-			c += start.Mul(start_temp);
+			root = next;
 		}
 
-		*this = result;
-
-		TTMATH_LOG("UInt::Pow(UInt<>)")
+		*this = root;
 
-	return (c==0)? 0 : 1;
+		TTMATH_LOG("UInt::Sqrt")
 	}
 
 
@@ -2286,11 +5084,24 @@ public:
 	*/
 	bool IsZero() const
 	{
+	#ifdef TTMATH_CONSTANT_TIME
+
+		uint x = 0;
+
+		for(uint i=0 ; i<value_size ; ++i)
+			x |= table[i];
+
+		return ConstantTime_IsZero(x) == 1;
+
+	#else
+
 		for(uint i=0 ; i<value_size ; ++i)
 			if(table[i] != 0)
 				return false;
 
 	return true;
+
+	#endif
 	}
 
 
@@ -2699,9 +5510,15 @@ public:
 		if( b<2 || b>16 )
 			return;
 
+		// the divisor is normalized only once and its reciprocal is calculated
+		// only once too (look at UIntDivisor)
+		uint bits    = TTMATH_BITS_PER_UINT - 1 - FindLeadingBitInWord(b);
+		uint d       = b << bits;
+		uint inverse = Div_WordInverse(d);
+
 		do
 		{
-			temp.DivInt(b, &rem);
+			rem = temp.Div_WordNormalized(d, bits, inverse);
 			character = static_cast<char>( DigitToChar(rem) );
 			result.insert(result.begin(), character);
 		}
@@ -2825,37 +5642,132 @@ public:
 
 	/*!
 	*
-	*	methods for comparing
+	*	auxiliary methods for the constant-time mode (TTMATH_CONSTANT_TIME)
 	*
 	*/
 
 
 	/*!
-		this method returns true if 'this' is smaller than 'l'
+		this method returns 1 if a < b (and zero otherwise)
+		without any branches (the borrow from a-b is calculated)
+	*/
+	static uint ConstantTime_Smaller(uint a, uint b)
+	{
+		return ((~a & b) | ((~a | b) & (a - b))) >> (TTMATH_BITS_PER_UINT - 1);
+	}
 
-		'index' is an index of the first word from will be the comparison performed
-		(note: we start the comparison from back - from the last word, when index is -1 /default/
-		it is automatically set into the last word)
-		I introduced it for some kind of optimization made in the second division algorithm (Div2)
+
+	/*!
+		this method returns 1 if x is zero (and zero otherwise)
+		without any branches
 	*/
-	bool CmpSmaller(const UInt<value_size> & l, sint index = -1) const
+	static uint ConstantTime_IsZero(uint x)
+	{
+		return ((x | (0 - x)) >> (TTMATH_BITS_PER_UINT - 1)) ^ 1;
+	}
+
+
+	/*!
+		this method returns a mask: all bits set if c is one, zero if c is zero
+	*/
+	static uint ConstantTime_Mask(uint c)
+	{
+		return 0 - c;
+	}
+
+
+	/*!
+		this method selects 'a' (if mask has all bits set) or 'b' (if mask is zero)
+		and puts it into 'this', the time doesn't depend on the mask
+	*/
+	void ConstantTime_Select(const UInt<value_size> & a, const UInt<value_size> & b, uint mask)
+	{
+		for(uint i=0 ; i<value_size ; ++i)
+			table[i] = (a.table[i] & mask) | (b.table[i] & ~mask);
+	}
+
+
+private:
+
+
+	/*!
+		comparing without an early exit (used in the constant-time mode)
+
+		'smaller' will be 1 if 'this' is smaller than 'l', 'bigger' will be 1
+		if 'this' is bigger than 'l' (both are zero if the values are equal),
+		'index' has the same meaning as in CmpSmaller()
+	*/
+	void ConstantTime_Cmp(const UInt<value_size> & l, sint index, uint & smaller, uint & bigger) const
 	{
 	sint i;
+	uint lt, gt, decided = 0;
 
 		if( index==-1 || index>=sint(value_size) )
 			i = value_size - 1;
 		else
 			i = index;
 
+		smaller = 0;
+		bigger  = 0;
 
 		for( ; i>=0 ; --i)
 		{
-			if( table[i] != l.table[i] )
-				return table[i] < l.table[i];
+			lt = ConstantTime_Smaller(table[i], l.table[i]);
+			gt = ConstantTime_Smaller(l.table[i], table[i]);
+
+			// only the first (the highest) different word is taken into account
+			smaller |= lt & (decided ^ 1);
+			bigger  |= gt & (decided ^ 1);
+			decided |= lt | gt;
 		}
+	}
 
-	// they're equal
-	return false;
+
+	/*!
+		the number of words compared by CmpSmaller() and others
+		('index' is the index of the first word to compare, -1 means the last word)
+	*/
+	uint CmpSize(sint index) const
+	{
+		if( index==-1 || index>=sint(value_size) )
+			return value_size;
+
+	return uint(index) + 1;
+	}
+
+
+public:
+
+
+	/*!
+	*
+	*	methods for comparing
+	*
+	*/
+
+
+	/*!
+		this method returns true if 'this' is smaller than 'l'
+
+		'index' is an index of the first word from will be the comparison performed
+		(note: we start the comparison from back - from the last word, when index is -1 /default/
+		it is automatically set into the last word)
+		I introduced it for some kind of optimization made in the second division algorithm (Div2)
+	*/
+	bool CmpSmaller(const UInt<value_size> & l, sint index = -1) const
+	{
+	#ifdef TTMATH_CONSTANT_TIME
+
+		uint smaller, bigger;
+		ConstantTime_Cmp(l, index, smaller, bigger);
+
+		return smaller == 1;
+
+	#else
+
+		return CmpVector(table, l.table, CmpSize(index)) < 0;
+
+	#endif
 	}
 
 
@@ -2871,22 +5783,18 @@ public:
 	*/
 	bool CmpBigger(const UInt<value_size> & l, sint index = -1) const
 	{
-	sint i;
+	#ifdef TTMATH_CONSTANT_TIME
 
-		if( index==-1 || index>=sint(value_size) )
-			i = value_size - 1;
-		else
-			i = index;
+		uint smaller, bigger;
+		ConstantTime_Cmp(l, index, smaller, bigger);
 
+		return bigger == 1;
 
-		for( ; i>=0 ; --i)
-		{
-			if( table[i] != l.table[i] )
-				return table[i] > l.table[i];
-		}
+	#else
 
-	// they're equal
-	return false;
+		return CmpVector(table, l.table, CmpSize(index)) > 0;
+
+	#endif
 	}
 
 
@@ -2899,19 +5807,18 @@ public:
 	*/
 	bool CmpEqual(const UInt<value_size> & l, sint index = -1) const
 	{
-	sint i;
+	#ifdef TTMATH_CONSTANT_TIME
 
-		if( index==-1 || index>=sint(value_size) )
-			i = value_size - 1;
-		else
-			i = index;
+		uint smaller, bigger;
+		ConstantTime_Cmp(l, index, smaller, bigger);
 
+		return (smaller | bigger) == 0;
 
-		for( ; i>=0 ; --i)
-			if( table[i] != l.table[i] )
-				return false;
+	#else
 
-	return true;
+		return CmpVector(table, l.table, CmpSize(index)) == 0;
+
+	#endif
 	}
 
 
@@ -2925,22 +5832,18 @@ public:
 	*/
 	bool CmpSmallerEqual(const UInt<value_size> & l, sint index=-1) const
 	{
-	sint i;
+	#ifdef TTMATH_CONSTANT_TIME
 
-		if( index==-1 || index>=sint(value_size) )
-			i = value_size - 1;
-		else
-			i = index;
+		uint smaller, bigger;
+		ConstantTime_Cmp(l, index, smaller, bigger);
 
+		return bigger == 0;
 
-		for( ; i>=0 ; --i)
-		{
-			if( table[i] != l.table[i] )
-				return table[i] < l.table[i];
-		}
+	#else
 
-	// they're equal
-	return true;
+		return CmpVector(table, l.table, CmpSize(index)) <= 0;
+
+	#endif
 	}
 
 
@@ -2954,22 +5857,18 @@ public:
 	*/
 	bool CmpBiggerEqual(const UInt<value_size> & l, sint index=-1) const
 	{
-	sint i;
+	#ifdef TTMATH_CONSTANT_TIME
 
-		if( index==-1 || index>=sint(value_size) )
-			i = value_size - 1;
-		else
-			i = index;
+		uint smaller, bigger;
+		ConstantTime_Cmp(l, index, smaller, bigger);
 
+		return smaller == 0;
 
-		for( ; i>=0 ; --i)
-		{
-			if( table[i] != l.table[i] )
-				return table[i] > l.table[i];
-		}
+	#else
 
-	// they're equal
-	return true;
+		return CmpVector(table, l.table, CmpSize(index)) >= 0;
+
+	#endif
 	}
 
 
@@ -3258,11 +6157,20 @@ public:
 #endif // TTMATH_NOASM
 
 
+#ifndef TTMATH_NOASM
+#ifdef TTMATH_PLATFORM64
+
+	static uint MulVector_Adx(const uint * ss1, uint ss2, uint size, uint * result);
+	static uint MulAddVector_Adx(const uint * ss1, uint ss2, uint size, uint * result);
+	static uint MulSubVector_Adx(const uint * ss1, uint ss2, uint size, uint * result);
+
+#endif // TTMATH_PLATFORM64
+#endif // TTMATH_NOASM
+
+
 private:
 	uint Rcl2_one(uint c);
 	uint Rcr2_one(uint c);
-	uint Rcl2(uint bits, uint c);
-	uint Rcr2(uint bits, uint c);
 
 public:
 	uint Add(const UInt<value_size> & ss2, uint c=0);
@@ -3272,6 +6180,11 @@ public:
 	uint Sub(const UInt<value_size> & ss2, uint c=0);
 	uint SubInt(uint value, uint index = 0);
 	static uint SubVector(const uint * ss1, const uint * ss2, uint ss1_size, uint ss2_size, uint * result);
+	static uint MulVector(const uint * ss1, uint ss2, uint size, uint * result);
+	static uint MulAddVector(const uint * ss1, uint ss2, uint size, uint * result);
+	static uint MulSubVector(const uint * ss1, uint ss2, uint size, uint * result);
+	static uint ShiftLeftVector(const uint * ss1, uint size, uint bits, uint * result);
+	static uint ShiftRightVector(const uint * ss1, uint size, uint bits, uint * result);
 	static sint FindLeadingBitInWord(uint x);
 	static uint SetBitInWord(uint & value, uint bit);
 	static void MulTwoWords(uint a, uint b, uint * result_high, uint * result_low);
@@ -3282,7 +6195,7 @@ public:
 
 /*!
 	this specialization is needed in order to not confused the compiler "error: ISO C++ forbids zero-size array"
-	when compiling Mul3Big2() method
+	when compiling Mul3Big2() and Sqr3Big2() methods
 */
 template<>
 class UInt<0>
@@ -3293,9 +6206,188 @@ public:
 	void Mul2Big(const UInt<0> &, UInt<0> &) { TTMATH_ASSERT(false) };
 	void SetZero() { TTMATH_ASSERT(false) };
 	uint AddTwoInts(uint, uint, uint) { TTMATH_ASSERT(false) return 0; };
+	uint Rcl(uint, uint = 0) { TTMATH_ASSERT(false) return 0; };
+};
+
+
+
+/*!
+	\brief UIntDivisor is a divisor prepared for many divisions by the same value
+
+	it keeps the normalized divisor (moved to the left so that the highest bit
+	is set) and its reciprocal, these values are calculated only once in Set()
+	and then they are used by UInt::Div(const UIntDivisor<value_size> &)
+	and UInt::DivInt(const UIntDivisor<1> &)
+
+	e.g.
+		UIntDivisor<1> ten(10);
+		while( !x.IsZero() )
+			x.DivInt(ten, &digit);
+*/
+template<uint value_size>
+class UIntDivisor
+{
+public:
+
+	/*!
+		the divisor
+	*/
+	UInt<value_size> value;
+
+	/*!
+		the divisor moved to the left by 'bits' bits
+		(the highest bit in the last non-zero word is set)
+	*/
+	UInt<value_size> normalized;
+
+	/*!
+		how many words the divisor has (zero if the divisor is zero)
+	*/
+	uint size;
+
+	/*!
+		how many bits the divisor has been moved
+	*/
+	uint bits;
+
+	/*!
+		the reciprocal of the highest word (size==1) or the highest two words (size>1)
+		of 'normalized' (the 2/1 and 3/2 division by Moller and Granlund)
+	*/
+	uint inverse;
+
+	/*!
+		the divisor normalized to (value_size+1)/2 words and its Newton's reciprocal,
+		they are used by the fourth division algorithm (for big divisors only),
+		if use_reciprocal is false they are not calculated
+	*/
+	UInt<(value_size+1)/2> block, reciprocal;
+	bool use_reciprocal;
+
+
+	/*!
+		the default constructor - the divisor is zero
+	*/
+	UIntDivisor()
+	{
+		value.SetZero();
+		normalized.SetZero();
+		size    = 0;
+		bits    = 0;
+		inverse = 0;
+		use_reciprocal = false;
+	}
+
+
+	/*!
+		a constructor for converting UInt into this class
+	*/
+	explicit UIntDivisor(const UInt<value_size> & divisor)
+	{
+		Set(divisor);
+	}
+
+
+	/*!
+		a constructor for converting a word into this class
+	*/
+	explicit UIntDivisor(uint divisor)
+	{
+		Set(divisor);
+	}
+
+
+	/*!
+		it prepares the divisor
+
+		it returns 1 if the divisor is zero
+	*/
+	uint Set(const UInt<value_size> & divisor)
+	{
+		value          = divisor;
+		normalized     = divisor;
+		bits           = 0;
+		inverse        = 0;
+		use_reciprocal = false;
+
+		for(size=value_size ; size>0 && value.table[size-1]==0 ; --size);
+
+		if( size == 0 )
+			return 1;
+
+		bits = UInt<value_size>::Div3_NormalizeDivisor(normalized, size);
+
+		// value_size > 1 makes the second branch dead at compile time for UInt<1>
+		if( value_size > 1 && size > 1 )
+			inverse = UInt<value_size>::Div_Inverse32(normalized.table[size-1], normalized.table[size-2]);
+		else
+			inverse = UInt<value_size>::Div_WordInverse(normalized.table[0]);
+
+		// the same conditions as in UInt::DivFastest()
+		if( value_size >= TTMATH_USE_NEWTON_DIVISION_FROM_SIZE*2 && size >= TTMATH_USE_NEWTON_DIVISION_FROM_SIZE &&
+			size <= (value_size+1)/2 && size*4 > value_size )
+		{
+			UInt<value_size>::template Div4_Normalize<(value_size+1)/2>(value, size, block);
+			UInt<value_size>::template Div4_Reciprocal<(value_size+1)/2>(block.table, reciprocal.table);
+			use_reciprocal = true;
+		}
+
+	return 0;
+	}
+
+
+	/*!
+		it prepares the divisor (one word)
+
+		it returns 1 if the divisor is zero
+	*/
+	uint Set(uint divisor)
+	{
+	UInt<value_size> temp;
+
+		temp = divisor;
+
+	return Set(temp);
+	}
 };
 
 
+
+
+/*!
+	division by one word: this = this / divisor
+
+	the divisor is prepared earlier (look at UIntDivisor),
+	the hardware division is not used here
+
+	return values:
+		 0 - ok
+		 1 - division by zero
+*/
+template<uint value_size>
+uint UInt<value_size>::DivInt(const UIntDivisor<1> & divisor, uint * remainder)
+{
+	if( divisor.size == 0 )
+	{
+		if( remainder )
+			*remainder = 0;
+
+		TTMATH_LOG("UInt::DivInt(UIntDivisor)")
+
+	return 1;
+	}
+
+	uint r = Div_WordNormalized(divisor.normalized.table[0], divisor.bits, divisor.inverse);
+
+	if( remainder )
+		*remainder = r;
+
+	TTMATH_LOG("UInt::DivInt(UIntDivisor)")
+
+return 0;
+}
+
+
 } //namespace
 
 
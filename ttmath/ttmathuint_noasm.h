@@ -56,6 +56,17 @@ namespace ttmath
 	{
 	uint temp;
 
+	#ifdef TTMATH_CONSTANT_TIME
+
+		// carry must be zero or one here
+		// the carry is taken from the highest bits of the operands and the result
+		temp    = a + b + carry;
+		*result = temp;
+
+		return ((a & b) | ((a | b) & ~temp)) >> (TTMATH_BITS_PER_UINT - 1);
+
+	#else
+
 		if( carry == 0 )
 		{
 			temp = a + b;
@@ -75,6 +86,8 @@ namespace ttmath
 		*result = temp;
 
 	return carry;
+
+	#endif
 	}
 
 
@@ -232,9 +245,111 @@ namespace ttmath
 
 
 
+	/*!
+		this static method multiplies the vector ss1 by one word ss2
+		(result = ss1 * ss2)
+
+		ss1 and result have 'size' words (they can point to the same vector),
+		the method returns the highest word of the product
+	*/
+	template<uint value_size>
+	uint UInt<value_size>::MulVector(const uint * ss1, uint ss2, uint size, uint * result)
+	{
+	uint i, c = 0, high, low;
+
+		for(i=0 ; i<size ; ++i)
+		{
+			MulTwoWords(ss1[i], ss2, &high, &low);
+
+			// high is at most 0xff...fe so adding the carry can't overflow
+			high += AddTwoWords(low, c, 0, &result[i]);
+			c     = high;
+		}
+
+		//TTMATH_LOG("UInt::MulVector")
+
+	return c;
+	}
+
+
+	/*!
+		this static method multiplies the vector ss1 by one word ss2 and adds
+		the product to the vector result
+		(result = result + ss1 * ss2)
+
+		ss1 and result have 'size' words,
+		the method returns the highest word of the product (the carry)
+		which should be added to result[size]
+
+		(this method is used by the Montgomery reduction - look at UIntMontgomery)
+	*/
+	template<uint value_size>
+	uint UInt<value_size>::MulAddVector(const uint * ss1, uint ss2, uint size, uint * result)
+	{
+	uint i, c = 0, high, low;
+
+		for(i=0 ; i<size ; ++i)
+		{
+			MulTwoWords(ss1[i], ss2, &high, &low);
+
+			// high is at most 0xff...fe so adding two carries can't overflow
+			high += AddTwoWords(low, c, 0, &low);
+			high += AddTwoWords(result[i], low, 0, &result[i]);
+			c     = high;
+		}
+
+		//TTMATH_LOG("UInt::MulAddVector")
+
+	return c;
+	}
+
+
+
+	/*!
+		this static method multiplies the vector ss1 by one word ss2 and subtracts
+		the product from the vector result
+		(result = result - ss1 * ss2)
+
+		ss1 and result have 'size' words,
+		the method returns the highest word of the product (with the borrow)
+		which should be subtracted from result[size]
+	*/
+	template<uint value_size>
+	uint UInt<value_size>::MulSubVector(const uint * ss1, uint ss2, uint size, uint * result)
+	{
+	uint i, c = 0, high, low;
+
+		for(i=0 ; i<size ; ++i)
+		{
+			MulTwoWords(ss1[i], ss2, &high, &low);
+
+			// high is at most 0xff...fe so adding two carries can't overflow
+			high += AddTwoWords(low, c, 0, &low);
+			high += SubTwoWords(result[i], low, 0, &result[i]);
+			c     = high;
+		}
+
+		//TTMATH_LOG("UInt::MulSubVector")
+
+	return c;
+	}
+
+
+
+
 	template<uint value_size>
 	uint UInt<value_size>::SubTwoWords(uint a, uint b, uint carry, uint * result)
 	{
+	#ifdef TTMATH_CONSTANT_TIME
+
+		// carry must be zero or one here
+		uint temp = a - b - carry;
+		*result   = temp;
+
+		return ((~a & b) | ((~a | b) & temp)) >> (TTMATH_BITS_PER_UINT - 1);
+
+	#else
+
 		if( carry == 0 )
 		{
 			*result = a - b;
@@ -252,6 +367,8 @@ namespace ttmath
 		}
 
 	return carry;
+
+	#endif
 	}
 
 
@@ -380,7 +497,7 @@ namespace ttmath
 
 		for(i=0 ; i<value_size ; ++i)
 		{
-			new_c    = (table[i] & TTMATH_UINT_HIGHEST_BIT) ? 1 : 0;
+			new_c    = table[i] >> (TTMATH_BITS_PER_UINT - 1);
 			table[i] = (table[i] << 1) | c;
 			c        = new_c;
 		}
@@ -419,91 +536,91 @@ namespace ttmath
 
 		for(i=sint(value_size)-1 ; i>=0 ; --i)
 		{
-			new_c    = (table[i] & 1) ? TTMATH_UINT_HIGHEST_BIT : 0;
+			new_c    = table[i] << (TTMATH_BITS_PER_UINT - 1);
 			table[i] = (table[i] >> 1) | c;
 			c        = new_c;
 		}
 
 		TTMATH_LOG("UInt::Rcr2_one")
 
-	return c;
+	return c >> (TTMATH_BITS_PER_UINT - 1);
 	}
 
 
 
 
 	/*!
-		this method moves all bits into the left hand side
-		return value <- this <- c
+		this static method moves the vector ss1 'bits' times into the left hand side
+		(result = ss1 << bits)
 
-		the lowest *bits* will be held the 'c' and
-		the state of one additional bit (on the left hand side)
-		will be returned
+		bits must be from 1 to TTMATH_BITS_PER_UINT-1, ss1 and result have 'size' words
+		(result can point to ss1), the method returns the bits which have been moved out
+		(they are in the lowest bits of the returned value)
 
 		for example:
-		let this is 001010000
-		after Rcl2(3, 1) there'll be 010000111 and Rcl2 returns 1
+		let ss1 is 001010000 (one word) then after ShiftLeftVector(ss1, 1, 3, result)
+		the result is 010000000 and the method returns 001
 	*/
 	template<uint value_size>
-	uint UInt<value_size>::Rcl2(uint bits, uint c)
+	uint UInt<value_size>::ShiftLeftVector(const uint * ss1, uint size, uint bits, uint * result)
 	{
 		TTMATH_ASSERT( bits>0 && bits<TTMATH_BITS_PER_UINT )
 
 		uint move = TTMATH_BITS_PER_UINT - bits;
-		uint i, new_c;
+		uint i, c;
 
-		if( c != 0 )
-			c = TTMATH_UINT_MAX_VALUE >> move;
+		if( size == 0 )
+			return 0;
 
-		for(i=0 ; i<value_size ; ++i)
-		{
-			new_c    = table[i] >> move;
-			table[i] = (table[i] << bits) | c;
-			c        = new_c;
-		}
+		// we're going from the highest word so result can point to ss1
+		c = ss1[size-1] >> move;
+
+		for(i=size-1 ; i>0 ; --i)
+			result[i] = (ss1[i] << bits) | (ss1[i-1] >> move);
 
-		TTMATH_LOG("UInt::Rcl2")
+		result[0] = ss1[0] << bits;
 
-	return (c & 1);
+		TTMATH_LOG("UInt::ShiftLeftVector")
+
+	return c;
 	}
 
 
 
 
 	/*!
-		this method moves all bits into the right hand side
-		C -> this -> return value
+		this static method moves the vector ss1 'bits' times into the right hand side
+		(result = ss1 >> bits)
 
-		the highest *bits* will be held the 'c' and
-		the state of one additional bit (on the right hand side)
-		will be returned
+		bits must be from 1 to TTMATH_BITS_PER_UINT-1, ss1 and result have 'size' words
+		(result can point to ss1), the method returns the bits which have been moved out
+		(they are in the highest bits of the returned value)
 
 		for example:
-		let this is 000000010
-		after Rcr2(2, 1) there'll be 110000000 and Rcr2 returns 1
+		let ss1 is 000000110 (one word) then after ShiftRightVector(ss1, 1, 2, result)
+		the result is 000000001 and the method returns 100000000
 	*/
 	template<uint value_size>
-	uint UInt<value_size>::Rcr2(uint bits, uint c)
+	uint UInt<value_size>::ShiftRightVector(const uint * ss1, uint size, uint bits, uint * result)
 	{
 		TTMATH_ASSERT( bits>0 && bits<TTMATH_BITS_PER_UINT )
 
 		uint move = TTMATH_BITS_PER_UINT - bits;
-		sint i; // signed
-		uint new_c;
+		uint i, c;
 
-		if( c != 0 )
-			c = TTMATH_UINT_MAX_VALUE << move;
+		if( size == 0 )
+			return 0;
 
-		for(i=value_size-1 ; i>=0 ; --i)
-		{
-			new_c    = table[i] << move;
-			table[i] = (table[i] >> bits) | c;
-			c        = new_c;
-		}
+		c = ss1[0] << move;
+
+		for(i=0 ; i+1<size ; ++i)
+			result[i] = (ss1[i] >> bits) | (ss1[i+1] << move);
 
-		TTMATH_LOG("UInt::Rcr2")
+		result[size-1] = ss1[size-1] >> bits;
 
-	return (c & TTMATH_UINT_HIGHEST_BIT) ? 1 : 0;
+		TTMATH_LOG("UInt::ShiftRightVector")
+
+	return c;
 	}
 
 
@@ -512,6 +512,268 @@ namespace ttmath
 	}
 
 
+	/*!
+		this static method multiplies the vector ss1 by one word ss2
+		(result = ss1 * ss2)
+
+		ss1 and result have 'size' words (they can point to the same vector),
+		the method returns the highest word of the product
+	*/
+	template<uint value_size>
+	uint UInt<value_size>::MulVector(const uint * ss1, uint ss2, uint size, uint * result)
+	{
+	uint c;
+
+		#ifndef __GNUC__
+
+			//	this part might be compiled with for example visual c
+			__asm
+			{
+				pushad
+
+				mov ecx, [size]
+				mov esi, [ss1]
+				mov edi, [result]
+				xor ebx, ebx             // ebx = carry (the high word)
+
+				or ecx, ecx
+				jz ttmath_end
+
+			ttmath_loop:
+				mov eax, [esi]
+				mul dword ptr [ss2]      // edx:eax = ss1[i] * ss2
+				add eax, ebx
+				adc edx, 0
+				mov [edi], eax
+				mov ebx, edx
+
+				add esi, 4
+				add edi, 4
+				dec ecx
+			jnz ttmath_loop
+
+			ttmath_end:
+				mov [c], ebx
+
+				popad
+			}
+
+		#endif		
+			
+
+		#ifdef __GNUC__
+			
+		//	this part should be compiled with gcc
+		uint dummy1, dummy2, dummy3, dummy4, dummy5;
+
+			__asm__ __volatile__(
+				"xor %%ebx, %%ebx					\n"   // ebx = carry (the high word)
+				"or %%ecx, %%ecx					\n"
+				"jz 2f								\n"
+			"1:										\n"
+				"mov (%%esi), %%eax					\n"
+				"mull %9							\n"   // edx:eax = ss1[i] * ss2
+				"add %%ebx, %%eax					\n"
+				"adc $0, %%edx						\n"
+				"mov %%eax, (%%edi)					\n"
+				"mov %%edx, %%ebx					\n"
+
+				"add $4, %%esi						\n"
+				"add $4, %%edi						\n"
+				"dec %%ecx							\n"
+			"jnz 1b									\n"
+			"2:										\n"
+
+				: "=b" (c), "=c" (dummy1), "=S" (dummy2), "=D" (dummy3), "=a" (dummy4), "=d" (dummy5)
+				: "1" (size), "2" (ss1), "3" (result), "m" (ss2)
+				: "cc", "memory" );
+
+		#endif
+
+		TTMATH_LOG("UInt::MulVector")
+
+	return c;
+	}
+
+
+	/*!
+		this static method multiplies the vector ss1 by one word ss2 and adds
+		the product to the vector result
+		(result = result + ss1 * ss2)
+
+		ss1 and result have 'size' words,
+		the method returns the highest word of the product (the carry)
+		which should be added to result[size]
+
+		(this method is used by the Montgomery reduction - look at UIntMontgomery)
+	*/
+	template<uint value_size>
+	uint UInt<value_size>::MulAddVector(const uint * ss1, uint ss2, uint size, uint * result)
+	{
+	uint c;
+
+		#ifndef __GNUC__
+
+			//	this part might be compiled with for example visual c
+			__asm
+			{
+				pushad
+
+				mov ecx, [size]
+				mov esi, [ss1]
+				mov edi, [result]
+				xor ebx, ebx             // ebx = carry (the high word)
+
+				or ecx, ecx
+				jz ttmath_end
+
+			ttmath_loop:
+				mov eax, [esi]
+				mul dword ptr [ss2]      // edx:eax = ss1[i] * ss2
+				add eax, ebx
+				adc edx, 0
+				add [edi], eax
+				adc edx, 0
+				mov ebx, edx
+
+				add esi, 4
+				add edi, 4
+				dec ecx
+			jnz ttmath_loop
+
+			ttmath_end:
+				mov [c], ebx
+
+				popad
+			}
+
+		#endif		
+			
+
+		#ifdef __GNUC__
+			
+		//	this part should be compiled with gcc
+		uint dummy1, dummy2, dummy3, dummy4, dummy5;
+
+			__asm__ __volatile__(
+				"xor %%ebx, %%ebx					\n"   // ebx = carry (the high word)
+				"or %%ecx, %%ecx					\n"
+				"jz 2f								\n"
+			"1:										\n"
+				"mov (%%esi), %%eax					\n"
+				"mull %9							\n"   // edx:eax = ss1[i] * ss2
+				"add %%ebx, %%eax					\n"
+				"adc $0, %%edx						\n"
+				"add %%eax, (%%edi)					\n"
+				"adc $0, %%edx						\n"
+				"mov %%edx, %%ebx					\n"
+
+				"add $4, %%esi						\n"
+				"add $4, %%edi						\n"
+				"dec %%ecx							\n"
+			"jnz 1b									\n"
+			"2:										\n"
+
+				: "=b" (c), "=c" (dummy1), "=S" (dummy2), "=D" (dummy3), "=a" (dummy4), "=d" (dummy5)
+				: "1" (size), "2" (ss1), "3" (result), "m" (ss2)
+				: "cc", "memory" );
+
+		#endif
+
+		TTMATH_LOG("UInt::MulAddVector")
+
+	return c;
+	}
+
+
+	/*!
+		this static method multiplies the vector ss1 by one word ss2 and subtracts
+		the product from the vector result
+		(result = result - ss1 * ss2)
+
+		ss1 and result have 'size' words,
+		the method returns the highest word of the product (with the borrow)
+		which should be subtracted from result[size]
+	*/
+	template<uint value_size>
+	uint UInt<value_size>::MulSubVector(const uint * ss1, uint ss2, uint size, uint * result)
+	{
+	uint c;
+
+		#ifndef __GNUC__
+
+			//	this part might be compiled with for example visual c
+			__asm
+			{
+				pushad
+
+				mov ecx, [size]
+				mov esi, [ss1]
+				mov edi, [result]
+				xor ebx, ebx             // ebx = carry (the high word)
+
+				or ecx, ecx
+				jz ttmath_end
+
+			ttmath_loop:
+				mov eax, [esi]
+				mul dword ptr [ss2]      // edx:eax = ss1[i] * ss2
+				add eax, ebx
+				adc edx, 0
+				sub [edi], eax
+				adc edx, 0
+				mov ebx, edx
+
+				add esi, 4
+				add edi, 4
+				dec ecx
+			jnz ttmath_loop
+
+			ttmath_end:
+				mov [c], ebx
+
+				popad
+			}
+
+		#endif		
+			
+
+		#ifdef __GNUC__
+			
+		//	this part should be compiled with gcc
+		uint dummy1, dummy2, dummy3, dummy4, dummy5;
+
+			__asm__ __volatile__(
+				"xor %%ebx, %%ebx					\n"   // ebx = carry (the high word)
+				"or %%ecx, %%ecx					\n"
+				"jz 2f								\n"
+			"1:										\n"
+				"mov (%%esi), %%eax					\n"
+				"mull %9							\n"   // edx:eax = ss1[i] * ss2
+				"add %%ebx, %%eax					\n"
+				"adc $0, %%edx						\n"
+				"sub %%eax, (%%edi)					\n"
+				"adc $0, %%edx						\n"
+				"mov %%edx, %%ebx					\n"
+
+				"add $4, %%esi						\n"
+				"add $4, %%edi						\n"
+				"dec %%ecx							\n"
+			"jnz 1b									\n"
+			"2:										\n"
+
+				: "=b" (c), "=c" (dummy1), "=S" (dummy2), "=D" (dummy3), "=a" (dummy4), "=d" (dummy5)
+				: "1" (size), "2" (ss1), "3" (result), "m" (ss2)
+				: "cc", "memory" );
+
+		#endif
+
+		TTMATH_LOG("UInt::MulSubVector")
+
+	return c;
+	}
+
+
 	/*!
 		subtracting ss2 from the 'this' and subtracting
 		carry if it has been defined
@@ -991,134 +1253,90 @@ namespace ttmath
 
 
 
-#ifdef _MSC_VER
-#pragma warning (disable : 4731)
-//warning C4731: frame pointer register 'ebp' modified by inline assembly code
-#endif
-	
-
-
 	/*!
-		this method moves all bits into the left hand side
-		return value <- this <- c
+		this static method moves the vector ss1 'bits' times into the left hand side
+		(result = ss1 << bits)
 
-		the lowest *bits* will be held the 'c' and
-		the state of one additional bit (on the left hand side)
-		will be returned
+		bits must be from 1 to TTMATH_BITS_PER_UINT-1, ss1 and result have 'size' words
+		(result can point to ss1), the method returns the bits which have been moved out
+		(they are in the lowest bits of the returned value)
 
 		for example:
-		let this is 001010000
-		after Rcl2(3, 1) there'll be 010000111 and Rcl2 returns 1
+		let ss1 is 001010000 (one word) then after ShiftLeftVector(ss1, 1, 3, result)
+		the result is 010000000 and the method returns 001
 	*/
 	template<uint value_size>
-	uint UInt<value_size>::Rcl2(uint bits, uint c)
+	uint UInt<value_size>::ShiftLeftVector(const uint * ss1, uint size, uint bits, uint * result)
 	{
 	TTMATH_ASSERT( bits>0 && bits<TTMATH_BITS_PER_UINT )
-		
-	uint b = value_size;
-	uint * p1 = table;
+
+		if( size == 0 )
+			return 0;
+
+	uint c    = ss1[size-1] >> (TTMATH_BITS_PER_UINT - bits);
+	uint last = size - 1;
+
+		// we're going from the highest word,
+		// shld doesn't need a mask for the bits from the next word
 
 		#ifndef __GNUC__
 			__asm
 			{
-				push eax
-				push ebx
-				push ecx
-				push edx
-				push esi
-				push edi
-				push ebp
-
-				mov edi, [b]
-
-				mov ecx, 32
-				sub ecx, [bits]
-				mov edx, -1
-				shr edx, cl
+				pushad
 
+				mov ebx, [last]
 				mov ecx, [bits]
-				mov ebx, [p1]
-				mov eax, [c]
-
-				mov ebp, edx         // ebp = mask (modified ebp - don't read/write to variables)
+				mov esi, [ss1]
+				mov edi, [result]
 
-				xor edx, edx         // edx = 0
-				mov esi, edx
-				or eax, eax
-				cmovnz esi, ebp      // if(c) esi=mask else esi=0
+				mov edx, [esi+ebx*4]     // the highest word
+				or ebx, ebx
+				jz ttmath_end
 
 			ttmath_loop:
-				rol dword ptr [ebx+edx*4], cl
-				
-				mov eax, [ebx+edx*4]
-				and eax, ebp
-				xor [ebx+edx*4], eax // clearing bits
-				or [ebx+edx*4], esi  // saving old value
-				mov esi, eax
+				mov eax, [esi+ebx*4-4]
+				shld edx, eax, cl
+				mov [edi+ebx*4], edx
+				mov edx, eax
 
-				inc edx
-				dec edi
+				dec ebx
 			jnz ttmath_loop
 
-				pop ebp              // restoring ebp
-
-				and eax, 1
-				mov [c], eax
+			ttmath_end:
+				shl edx, cl
+				mov [edi], edx
 
-				pop edi
-				pop esi
-				pop edx
-				pop ecx
-				pop ebx
-				pop eax
+				popad
 			}
 		#endif
 
 
 		#ifdef __GNUC__
-		uint dummy, dummy2, dummy3;
-
-		__asm__  __volatile__(
-
-			"push %%ebp						\n"
-			
-			"movl %%ecx, %%esi				\n"
-			"movl $32, %%ecx				\n"
-			"subl %%esi, %%ecx				\n"    // ecx = 32 - bits
-			"movl $-1, %%edx				\n"    // edx = -1 (all bits set to one)
-			"shrl %%cl, %%edx				\n"    // shifting (0 -> edx -> cf)  (cl times)
-			"movl %%edx, %%ebp				\n"    // ebp = edx = mask
-			"movl %%esi, %%ecx				\n"
-
-			"xorl %%edx, %%edx				\n"
-			"movl %%edx, %%esi				\n"
-			"orl %%eax, %%eax				\n"
-			"cmovnz %%ebp, %%esi			\n"    // if(c) esi=mask else esi=0
-
-		"1:									\n"
-			"roll %%cl, (%%ebx,%%edx,4)		\n"
+		uint dummy1, dummy2, dummy3;
 
-			"movl (%%ebx,%%edx,4), %%eax	\n"
-			"andl %%ebp, %%eax				\n"
-			"xorl %%eax, (%%ebx,%%edx,4)	\n"
-			"orl  %%esi, (%%ebx,%%edx,4)	\n"
-			"movl %%eax, %%esi				\n"
-			
-			"incl %%edx						\n"
-			"decl %%edi						\n"
-		"jnz 1b								\n"
-			
-			"and $1, %%eax					\n"
+			__asm__ __volatile__(
+				"mov (%%esi,%%ebx,4), %%edx			\n"   // the highest word
+				"or %%ebx, %%ebx					\n"
+				"jz 2f								\n"
+			"1:										\n"
+				"mov -4(%%esi,%%ebx,4), %%eax		\n"
+				"shld %%cl, %%eax, %%edx			\n"
+				"mov %%edx, (%%edi,%%ebx,4)			\n"
+				"mov %%eax, %%edx					\n"
 
-			"pop %%ebp						\n"
+				"dec %%ebx							\n"
+			"jnz 1b									\n"
+			"2:										\n"
+				"shl %%cl, %%edx					\n"
+				"mov %%edx, (%%edi)					\n"
 
-			: "=a" (c), "=D" (dummy), "=S" (dummy2), "=d" (dummy3)
-			: "0" (c),  "1" (b), "b" (p1), "c" (bits)
-			: "cc", "memory" );
+				: "=b" (dummy1), "=a" (dummy2), "=d" (dummy3)
+				: "0" (last), "c" (bits), "S" (ss1), "D" (result)
+				: "cc", "memory" );
 
 		#endif
 
-		TTMATH_LOG("UInt::Rcl2")
+		TTMATH_LOG("UInt::ShiftLeftVector")
 
 	return c;
 	}
@@ -1127,142 +1345,95 @@ namespace ttmath
 
 
 	/*!
-		this method moves all bits into the right hand side
-		C -> this -> return value
+		this static method moves the vector ss1 'bits' times into the right hand side
+		(result = ss1 >> bits)
 
-		the highest *bits* will be held the 'c' and
-		the state of one additional bit (on the right hand side)
-		will be returned
+		bits must be from 1 to TTMATH_BITS_PER_UINT-1, ss1 and result have 'size' words
+		(result can point to ss1), the method returns the bits which have been moved out
+		(they are in the highest bits of the returned value)
 
 		for example:
-		let this is 000000010
-		after Rcr2(2, 1) there'll be 110000000 and Rcr2 returns 1
+		let ss1 is 000000110 (one word) then after ShiftRightVector(ss1, 1, 2, result)
+		the result is 000000001 and the method returns 100000000
 	*/
 	template<uint value_size>
-	uint UInt<value_size>::Rcr2(uint bits, uint c)
+	uint UInt<value_size>::ShiftRightVector(const uint * ss1, uint size, uint bits, uint * result)
 	{
 	TTMATH_ASSERT( bits>0 && bits<TTMATH_BITS_PER_UINT )
 
-	uint b = value_size;
-	uint * p1 = table;
+		if( size == 0 )
+			return 0;
+
+	uint c    = ss1[0] << (TTMATH_BITS_PER_UINT - bits);
+	uint rest = size - 1;
 
 		#ifndef __GNUC__
 			__asm
 			{
-				push eax
-				push ebx
-				push ecx
-				push edx
-				push esi
-				push edi
-				push ebp
-
-				mov edi, [b]
-
-				mov ecx, 32
-				sub ecx, [bits]
-				mov edx, -1
-				shl edx, cl
+				pushad
 
+				mov ebx, [rest]
 				mov ecx, [bits]
-				mov ebx, [p1]
-				mov eax, [c]
-
-				mov ebp, edx         // ebp = mask (modified ebp - don't read/write to variables)
+				mov esi, [ss1]
+				mov edi, [result]
 
-				xor edx, edx         // edx = 0
-				mov esi, edx
-				add edx, edi
-				dec edx              // edx is pointing at the end of the table (on last word)
-				or eax, eax
-				cmovnz esi, ebp      // if(c) esi=mask else esi=0
+				mov edx, [esi]           // the lowest word
+				or ebx, ebx
+				jz ttmath_end
 
 			ttmath_loop:
-				ror dword ptr [ebx+edx*4], cl
-				
-				mov eax, [ebx+edx*4]
-				and eax, ebp 
-				xor [ebx+edx*4], eax // clearing bits
-				or [ebx+edx*4], esi  // saving old value
-				mov esi, eax
-
-				dec edx
-				dec edi
+				mov eax, [esi+4]
+				shrd edx, eax, cl
+				mov [edi], edx
+				mov edx, eax
+
+				add esi, 4
+				add edi, 4
+				dec ebx
 			jnz ttmath_loop
 
-				pop ebp              // restoring ebp
-
-				rol eax, 1           // 31bit will be first
-				and eax, 1  
-				mov [c], eax
+			ttmath_end:
+				shr edx, cl
+				mov [edi], edx
 
-				pop edi
-				pop esi
-				pop edx
-				pop ecx
-				pop ebx
-				pop eax
+				popad
 			}
 		#endif
 
 
 		#ifdef __GNUC__
-		uint dummy, dummy2, dummy3;
-
-			__asm__  __volatile__(
-
-			"push %%ebp						\n"
-			
-			"movl %%ecx, %%esi				\n"
-			"movl $32, %%ecx				\n"
-			"subl %%esi, %%ecx				\n"    // ecx = 32 - bits
-			"movl $-1, %%edx				\n"    // edx = -1 (all bits set to one)
-			"shll %%cl, %%edx				\n"    // shifting (cf <- edx <- 0)  (cl times)
-			"movl %%edx, %%ebp				\n"    // ebp = edx = mask
-			"movl %%esi, %%ecx				\n"
-
-			"xorl %%edx, %%edx				\n"
-			"movl %%edx, %%esi				\n"
-			"addl %%edi, %%edx				\n"
-			"decl %%edx						\n"    // edx is pointing at the end of the table (on last word)
-			"orl %%eax, %%eax				\n"
-			"cmovnz %%ebp, %%esi			\n"    // if(c) esi=mask else esi=0
-
-		"1:									\n"
-			"rorl %%cl, (%%ebx,%%edx,4)		\n"
-
-			"movl (%%ebx,%%edx,4), %%eax	\n"
-			"andl %%ebp, %%eax				\n"
-			"xorl %%eax, (%%ebx,%%edx,4)	\n"
-			"orl  %%esi, (%%ebx,%%edx,4)	\n"
-			"movl %%eax, %%esi				\n"
-			
-			"decl %%edx						\n"
-			"decl %%edi						\n"
-		"jnz 1b								\n"
-			
-			"roll $1, %%eax					\n"
-			"andl $1, %%eax					\n"
+		uint dummy1, dummy2, dummy3, dummy4, dummy5;
 
-			"pop %%ebp						\n"
+			__asm__ __volatile__(
+				"mov (%%esi), %%edx					\n"   // the lowest word
+				"or %%ebx, %%ebx					\n"
+				"jz 2f								\n"
+			"1:										\n"
+				"mov 4(%%esi), %%eax				\n"
+				"shrd %%cl, %%eax, %%edx			\n"
+				"mov %%edx, (%%edi)					\n"
+				"mov %%eax, %%edx					\n"
+
+				"add $4, %%esi						\n"
+				"add $4, %%edi						\n"
+				"dec %%ebx							\n"
+			"jnz 1b									\n"
+			"2:										\n"
+				"shr %%cl, %%edx					\n"
+				"mov %%edx, (%%edi)					\n"
 
-			: "=a" (c), "=D" (dummy), "=S" (dummy2), "=d" (dummy3)
-			: "0" (c),  "1" (b), "b" (p1), "c" (bits)
-			: "cc", "memory" );
+				: "=b" (dummy1), "=a" (dummy2), "=d" (dummy3), "=S" (dummy4), "=D" (dummy5)
+				: "0" (rest), "c" (bits), "3" (ss1), "4" (result)
+				: "cc", "memory" );
 
 		#endif
 
-		TTMATH_LOG("UInt::Rcr2")
+		TTMATH_LOG("UInt::ShiftRightVector")
 
 	return c;
 	}
 
 
-#ifdef _MSC_VER
-#pragma warning (default : 4731)
-#endif
-
-
 	/*
 		this method returns the number of the highest set bit in one 32-bit word
 		if the 'x' is zero this method returns '-1'
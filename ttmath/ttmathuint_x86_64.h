@@ -352,6 +352,481 @@ namespace ttmath
 
 
 
+	/*!
+		an auxiliary function for CpuHasMulxAdx()
+		it reads the flags from the cpuid instruction
+	*/
+	inline bool CpuHasMulxAdx_Check()
+	{
+	bool has = false;
+
+		#ifndef __GNUC__
+			#error "another compiler than GCC is currently not supported in 64bit mode"
+		#endif
+
+		#ifdef __GNUC__
+		uint max_leaf, a, b, c, d;
+
+			__asm__ __volatile__(
+				"cpuid	\n"
+				: "=a" (max_leaf), "=b" (b), "=c" (c), "=d" (d)
+				: "0" (0), "2" (0) );
+
+			if( max_leaf >= 7 )
+			{
+				__asm__ __volatile__(
+					"cpuid	\n"
+					: "=a" (a), "=b" (b), "=c" (c), "=d" (d)
+					: "0" (7), "2" (0) );
+
+				// ebx: bit 8 - BMI2, bit 19 - ADX
+				if( (b & (uint(1) << 8)) && (b & (uint(1) << 19)) )
+					has = true;
+			}
+
+		#endif
+
+	return has;
+	}
+
+
+	/*!
+		an auxiliary function for CpuHasMulxAdx() and CpuUseMulxAdx()
+		it returns the flag which tells whether the mulx/adx code is used
+
+		the flag is taken from the cpuid instruction only once (the first time
+		the function is called) and it is shared by all UInt<> types,
+		the initialization of the static variable is thread-safe (GCC guards it)
+	*/
+	inline bool & CpuMulxAdxFlag()
+	{
+	static bool has_mulx_adx = CpuHasMulxAdx_Check();
+
+	return has_mulx_adx;
+	}
+
+
+	/*!
+		this function checks whether the processor has the BMI2 (mulx)
+		and ADX (adcx, adox) instructions (and whether they are not switched
+		off by CpuUseMulxAdx(false))
+	*/
+	inline bool CpuHasMulxAdx()
+	{
+		return CpuMulxAdxFlag();
+	}
+
+
+	/*!
+		this function switches off (use=false) or on again (use=true) the code
+		which uses the mulx and adcx/adox instructions, then MulVector(),
+		MulAddVector() and MulSubVector() use the generic code,
+		it is mainly for testing both variants on the same processor
+
+		the instructions are never used if the processor doesn't have them,
+		call this function before other threads use UInt<> objects
+	*/
+	inline void CpuUseMulxAdx(bool use)
+	{
+		CpuMulxAdxFlag() = use && CpuHasMulxAdx_Check();
+	}
+
+
+
+	/*!
+		this static method multiplies the vector ss1 by one word ss2
+		(result = ss1 * ss2)
+
+		ss1 and result have 'size' words (they can point to the same vector),
+		the method returns the highest word of the product
+
+		if the processor has mulx this method calls MulVector_Adx
+	*/
+	template<uint value_size>
+	uint UInt<value_size>::MulVector(const uint * ss1, uint ss2, uint size, uint * result)
+	{
+	uint c;
+
+		if( CpuHasMulxAdx() )
+			return MulVector_Adx(ss1, ss2, size, result);
+
+		#ifndef __GNUC__
+			#error "another compiler than GCC is currently not supported in 64bit mode"
+		#endif
+
+		#ifdef __GNUC__
+		uint dummy1, dummy2;
+
+			__asm__ __volatile__(
+				"xor %%r8, %%r8						\n"   // r8 = carry (the high word)
+				"xor %%r9, %%r9						\n"   // r9 = index
+				"or %%rcx, %%rcx					\n"
+				"jz 2f								\n"
+			"1:										\n"
+				"mov (%%rsi,%%r9,8), %%rax			\n"
+				"mul %%rbx							\n"   // rdx:rax = ss1[i] * ss2
+				"add %%r8, %%rax					\n"
+				"adc $0, %%rdx						\n"
+				"mov %%rax, (%%rdi,%%r9,8)			\n"
+				"mov %%rdx, %%r8					\n"
+
+				"inc %%r9							\n"
+				"dec %%rcx							\n"
+			"jnz 1b									\n"
+			"2:										\n"
+				"mov %%r8, %%rax					\n"
+
+				: "=a" (c), "=c" (dummy1), "=d" (dummy2)
+				: "1" (size), "b" (ss2), "S" (ss1), "D" (result)
+				: "%r8", "%r9", "cc", "memory" );
+
+		#endif
+
+		TTMATH_LOG("UInt::MulVector")
+
+	return c;
+	}
+
+
+
+	/*!
+		this static method multiplies the vector ss1 by one word ss2
+		(result = ss1 * ss2)
+
+		the same as MulVector but it uses the mulx instruction (BMI2)
+		and the adcx instruction (ADX) so the flags are not touched by the multiplication
+
+		***this method can be called only if CpuHasMulxAdx() returns true***
+	*/
+	template<uint value_size>
+	uint UInt<value_size>::MulVector_Adx(const uint * ss1, uint ss2, uint size, uint * result)
+	{
+	uint c;
+
+		#ifndef __GNUC__
+			#error "another compiler than GCC is currently not supported in 64bit mode"
+		#endif
+
+		#ifdef __GNUC__
+		uint dummy1, dummy2, dummy3;
+
+			/*
+				rsi and rdi point at the end of the vectors
+				and rcx is a negative index going up to zero
+				(lea and jrcxz don't change the flags)
+			*/
+			__asm__ __volatile__(
+				"lea (%%rsi,%%rcx,8), %%rsi			\n"
+				"lea (%%rdi,%%rcx,8), %%rdi			\n"
+				"neg %%rcx							\n"
+				"xor %%r8, %%r8						\n"   // r8 = carry (the high word), CF=0
+				"jrcxz 2f							\n"
+				"test $1, %%cl						\n"   // test clears CF too
+				"jz 1f								\n"
+
+				"mulx (%%rsi,%%rcx,8), %%r9, %%r8	\n"   // an odd size - the first word separately
+				"mov %%r9, (%%rdi,%%rcx,8)			\n"
+				"lea 1(%%rcx), %%rcx				\n"
+				"jrcxz 2f							\n"
+
+			"1:										\n"   // two words in one iteration
+				"mulx (%%rsi,%%rcx,8), %%r9, %%r10	\n"   // r10:r9 = ss1[i] * ss2
+				"adcx %%r8, %%r9					\n"
+				"mov %%r9, (%%rdi,%%rcx,8)			\n"
+				"mulx 8(%%rsi,%%rcx,8), %%r9, %%r8	\n"   // r8:r9 = ss1[i+1] * ss2
+				"adcx %%r10, %%r9					\n"
+				"mov %%r9, 8(%%rdi,%%rcx,8)			\n"
+
+				"lea 2(%%rcx), %%rcx				\n"
+				"jrcxz 2f							\n"
+			"jmp 1b									\n"
+			"2:										\n"
+				"mov $0, %%eax						\n"
+				"adcx %%r8, %%rax					\n"
+
+				: "=a" (c), "=c" (dummy1), "=S" (dummy2), "=D" (dummy3)
+				: "1" (size), "2" (ss1), "3" (result), "d" (ss2)
+				: "%r8", "%r9", "%r10", "cc", "memory" );
+
+		#endif
+
+		TTMATH_LOG("UInt::MulVector_Adx")
+
+	return c;
+	}
+
+
+
+	/*!
+		this static method multiplies the vector ss1 by one word ss2 and adds
+		the product to the vector result
+		(result = result + ss1 * ss2)
+
+		ss1 and result have 'size' words,
+		the method returns the highest word of the product (the carry)
+		which should be added to result[size]
+
+		if the processor has mulx and adx this method calls MulAddVector_Adx
+
+		(this method is used by the Montgomery reduction - look at UIntMontgomery)
+	*/
+	template<uint value_size>
+	uint UInt<value_size>::MulAddVector(const uint * ss1, uint ss2, uint size, uint * result)
+	{
+	uint c;
+
+		if( CpuHasMulxAdx() )
+			return MulAddVector_Adx(ss1, ss2, size, result);
+
+		#ifndef __GNUC__
+			#error "another compiler than GCC is currently not supported in 64bit mode"
+		#endif
+
+		#ifdef __GNUC__
+		uint dummy1, dummy2;
+
+			//	this part should be compiled with gcc
+		
+			__asm__ __volatile__(
+				"xor %%r8, %%r8						\n"   // r8 = carry (the high word)
+				"xor %%r9, %%r9						\n"   // r9 = index
+				"or %%rcx, %%rcx					\n"
+				"jz 2f								\n"
+			"1:										\n"
+				"mov (%%rsi,%%r9,8), %%rax			\n"
+				"mul %%rbx							\n"   // rdx:rax = ss1[i] * ss2
+				"add %%r8, %%rax					\n"
+				"adc $0, %%rdx						\n"
+				"add %%rax, (%%rdi,%%r9,8)			\n"
+				"adc $0, %%rdx						\n"
+				"mov %%rdx, %%r8					\n"
+
+				"inc %%r9							\n"
+				"dec %%rcx							\n"
+			"jnz 1b									\n"
+			"2:										\n"
+				"mov %%r8, %%rax					\n"
+
+				: "=a" (c), "=c" (dummy1), "=d" (dummy2)
+				: "1" (size), "b" (ss2), "S" (ss1), "D" (result)
+				: "%r8", "%r9", "cc", "memory" );
+
+		#endif
+
+		TTMATH_LOG("UInt::MulAddVector")
+
+	return c;
+	}
+
+
+
+	/*!
+		this static method multiplies the vector ss1 by one word ss2 and adds
+		the product to the vector result
+		(result = result + ss1 * ss2)
+
+		the same as MulAddVector but it uses mulx (BMI2) and two independent
+		carry chains: adcx (the CF flag) carries the high words of the products
+		and adox (the OF flag) carries the additions to the result
+
+		***this method can be called only if CpuHasMulxAdx() returns true***
+	*/
+	template<uint value_size>
+	uint UInt<value_size>::MulAddVector_Adx(const uint * ss1, uint ss2, uint size, uint * result)
+	{
+	uint c;
+
+		#ifndef __GNUC__
+			#error "another compiler than GCC is currently not supported in 64bit mode"
+		#endif
+
+		#ifdef __GNUC__
+		uint dummy1, dummy2, dummy3;
+
+			__asm__ __volatile__(
+				"lea (%%rsi,%%rcx,8), %%rsi			\n"
+				"lea (%%rdi,%%rcx,8), %%rdi			\n"
+				"neg %%rcx							\n"
+				"xor %%r8, %%r8						\n"   // r8 = carry (the high word), CF=OF=0
+				"jrcxz 2f							\n"
+				"test $1, %%cl						\n"   // test clears CF and OF too
+				"jz 1f								\n"
+
+				"mulx (%%rsi,%%rcx,8), %%r9, %%r8	\n"   // an odd size - the first word separately
+				"adox (%%rdi,%%rcx,8), %%r9			\n"
+				"mov %%r9, (%%rdi,%%rcx,8)			\n"
+				"lea 1(%%rcx), %%rcx				\n"
+				"jrcxz 2f							\n"
+
+			"1:										\n"   // two words in one iteration
+				"mulx (%%rsi,%%rcx,8), %%r9, %%r10	\n"   // r10:r9 = ss1[i] * ss2
+				"adcx %%r8, %%r9					\n"
+				"adox (%%rdi,%%rcx,8), %%r9			\n"
+				"mov %%r9, (%%rdi,%%rcx,8)			\n"
+				"mulx 8(%%rsi,%%rcx,8), %%r9, %%r8	\n"   // r8:r9 = ss1[i+1] * ss2
+				"adcx %%r10, %%r9					\n"
+				"adox 8(%%rdi,%%rcx,8), %%r9		\n"
+				"mov %%r9, 8(%%rdi,%%rcx,8)			\n"
+
+				"lea 2(%%rcx), %%rcx				\n"
+				"jrcxz 2f							\n"
+			"jmp 1b									\n"
+			"2:										\n"
+				"mov $0, %%eax						\n"
+				"adcx %%r8, %%rax					\n"
+				"adox %%rcx, %%rax					\n"   // rcx is zero here
+
+				: "=a" (c), "=c" (dummy1), "=S" (dummy2), "=D" (dummy3)
+				: "1" (size), "2" (ss1), "3" (result), "d" (ss2)
+				: "%r8", "%r9", "%r10", "cc", "memory" );
+
+		#endif
+
+		TTMATH_LOG("UInt::MulAddVector_Adx")
+
+	return c;
+	}
+
+
+
+	/*!
+		this static method multiplies the vector ss1 by one word ss2 and subtracts
+		the product from the vector result
+		(result = result - ss1 * ss2)
+
+		ss1 and result have 'size' words,
+		the method returns the highest word of the product (with the borrow)
+		which should be subtracted from result[size]
+
+		if the processor has mulx and adx this method calls MulSubVector_Adx
+	*/
+	template<uint value_size>
+	uint UInt<value_size>::MulSubVector(const uint * ss1, uint ss2, uint size, uint * result)
+	{
+	uint c;
+
+		if( CpuHasMulxAdx() )
+			return MulSubVector_Adx(ss1, ss2, size, result);
+
+		#ifndef __GNUC__
+			#error "another compiler than GCC is currently not supported in 64bit mode"
+		#endif
+
+		#ifdef __GNUC__
+		uint dummy1, dummy2;
+
+			__asm__ __volatile__(
+				"xor %%r8, %%r8						\n"   // r8 = carry (the high word)
+				"xor %%r9, %%r9						\n"   // r9 = index
+				"or %%rcx, %%rcx					\n"
+				"jz 2f								\n"
+			"1:										\n"
+				"mov (%%rsi,%%r9,8), %%rax			\n"
+				"mul %%rbx							\n"   // rdx:rax = ss1[i] * ss2
+				"add %%r8, %%rax					\n"
+				"adc $0, %%rdx						\n"
+				"sub %%rax, (%%rdi,%%r9,8)			\n"
+				"adc $0, %%rdx						\n"
+				"mov %%rdx, %%r8					\n"
+
+				"inc %%r9							\n"
+				"dec %%rcx							\n"
+			"jnz 1b									\n"
+			"2:										\n"
+				"mov %%r8, %%rax					\n"
+
+				: "=a" (c), "=c" (dummy1), "=d" (dummy2)
+				: "1" (size), "b" (ss2), "S" (ss1), "D" (result)
+				: "%r8", "%r9", "cc", "memory" );
+
+		#endif
+
+		TTMATH_LOG("UInt::MulSubVector")
+
+	return c;
+	}
+
+
+
+	/*!
+		this static method multiplies the vector ss1 by one word ss2 and subtracts
+		the product from the vector result
+		(result = result - ss1 * ss2)
+
+		the same as MulSubVector but it uses mulx (BMI2) and two carry chains (ADX),
+		there is no 'subtract with borrow' which leaves CF alone so the subtraction
+		is made as an addition to the complement: a - b = ~(~a + b)
+		and the OF flag is the borrow
+
+		***this method can be called only if CpuHasMulxAdx() returns true***
+	*/
+	template<uint value_size>
+	uint UInt<value_size>::MulSubVector_Adx(const uint * ss1, uint ss2, uint size, uint * result)
+	{
+	uint c;
+
+		#ifndef __GNUC__
+			#error "another compiler than GCC is currently not supported in 64bit mode"
+		#endif
+
+		#ifdef __GNUC__
+		uint dummy1, dummy2, dummy3;
+
+			__asm__ __volatile__(
+				"lea (%%rsi,%%rcx,8), %%rsi			\n"
+				"lea (%%rdi,%%rcx,8), %%rdi			\n"
+				"neg %%rcx							\n"
+				"xor %%r8, %%r8						\n"   // r8 = carry (the high word), CF=OF=0
+				"jrcxz 2f							\n"
+				"test $1, %%cl						\n"   // test clears CF and OF too
+				"jz 1f								\n"
+
+				"mulx (%%rsi,%%rcx,8), %%r9, %%r8	\n"   // an odd size - the first word separately
+				"mov (%%rdi,%%rcx,8), %%r11			\n"
+				"not %%r11							\n"   // not doesn't change the flags
+				"adox %%r9, %%r11					\n"
+				"not %%r11							\n"
+				"mov %%r11, (%%rdi,%%rcx,8)			\n"
+				"lea 1(%%rcx), %%rcx				\n"
+				"jrcxz 2f							\n"
+
+			"1:										\n"   // two words in one iteration
+				"mulx (%%rsi,%%rcx,8), %%r9, %%r10	\n"   // r10:r9 = ss1[i] * ss2
+				"adcx %%r8, %%r9					\n"
+				"mov (%%rdi,%%rcx,8), %%r11			\n"
+				"not %%r11							\n"
+				"adox %%r9, %%r11					\n"
+				"not %%r11							\n"
+				"mov %%r11, (%%rdi,%%rcx,8)			\n"
+				"mulx 8(%%rsi,%%rcx,8), %%r9, %%r8	\n"   // r8:r9 = ss1[i+1] * ss2
+				"adcx %%r10, %%r9					\n"
+				"mov 8(%%rdi,%%rcx,8), %%r11		\n"
+				"not %%r11							\n"
+				"adox %%r9, %%r11					\n"
+				"not %%r11							\n"
+				"mov %%r11, 8(%%rdi,%%rcx,8)		\n"
+
+				"lea 2(%%rcx), %%rcx				\n"
+				"jrcxz 2f							\n"
+			"jmp 1b									\n"
+			"2:										\n"
+				"mov $0, %%eax						\n"
+				"adcx %%r8, %%rax					\n"
+				"adox %%rcx, %%rax					\n"   // rcx is zero here
+
+				: "=a" (c), "=c" (dummy1), "=S" (dummy2), "=D" (dummy3)
+				: "1" (size), "2" (ss1), "3" (result), "d" (ss2)
+				: "%r8", "%r9", "%r10", "%r11", "cc", "memory" );
+
+		#endif
+
+		TTMATH_LOG("UInt::MulSubVector_Adx")
+
+	return c;
+	}
+
+
+
 	/*!
 		this method's subtracting ss2 from the 'this' and subtracting
 		carry if it has been defined
@@ -666,146 +1141,126 @@ namespace ttmath
 
 
 	/*!
-		this method moves all bits into the left hand side
-		return value <- this <- c
+		this static method moves the vector ss1 'bits' times into the left hand side
+		(result = ss1 << bits)
 
-		the lowest *bits* will be held the 'c' and
-		the state of one additional bit (on the left hand side)
-		will be returned
+		bits must be from 1 to TTMATH_BITS_PER_UINT-1, ss1 and result have 'size' words
+		(result can point to ss1), the method returns the bits which have been moved out
+		(they are in the lowest bits of the returned value)
 
 		for example:
-		let this is 001010000
-		after Rcl2(3, 1) there'll be 010000111 and Rcl2 returns 1
-	
-		***this method is created only on a 64bit platform***
+		let ss1 is 001010000 (one word) then after ShiftLeftVector(ss1, 1, 3, result)
+		the result is 010000000 and the method returns 001
 	*/
 	template<uint value_size>
-	uint UInt<value_size>::Rcl2(uint bits, uint c)
+	uint UInt<value_size>::ShiftLeftVector(const uint * ss1, uint size, uint bits, uint * result)
 	{
 	TTMATH_ASSERT( bits>0 && bits<TTMATH_BITS_PER_UINT )
 
-	uint b = value_size;
-	uint * p1 = table;
-
+	uint c;
 
 		#ifndef __GNUC__
 			#error "another compiler than GCC is currently not supported in 64bit mode"
 		#endif
 
 		#ifdef __GNUC__
-		uint dummy, dummy2, dummy3;
+		uint dummy1, dummy2;
 
-		__asm__  __volatile__(
-		
-			"movq %%rcx, %%rsi				\n"
-			"movq $64, %%rcx				\n"
-			"subq %%rsi, %%rcx				\n"
-			"movq $-1, %%rdx				\n"
-			"shrq %%cl, %%rdx				\n"
-			"movq %%rdx, %%r8 				\n"
-			"movq %%rsi, %%rcx				\n"
-
-			"xorq %%rdx, %%rdx				\n"
-			"movq %%rdx, %%rsi				\n"
-			"orq %%rax, %%rax				\n"
-			"cmovnz %%r8, %%rsi				\n"
+			/*
+				we're going from the highest word,
+				shld doesn't need a mask for the bits from the next word
+			*/
+			__asm__ __volatile__(
+				"xor %%rax, %%rax					\n"
+				"or %%rbx, %%rbx					\n"
+				"jz 3f								\n"
 
-		"1:									\n"
-			"rolq %%cl, (%%rbx,%%rdx,8)		\n"
+				"mov -8(%%rsi,%%rbx,8), %%rdx		\n"   // the highest word
+				"shld %%cl, %%rdx, %%rax			\n"   // rax = the bits moved out
+				"dec %%rbx							\n"
+				"jz 2f								\n"
+			"1:										\n"
+				"mov -8(%%rsi,%%rbx,8), %%r8		\n"
+				"shld %%cl, %%r8, %%rdx				\n"
+				"mov %%rdx, (%%rdi,%%rbx,8)			\n"
+				"mov %%r8, %%rdx					\n"
 
-			"movq (%%rbx,%%rdx,8), %%rax	\n"
-			"andq %%r8, %%rax				\n"
-			"xorq %%rax, (%%rbx,%%rdx,8)	\n"
-			"orq  %%rsi, (%%rbx,%%rdx,8)	\n"
-			"movq %%rax, %%rsi				\n"
-			
-			"incq %%rdx						\n"
-			"decq %%rdi						\n"
-		"jnz 1b								\n"
-			
-			"and $1, %%rax					\n"
+				"dec %%rbx							\n"
+			"jnz 1b									\n"
+			"2:										\n"
+				"shl %%cl, %%rdx					\n"
+				"mov %%rdx, (%%rdi)					\n"
+			"3:										\n"
 
-			: "=a" (c), "=D" (dummy), "=S" (dummy2), "=d" (dummy3)
-			: "0" (c),  "1" (b), "b" (p1), "c" (bits)
-			: "%r8", "cc", "memory" );
+				: "=a" (c), "=b" (dummy1), "=d" (dummy2)
+				: "1" (size), "c" (bits), "S" (ss1), "D" (result)
+				: "%r8", "cc", "memory" );
 
 		#endif
 
-		TTMATH_LOG("UInt::Rcl2")
+		TTMATH_LOG("UInt::ShiftLeftVector")
 
 	return c;
 	}
 
 
 	/*!
-		this method moves all bits into the right hand side
-		C -> this -> return value
+		this static method moves the vector ss1 'bits' times into the right hand side
+		(result = ss1 >> bits)
 
-		the highest *bits* will be held the 'c' and
-		the state of one additional bit (on the right hand side)
-		will be returned
+		bits must be from 1 to TTMATH_BITS_PER_UINT-1, ss1 and result have 'size' words
+		(result can point to ss1), the method returns the bits which have been moved out
+		(they are in the highest bits of the returned value)
 
 		for example:
-		let this is 000000010
-		after Rcr2(2, 1) there'll be 110000000 and Rcr2 returns 1
-
-		***this method is created only on a 64bit platform***
+		let ss1 is 000000110 (one word) then after ShiftRightVector(ss1, 1, 2, result)
+		the result is 000000001 and the method returns 100000000
 	*/
 	template<uint value_size>
-	uint UInt<value_size>::Rcr2(uint bits, uint c)
+	uint UInt<value_size>::ShiftRightVector(const uint * ss1, uint size, uint bits, uint * result)
 	{
 	TTMATH_ASSERT( bits>0 && bits<TTMATH_BITS_PER_UINT )
 
-	sint b = value_size;
-	uint * p1 = table;
-	uint dummy, dummy2, dummy3;
+	uint c;
 
 		#ifndef __GNUC__
 			#error "another compiler than GCC is currently not supported in 64bit mode"
 		#endif
 
-
 		#ifdef __GNUC__
-			__asm__  __volatile__(
+		uint dummy1, dummy2;
 
-			"movq %%rcx, %%rsi				\n"
-			"movq $64, %%rcx				\n"
-			"subq %%rsi, %%rcx				\n"
-			"movq $-1, %%rdx				\n"
-			"shlq %%cl, %%rdx				\n"
-			"movq %%rdx, %%R8				\n"
-			"movq %%rsi, %%rcx				\n"
-
-			"xorq %%rdx, %%rdx				\n"
-			"movq %%rdx, %%rsi				\n"
-			"addq %%rdi, %%rdx				\n"
-			"decq %%rdx						\n"
-			"orq %%rax, %%rax				\n"
-			"cmovnz %%R8, %%rsi				\n"
+			__asm__ __volatile__(
+				"xor %%rax, %%rax					\n"
+				"or %%rbx, %%rbx					\n"
+				"jz 3f								\n"
 
-		"1:									\n"
-			"rorq %%cl, (%%rbx,%%rdx,8)		\n"
+				"mov (%%rsi), %%rdx					\n"   // the lowest word
+				"shrd %%cl, %%rdx, %%rax			\n"   // rax = the bits moved out
+				"xor %%r9, %%r9						\n"   // r9 = index
+				"dec %%rbx							\n"
+				"jz 2f								\n"
+			"1:										\n"
+				"mov 8(%%rsi,%%r9,8), %%r8			\n"
+				"shrd %%cl, %%r8, %%rdx				\n"
+				"mov %%rdx, (%%rdi,%%r9,8)			\n"
+				"mov %%r8, %%rdx					\n"
 
-			"movq (%%rbx,%%rdx,8), %%rax	\n"
-			"andq %%R8, %%rax				\n"
-			"xorq %%rax, (%%rbx,%%rdx,8)	\n"
-			"orq  %%rsi, (%%rbx,%%rdx,8)	\n"
-			"movq %%rax, %%rsi				\n"
-			
-			"decq %%rdx						\n"
-			"decq %%rdi						\n"
-		"jnz 1b								\n"
-			
-			"rolq $1, %%rax					\n"
-			"andq $1, %%rax					\n"
+				"inc %%r9							\n"
+				"dec %%rbx							\n"
+			"jnz 1b									\n"
+			"2:										\n"
+				"shr %%cl, %%rdx					\n"
+				"mov %%rdx, (%%rdi,%%r9,8)			\n"
+			"3:										\n"
 
-			: "=a" (c), "=D" (dummy), "=S" (dummy2), "=d" (dummy3)
-			: "0" (c), "1" (b), "b" (p1), "c" (bits)
-			: "%r8", "cc", "memory" );
+				: "=a" (c), "=b" (dummy1), "=d" (dummy2)
+				: "1" (size), "c" (bits), "S" (ss1), "D" (result)
+				: "%r8", "%r9", "cc", "memory" );
 
 		#endif
 
-		TTMATH_LOG("UInt::Rcr2")
+		TTMATH_LOG("UInt::ShiftRightVector")
 
 	return c;
 	}